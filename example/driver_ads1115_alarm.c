@@ -0,0 +1,372 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_alarm.c
+ * @brief     driver ads1115 alarm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_alarm.h"
+
+/**
+ * @brief comparator queue length table definition
+ */
+static const uint8_t gs_queue_conversions[4] = {1, 2, 4, 0};
+
+static ads1115_handle_t gs_handle;                                     /**< ads1115 handle */
+static ads1115_rate_t gs_rate;                                         /**< sample rate */
+static ads1115_comparator_queue_t gs_queue;                            /**< comparator queue */
+static uint8_t gs_count;                                               /**< watched channels */
+static uint8_t gs_index;                                               /**< channel being visited */
+static ads1115_channel_t gs_channel[ADS1115_ALARM_CHANNEL_MAX];        /**< adc channels */
+static int16_t gs_high[ADS1115_ALARM_CHANNEL_MAX];                     /**< high limits in counts */
+static int16_t gs_low[ADS1115_ALARM_CHANNEL_MAX];                      /**< low limits in counts */
+static ads1115_alarm_type_t gs_state[ADS1115_ALARM_CHANNEL_MAX];       /**< reported channel states */
+static uint32_t gs_dwell_us;                                           /**< time spent on a channel */
+static uint32_t gs_steps;                                              /**< step counter */
+static uint32_t gs_reads;                                              /**< conversion read counter */
+static uint32_t gs_latched;                                            /**< latched alerts read back in range */
+
+/**
+ * @brief     arm the comparator for a channel
+ * @param[in] index is the watched channel index
+ * @return    status code
+ *            - 0 success
+ *            - 1 arm failed
+ * @note      one bus transaction switches the mux with the comparator off, then writes
+ *            the thresholds and the continuous latched window compare config
+ */
+static uint8_t a_ads1115_alarm_arm(uint8_t index)
+{
+    uint8_t res;
+    
+    /* mux and thresholds together */
+    res = ads1115_set_compare_config_word(&gs_handle, ADS1115_CONFIG_WORD(gs_channel[index], ADS1115_ALARM_DEFAULT_RANGE,
+                                                                          gs_rate, 0, ADS1115_COMPARE_WINDOW,
+                                                                          ADS1115_ALARM_DEFAULT_ALERT_PIN, 1, gs_queue),
+                                          gs_high[index], gs_low[index]);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set compare config word failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     alarm example init
+ * @param[in] addr is the iic device address
+ * @param[in] rate is the sample rate
+ * @param[in] queue is the comparator queue used to debounce every channel
+ * @param[in] *channels points to a watched channel buffer
+ * @param[in] count is the number of watched channels
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first channel is armed, call ads1115_alarm_step once every dwell time so the
+ *            conversion register holds a settled conversion of the visited channel
+ */
+uint8_t ads1115_alarm_init(ads1115_address_t addr, ads1115_rate_t rate, ads1115_comparator_queue_t queue,
+                           const ads1115_alarm_channel_t *channels, uint8_t count)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t raw;
+    
+    /* check the config */
+    if ((channels == NULL) || (count == 0) || (count > ADS1115_ALARM_CHANNEL_MAX) ||
+        (rate > ADS1115_RATE_860SPS) || (queue >= ADS1115_COMPARATOR_QUEUE_NONE_CONV))
+    {
+        ads1115_interface_debug_print("ads1115: alarm config is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set default range */
+    res = ads1115_set_range(&gs_handle, ADS1115_ALARM_DEFAULT_RANGE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set range failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* convert the limits to counts once */
+    for (i = 0; i < count; i++)
+    {
+        if ((ads1115_convert_to_register(&gs_handle, channels[i].high_threshold, &gs_high[i]) != 0) ||
+            (ads1115_convert_to_register(&gs_handle, channels[i].low_threshold, &gs_low[i]) != 0) ||
+            (gs_high[i] < gs_low[i]))
+        {
+            ads1115_interface_debug_print("ads1115: channel %d limits are invalid.\n", i);
+            (void)ads1115_deinit(&gs_handle);
+            
+            return 1;
+        }
+        gs_channel[i] = channels[i].channel;
+        gs_state[i] = ADS1115_ALARM_TYPE_CLEARED;
+    }
+    gs_rate = rate;
+    gs_queue = queue;
+    gs_count = count;
+    gs_index = 0;
+    gs_steps = 0;
+    gs_reads = 0;
+    gs_latched = 0;
+    
+    /* settle one conversion, then the queue, with 10% oscillator margin */
+    gs_dwell_us = (uint32_t)(gs_queue_conversions[queue] + 1) * ads1115_rate_to_period_us(rate);
+    gs_dwell_us += gs_dwell_us / 10;
+    
+    /* arm the first channel */
+    res = a_ads1115_alarm_arm(0);
+    if (res != 0)
+    {
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* release a latch left from before */
+    res = ads1115_read_raw(&gs_handle, &raw);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: read raw failed.\n");
+        (void)ads1115_stop_continuous_read(&gs_handle);
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get the alarm timing
+ * @param[out] *dwell_us points to a dwell time buffer
+ * @param[out] *latency_us points to a worst case detection latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get timing failed
+ * @note       a channel is visited for one settling conversion plus the queue length,
+ *             the latency covers a full rotation and allows for 10% oscillator error
+ */
+uint8_t ads1115_alarm_get_timing(uint32_t *dwell_us, uint32_t *latency_us)
+{
+    if ((dwell_us == NULL) || (latency_us == NULL) || (gs_count == 0))
+    {
+        return 1;
+    }
+    *dwell_us = gs_dwell_us;
+    *latency_us = gs_dwell_us * gs_count;
+    
+    return 0;
+}
+
+/**
+ * @brief      alarm example step
+ * @param[in]  alert is true if the alert pin fired since the last step
+ * @param[out] *event points to an alarm event buffer
+ * @param[out] *valid points to an event valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 step failed
+ * @note       the visited channel is only read when the alert pin fired, the reading is
+ *             checked against its limits in raw counts, a latch read back in range still
+ *             raises the alarm, then the next channel is armed
+ */
+uint8_t ads1115_alarm_step(ads1115_bool_t alert, ads1115_alarm_event_t *event, ads1115_bool_t *valid)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t raw = 0;
+    ads1115_alarm_type_t type = ADS1115_ALARM_TYPE_CLEARED;
+    
+    if ((event == NULL) || (valid == NULL) || (gs_count == 0))
+    {
+        return 1;
+    }
+    i = gs_index;
+    gs_steps++;
+    *valid = ADS1115_BOOL_FALSE;
+    
+    /* the read releases the latch */
+    if (alert == ADS1115_BOOL_TRUE)
+    {
+        res = ads1115_read_raw(&gs_handle, &raw);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: read raw failed.\n");
+            
+            return 1;
+        }
+        gs_reads++;
+        if (raw > gs_high[i])
+        {
+            type = ADS1115_ALARM_TYPE_HIGH;
+        }
+        else if (raw < gs_low[i])
+        {
+            type = ADS1115_ALARM_TYPE_LOW;
+        }
+        else
+        {
+            /* the comparator is off across the mux switch, so the latch is an excursion that ended before the read */
+            gs_latched++;
+            if (gs_state[i] != ADS1115_ALARM_TYPE_CLEARED)
+            {
+                type = gs_state[i];
+            }
+            else
+            {
+                type = ((int32_t)gs_high[i] - raw <= (int32_t)raw - gs_low[i]) ?
+                       ADS1115_ALARM_TYPE_HIGH : ADS1115_ALARM_TYPE_LOW;
+            }
+        }
+    }
+    
+    /* report state changes only */
+    if (type != gs_state[i])
+    {
+        gs_state[i] = type;
+        event->index = i;
+        event->channel = gs_channel[i];
+        event->type = type;
+        event->raw = (type != ADS1115_ALARM_TYPE_CLEARED) ? raw : 0;
+        event->v = 0.0f;
+        if (type != ADS1115_ALARM_TYPE_CLEARED)
+        {
+            res = ads1115_convert_to_data(&gs_handle, raw, &event->v);
+            if (res != 0)
+            {
+                ads1115_interface_debug_print("ads1115: convert to data failed.\n");
+                
+                return 1;
+            }
+        }
+        *valid = ADS1115_BOOL_TRUE;
+    }
+    
+    /* rotate */
+    gs_index = (uint8_t)((i + 1) % gs_count);
+    if (gs_count > 1)
+    {
+        return a_ads1115_alarm_arm(gs_index);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get the alarm counters
+ * @param[out] *steps points to a step counter buffer
+ * @param[out] *reads points to a conversion read counter buffer
+ * @param[out] *latched points to a latched alert read back in range counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_alarm_get_counters(uint32_t *steps, uint32_t *reads, uint32_t *latched)
+{
+    if ((steps == NULL) || (reads == NULL) || (latched == NULL))
+    {
+        return 1;
+    }
+    *steps = gs_steps;
+    *reads = gs_reads;
+    *latched = gs_latched;
+    
+    return 0;
+}
+
+/**
+ * @brief  alarm example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_alarm_deinit(void)
+{
+    uint8_t res;
+    
+    /* stop continuous read */
+    res = ads1115_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* deinit ads1115 */
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    gs_count = 0;
+    
+    return 0;
+}
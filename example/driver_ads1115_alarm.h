@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_alarm.h
+ * @brief     driver ads1115 alarm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_ALARM_H
+#define DRIVER_ADS1115_ALARM_H
+
+#include "driver_ads1115_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 alarm example default definition
+ */
+#define ADS1115_ALARM_DEFAULT_RANGE          ADS1115_RANGE_6P144V        /**< range 6.144V */
+#define ADS1115_ALARM_DEFAULT_ALERT_PIN      ADS1115_PIN_LOW             /**< pin low */
+#define ADS1115_ALARM_CHANNEL_MAX            8                           /**< watched channels at most */
+
+/**
+ * @brief ads1115 alarm type enumeration definition
+ */
+typedef enum
+{
+    ADS1115_ALARM_TYPE_CLEARED = 0x00,        /**< the channel is back inside its limits */
+    ADS1115_ALARM_TYPE_HIGH    = 0x01,        /**< the channel is above its high limit */
+    ADS1115_ALARM_TYPE_LOW     = 0x02,        /**< the channel is below its low limit */
+} ads1115_alarm_type_t;
+
+/**
+ * @brief ads1115 alarm channel structure definition
+ */
+typedef struct ads1115_alarm_channel_s
+{
+    ads1115_channel_t channel;        /**< adc channel */
+    float high_threshold;             /**< high limit in V */
+    float low_threshold;              /**< low limit in V */
+} ads1115_alarm_channel_t;
+
+/**
+ * @brief ads1115 alarm event structure definition
+ */
+typedef struct ads1115_alarm_event_s
+{
+    uint8_t index;                    /**< index into the watched channels */
+    ads1115_channel_t channel;        /**< adc channel */
+    ads1115_alarm_type_t type;        /**< alarm type */
+    int16_t raw;                      /**< raw value read with the alarm, 0 when cleared */
+    float v;                          /**< value in V, 0 when cleared */
+} ads1115_alarm_event_t;
+
+/**
+ * @brief     alarm example init
+ * @param[in] addr is the iic device address
+ * @param[in] rate is the sample rate
+ * @param[in] queue is the comparator queue used to debounce every channel
+ * @param[in] *channels points to a watched channel buffer
+ * @param[in] count is the number of watched channels
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first channel is armed, call ads1115_alarm_step once every dwell time so the
+ *            conversion register holds a settled conversion of the visited channel
+ */
+uint8_t ads1115_alarm_init(ads1115_address_t addr, ads1115_rate_t rate, ads1115_comparator_queue_t queue,
+                           const ads1115_alarm_channel_t *channels, uint8_t count);
+
+/**
+ * @brief      get the alarm timing
+ * @param[out] *dwell_us points to a dwell time buffer
+ * @param[out] *latency_us points to a worst case detection latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get timing failed
+ * @note       a channel is visited for one settling conversion plus the queue length,
+ *             the latency covers a full rotation and allows for 10% oscillator error
+ */
+uint8_t ads1115_alarm_get_timing(uint32_t *dwell_us, uint32_t *latency_us);
+
+/**
+ * @brief      alarm example step
+ * @param[in]  alert is true if the alert pin fired since the last step
+ * @param[out] *event points to an alarm event buffer
+ * @param[out] *valid points to an event valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 step failed
+ * @note       the visited channel is only read when the alert pin fired, the reading is
+ *             checked against its limits in raw counts, a latch read back in range still
+ *             raises the alarm, then the next channel is armed
+ */
+uint8_t ads1115_alarm_step(ads1115_bool_t alert, ads1115_alarm_event_t *event, ads1115_bool_t *valid);
+
+/**
+ * @brief      get the alarm counters
+ * @param[out] *steps points to a step counter buffer
+ * @param[out] *reads points to a conversion read counter buffer
+ * @param[out] *latched points to a latched alert read back in range counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_alarm_get_counters(uint32_t *steps, uint32_t *reads, uint32_t *latched);
+
+/**
+ * @brief  alarm example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_alarm_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
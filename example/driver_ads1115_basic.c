@@ -60,6 +60,10 @@ uint8_t ads1115_basic_init(ads1115_address_t addr, ads1115_channel_t channel)
     DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
     DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
     DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
     
     /* set addr pin */
     res = ads1115_set_addr_pin(&gs_handle, addr);
@@ -0,0 +1,284 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_duty.c
+ * @brief     driver ads1115 duty source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_duty.h"
+
+/**
+ * @brief typical noise table definition
+ */
+static const uint16_t gs_noise[8] = ADS1115_DUTY_NOISE;
+
+static ads1115_handle_t gs_handle;        /**< ads1115 handle */
+static uint8_t gs_burst;                  /**< conversions per burst */
+static uint64_t gs_period_us;             /**< time between burst starts */
+static uint64_t gs_release_us;            /**< next burst start */
+static float gs_lsb;                      /**< volts per count */
+static uint32_t gs_bursts;                /**< burst counter */
+static uint32_t gs_skipped;               /**< skipped burst counter */
+
+/**
+ * @brief      duty example init
+ * @param[in]  addr is the iic device address
+ * @param[in]  *config points to a duty config structure
+ * @param[out] *estimate points to a duty estimate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the highest rate whose noise averaged over the burst meets the target is chosen,
+ *             it converts for the shortest time, the device powers down between conversions
+ */
+uint8_t ads1115_duty_init(ads1115_address_t addr, const ads1115_duty_config_t *config,
+                          ads1115_duty_estimate_t *estimate)
+{
+    uint8_t res;
+    int8_t r;
+    uint32_t wait_us;
+    float target;
+    float charge;
+    
+    /* check the config */
+    if ((config == NULL) || (estimate == NULL) || (config->burst == 0) ||
+        (config->burst > ADS1115_DUTY_BURST_MAX) || (config->period_ms == 0) || (config->noise_lsb <= 0.0f))
+    {
+        ads1115_interface_debug_print("ads1115: duty config is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* averaging n conversions divides the noise by the root of n */
+    target = config->noise_lsb * 100.0f;
+    target = target * target * (float)config->burst;
+    for (r = ADS1115_RATE_860SPS; r >= ADS1115_RATE_8SPS; r--)
+    {
+        if ((float)gs_noise[r] * (float)gs_noise[r] <= target)
+        {
+            break;
+        }
+    }
+    if (r < ADS1115_RATE_8SPS)
+    {
+        ads1115_interface_debug_print("ads1115: no rate meets the noise target.\n");
+        
+        return 1;
+    }
+    
+    /* the fastest acceptable rate is also the shortest burst */
+    wait_us = ads1115_rate_to_period_us((ads1115_rate_t)r);
+    wait_us += wait_us / 10;
+    if ((uint64_t)wait_us * config->burst >= (uint64_t)config->period_ms * 1000ULL)
+    {
+        ads1115_interface_debug_print("ads1115: burst does not fit in the period.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* single shot with the comparator off, the device stays powered down until started */
+    res = ads1115_set_config_word(&gs_handle, ADS1115_CONFIG_WORD(config->channel, ADS1115_DUTY_DEFAULT_RANGE,
+                                                                  r, 1, ADS1115_COMPARE_THRESHOLD,
+                                                                  ADS1115_PIN_LOW, 0,
+                                                                  ADS1115_COMPARATOR_QUEUE_NONE_CONV));
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* volts per count of the configured range */
+    res = ads1115_convert_to_data(&gs_handle, 1, &gs_lsb);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to data failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_burst = config->burst;
+    gs_period_us = (uint64_t)config->period_ms * 1000ULL;
+    gs_release_us = ads1115_interface_timestamp_us();
+    gs_bursts = 0;
+    gs_skipped = 0;
+    
+    /* nA x us is fC, the remainder of the period is spent powered down */
+    estimate->rate = (ads1115_rate_t)r;
+    estimate->active_us = (ads1115_rate_to_period_us((ads1115_rate_t)r) + ADS1115_DUTY_WAKE_US) * config->burst;
+    estimate->idle_us = (uint32_t)(gs_period_us - estimate->active_us);
+    estimate->wakeups = config->burst + 1;
+    estimate->transactions = config->burst * 3;
+    charge = (float)ADS1115_DUTY_ACTIVE_NA * (float)estimate->active_us +
+             (float)ADS1115_DUTY_POWER_DOWN_NA * (float)estimate->idle_us;
+    estimate->charge_nc = charge / 1000000.0f / (float)config->burst;
+    estimate->average_ua = charge / 1000.0f / (float)gs_period_us;
+    
+    return 0;
+}
+
+/**
+ * @brief      duty example read
+ * @param[out] *raw points to a raw adc buffer of burst length
+ * @param[out] *s points to a converted burst mean buffer
+ * @param[out] *timestamp_us points to a burst start timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps until the next burst start, a start already missed is skipped,
+ *             the host wakes once per conversion and the bus is idle between bursts
+ */
+uint8_t ads1115_duty_read(int16_t *raw, float *s, uint64_t *timestamp_us)
+{
+    uint8_t res;
+    uint8_t i;
+    int32_t sum;
+    uint32_t wait_us;
+    uint64_t now;
+    
+    if ((raw == NULL) || (s == NULL) || (timestamp_us == NULL) || (gs_burst == 0))
+    {
+        return 1;
+    }
+    
+    /* keep the grid, drop the starts that already passed */
+    now = ads1115_interface_timestamp_us();
+    while (gs_release_us + gs_period_us <= now)
+    {
+        gs_release_us += gs_period_us;
+        gs_skipped++;
+    }
+    ads1115_interface_delay_until_us(gs_release_us);
+    *timestamp_us = gs_release_us;
+    gs_release_us += gs_period_us;
+    
+    /* one wake per conversion, the device powers down after each */
+    sum = 0;
+    for (i = 0; i < gs_burst; i++)
+    {
+        res = ads1115_start_single_read(&gs_handle, &wait_us);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: start single read failed.\n");
+            
+            return 1;
+        }
+        ads1115_interface_delay_until_us(ads1115_interface_timestamp_us() + wait_us);
+        res = ads1115_read_raw(&gs_handle, &raw[i]);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: read raw failed.\n");
+            
+            return 1;
+        }
+        sum += raw[i];
+    }
+    *s = (float)sum * gs_lsb / (float)gs_burst;
+    gs_bursts++;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the duty counters
+ * @param[out] *bursts points to a burst counter buffer
+ * @param[out] *skipped points to a skipped burst counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_duty_get_counters(uint32_t *bursts, uint32_t *skipped)
+{
+    if ((bursts == NULL) || (skipped == NULL))
+    {
+        return 1;
+    }
+    *bursts = gs_bursts;
+    *skipped = gs_skipped;
+    
+    return 0;
+}
+
+/**
+ * @brief  duty example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_duty_deinit(void)
+{
+    uint8_t res;
+    
+    /* deinit ads1115 */
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    gs_burst = 0;
+    
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_duty.h
+ * @brief     driver ads1115 duty header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_DUTY_H
+#define DRIVER_ADS1115_DUTY_H
+
+#include "driver_ads1115_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 duty example default definition
+ */
+#define ADS1115_DUTY_DEFAULT_RANGE        ADS1115_RANGE_6P144V        /**< set range 6.144V */
+#define ADS1115_DUTY_BURST_MAX            16                          /**< conversions per burst at most */
+
+/**
+ * @brief ads1115 duty power definition
+ */
+#ifndef ADS1115_DUTY_ACTIVE_NA
+    #define ADS1115_DUTY_ACTIVE_NA        150000                      /**< typical supply current while converting */
+#endif
+#ifndef ADS1115_DUTY_POWER_DOWN_NA
+    #define ADS1115_DUTY_POWER_DOWN_NA    500                         /**< typical supply current in power down */
+#endif
+#ifndef ADS1115_DUTY_WAKE_US
+    #define ADS1115_DUTY_WAKE_US          25                          /**< power up time before a single conversion */
+#endif
+#ifndef ADS1115_DUTY_NOISE
+    #define ADS1115_DUTY_NOISE            {100, 100, 100, 100, 100, 135, 140, 250}        /**< typical peak to peak noise per rate in 1/100 lsb */
+#endif
+
+/**
+ * @brief ads1115 duty config structure definition
+ */
+typedef struct ads1115_duty_config_s
+{
+    ads1115_channel_t channel;        /**< adc channel */
+    uint32_t period_ms;               /**< time between burst starts */
+    uint8_t burst;                    /**< conversions averaged per burst */
+    float noise_lsb;                  /**< peak to peak noise target of the burst mean in lsb */
+} ads1115_duty_config_t;
+
+/**
+ * @brief ads1115 duty estimate structure definition
+ */
+typedef struct ads1115_duty_estimate_s
+{
+    ads1115_rate_t rate;              /**< chosen sample rate */
+    uint32_t active_us;               /**< converting time per burst */
+    uint32_t idle_us;                 /**< power down time per period */
+    uint32_t wakeups;                 /**< host wakeups per burst */
+    uint32_t transactions;            /**< bus transactions per burst */
+    float charge_nc;                  /**< supply charge per sample in nC */
+    float average_ua;                 /**< average supply current in uA */
+} ads1115_duty_estimate_t;
+
+/**
+ * @brief      duty example init
+ * @param[in]  addr is the iic device address
+ * @param[in]  *config points to a duty config structure
+ * @param[out] *estimate points to a duty estimate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the highest rate whose noise averaged over the burst meets the target is chosen,
+ *             it converts for the shortest time, the device powers down between conversions
+ */
+uint8_t ads1115_duty_init(ads1115_address_t addr, const ads1115_duty_config_t *config,
+                          ads1115_duty_estimate_t *estimate);
+
+/**
+ * @brief      duty example read
+ * @param[out] *raw points to a raw adc buffer of burst length
+ * @param[out] *s points to a converted burst mean buffer
+ * @param[out] *timestamp_us points to a burst start timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps until the next burst start, a start already missed is skipped,
+ *             the host wakes once per conversion and the bus is idle between bursts
+ */
+uint8_t ads1115_duty_read(int16_t *raw, float *s, uint64_t *timestamp_us);
+
+/**
+ * @brief      get the duty counters
+ * @param[out] *bursts points to a burst counter buffer
+ * @param[out] *skipped points to a skipped burst counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_duty_get_counters(uint32_t *bursts, uint32_t *skipped);
+
+/**
+ * @brief  duty example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_duty_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
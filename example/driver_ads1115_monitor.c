@@ -0,0 +1,435 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_monitor.c
+ * @brief     driver ads1115 monitor source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_monitor.h"
+
+static ads1115_handle_t gs_handle;                 /**< ads1115 handle */
+static ads1115_monitor_rearm_t gs_rearm;           /**< rearm policy */
+static int32_t gs_band;                            /**< track window half width in counts */
+static int32_t gs_high;                            /**< high limit in counts */
+static int32_t gs_low;                             /**< low limit in counts */
+static int32_t gs_hysteresis;                      /**< hysteresis in counts */
+static uint8_t gs_burst;                           /**< conversions per event */
+
+/**
+ * @brief     clamp a count to the register range
+ * @param[in] x is the count
+ * @return    clamped count
+ * @note      none
+ */
+static int16_t a_ads1115_monitor_clamp(int32_t x)
+{
+    if (x > 32767)
+    {
+        return 32767;
+    }
+    if (x < -32768)
+    {
+        return -32768;
+    }
+    
+    return (int16_t)x;
+}
+
+/**
+ * @brief      burst read and program the next window
+ * @param[out] *event points to a monitor event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       all decisions are made in raw counts
+ */
+static uint8_t a_ads1115_monitor_update(ads1115_monitor_event_t *event)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t raw[ADS1115_MONITOR_BURST_MAX];
+    uint64_t timestamp[ADS1115_MONITOR_BURST_MAX];
+    ads1115_bool_t fresh[ADS1115_MONITOR_BURST_MAX];
+    uint8_t count;
+    int32_t sum;
+    int32_t avg;
+    int32_t high;
+    int32_t low;
+    
+    /* burst read */
+    res = ads1115_read_n(&gs_handle, raw, NULL, timestamp, fresh, gs_burst);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: read n failed.\n");
+        
+        return 1;
+    }
+    
+    /* average the fresh samples, a duplicate would weight one conversion twice */
+    sum = 0;
+    count = 0;
+    for (i = 0; i < gs_burst; i++)
+    {
+        if (fresh[i] == ADS1115_BOOL_TRUE)
+        {
+            sum += raw[i];
+            count++;
+        }
+    }
+    avg = (sum >= 0) ? ((sum + count / 2) / count) : -((-sum + count / 2) / count);
+    
+    /* next window */
+    if (gs_rearm == ADS1115_MONITOR_REARM_TRACK)
+    {
+        event->state = ADS1115_MONITOR_STATE_INSIDE;
+        high = avg + gs_band;
+        low = avg - gs_band;
+    }
+    else if (avg > gs_high)
+    {
+        /* wait to fall back below the high limit by the hysteresis */
+        event->state = ADS1115_MONITOR_STATE_ABOVE;
+        high = 32767;
+        low = gs_high - gs_hysteresis;
+    }
+    else if (avg < gs_low)
+    {
+        /* wait to rise back above the low limit by the hysteresis */
+        event->state = ADS1115_MONITOR_STATE_BELOW;
+        high = gs_low + gs_hysteresis;
+        low = -32768;
+    }
+    else
+    {
+        event->state = ADS1115_MONITOR_STATE_INSIDE;
+        high = gs_high;
+        low = gs_low;
+    }
+    event->raw = (int16_t)avg;
+    event->timestamp_us = timestamp[gs_burst - 1];
+    event->high_threshold = a_ads1115_monitor_clamp(high);
+    event->low_threshold = a_ads1115_monitor_clamp(low);
+    res = ads1115_convert_to_data(&gs_handle, event->raw, &event->v);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to data failed.\n");
+        
+        return 1;
+    }
+    
+    /* set compare threshold */
+    res = ads1115_set_compare_threshold(&gs_handle, event->high_threshold, event->low_threshold);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set compare threshold failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      monitor example init
+ * @param[in]  addr is the iic device address
+ * @param[in]  channel is the adc channel
+ * @param[in]  rate is the sample rate
+ * @param[in]  *config points to a monitor config structure
+ * @param[out] *event points to a monitor event buffer for the initial value
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the window is armed around the initial value, drain the pending alert edges
+ *             and call ads1115_monitor_arm before waiting
+ */
+uint8_t ads1115_monitor_init(ads1115_address_t addr, ads1115_channel_t channel, ads1115_rate_t rate,
+                             const ads1115_monitor_config_t *config, ads1115_monitor_event_t *event)
+{
+    uint8_t res;
+    int16_t reg;
+    int16_t high;
+    int16_t low;
+    
+    /* check the config */
+    if ((config == NULL) || (event == NULL) || (config->burst == 0) || (config->burst > ADS1115_MONITOR_BURST_MAX) ||
+        (config->band < 0.0f) || (config->hysteresis < 0.0f) ||
+        ((config->rearm == ADS1115_MONITOR_REARM_LIMIT) && (config->high_limit < config->low_limit)))
+    {
+        ads1115_interface_debug_print("ads1115: monitor config is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set channel */
+    res = ads1115_set_channel(&gs_handle, channel);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set channel failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default range */
+    res = ads1115_set_range(&gs_handle, ADS1115_MONITOR_DEFAULT_RANGE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set range failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set rate */
+    res = ads1115_set_rate(&gs_handle, rate);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set rate failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* convert the config to counts */
+    res = ads1115_convert_to_register(&gs_handle, config->band, &reg);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to register failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_band = reg;
+    res = ads1115_convert_to_register(&gs_handle, config->hysteresis, &reg);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to register failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_hysteresis = reg;
+    res = ads1115_convert_to_register(&gs_handle, config->high_limit, &high);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to high threshold register failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_high = high;
+    res = ads1115_convert_to_register(&gs_handle, config->low_limit, &low);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: convert to low threshold register failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_low = low;
+    gs_rearm = config->rearm;
+    gs_burst = config->burst;
+    
+    /* set default alert pin */
+    res = ads1115_set_alert_pin(&gs_handle, ADS1115_MONITOR_DEFAULT_ALERT_PIN);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set alert pin failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* window compare */
+    res = ads1115_set_compare_mode(&gs_handle, ADS1115_COMPARE_WINDOW);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set compare mode failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* latch the alert until the host reads */
+    res = ads1115_set_compare(&gs_handle, ADS1115_BOOL_TRUE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set compare failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the widest window until the first value is known */
+    res = ads1115_set_compare_threshold(&gs_handle, 32767, -32768);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set compare threshold failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* assert after a single conversion */
+    res = ads1115_set_comparator_queue(&gs_handle, ADS1115_MONITOR_DEFAULT_COMPARATOR_QUEUE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set comparator queue failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* start continuous read */
+    res = ads1115_start_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: start continues read mode failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* arm around the initial value */
+    res = a_ads1115_monitor_update(event);
+    if (res != 0)
+    {
+        (void)ads1115_stop_continuous_read(&gs_handle);
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      monitor example service
+ * @param[out] *event points to a monitor event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ * @note       call when the alert pin fires, it burst reads and programs the next window,
+ *             drain the pending alert edges and call ads1115_monitor_arm afterwards
+ */
+uint8_t ads1115_monitor_service(ads1115_monitor_event_t *event)
+{
+    if (event == NULL)
+    {
+        return 1;
+    }
+    
+    return a_ads1115_monitor_update(event);
+}
+
+/**
+ * @brief  monitor example arm
+ * @return status code
+ *         - 0 success
+ *         - 1 arm failed
+ * @note   one conversion register read releases the latched alert, there is no bus
+ *         activity after it until the alert pin fires again
+ */
+uint8_t ads1115_monitor_arm(void)
+{
+    int16_t raw;
+    float s;
+    
+    /* a latch set against the previous window is released here */
+    if (ads1115_continuous_read(&gs_handle, (int16_t *)&raw, (float *)&s) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief  monitor example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_monitor_deinit(void)
+{
+    uint8_t res;
+    
+    /* stop continuous read */
+    res = ads1115_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* deinit ads1115 */
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
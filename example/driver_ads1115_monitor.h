@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_monitor.h
+ * @brief     driver ads1115 monitor header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_MONITOR_H
+#define DRIVER_ADS1115_MONITOR_H
+
+#include "driver_ads1115_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 monitor example default definition
+ */
+#define ADS1115_MONITOR_DEFAULT_RANGE                   ADS1115_RANGE_6P144V                /**< range 6.144V */
+#define ADS1115_MONITOR_DEFAULT_ALERT_PIN               ADS1115_PIN_LOW                     /**< pin low */
+#define ADS1115_MONITOR_DEFAULT_COMPARATOR_QUEUE        ADS1115_COMPARATOR_QUEUE_1_CONV     /**< 1 conv */
+#define ADS1115_MONITOR_BURST_MAX                       16                                  /**< conversions per event at most */
+
+/**
+ * @brief ads1115 monitor rearm enumeration definition
+ */
+typedef enum
+{
+    ADS1115_MONITOR_REARM_TRACK = 0x00,        /**< center the window on every new value */
+    ADS1115_MONITOR_REARM_LIMIT = 0x01,        /**< fixed limits with hysteresis */
+} ads1115_monitor_rearm_t;
+
+/**
+ * @brief ads1115 monitor state enumeration definition
+ */
+typedef enum
+{
+    ADS1115_MONITOR_STATE_INSIDE = 0x00,        /**< inside the limits */
+    ADS1115_MONITOR_STATE_ABOVE  = 0x01,        /**< above the high limit */
+    ADS1115_MONITOR_STATE_BELOW  = 0x02,        /**< below the low limit */
+} ads1115_monitor_state_t;
+
+/**
+ * @brief ads1115 monitor config structure definition
+ */
+typedef struct ads1115_monitor_config_s
+{
+    ads1115_monitor_rearm_t rearm;        /**< rearm policy */
+    float band;                           /**< track window half width in V */
+    float high_limit;                     /**< limit mode high limit in V */
+    float low_limit;                      /**< limit mode low limit in V */
+    float hysteresis;                     /**< V a crossed limit must be recrossed by */
+    uint8_t burst;                        /**< conversions averaged per event */
+} ads1115_monitor_config_t;
+
+/**
+ * @brief ads1115 monitor event structure definition
+ */
+typedef struct ads1115_monitor_event_s
+{
+    int16_t raw;                          /**< averaged raw value */
+    float v;                              /**< averaged value in V */
+    uint64_t timestamp_us;                /**< time of the last burst conversion */
+    ads1115_monitor_state_t state;        /**< state against the limits */
+    int16_t high_threshold;               /**< armed high threshold */
+    int16_t low_threshold;                /**< armed low threshold */
+} ads1115_monitor_event_t;
+
+/**
+ * @brief      monitor example init
+ * @param[in]  addr is the iic device address
+ * @param[in]  channel is the adc channel
+ * @param[in]  rate is the sample rate
+ * @param[in]  *config points to a monitor config structure
+ * @param[out] *event points to a monitor event buffer for the initial value
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the window is armed around the initial value, drain the pending alert edges
+ *             and call ads1115_monitor_arm before waiting
+ */
+uint8_t ads1115_monitor_init(ads1115_address_t addr, ads1115_channel_t channel, ads1115_rate_t rate,
+                             const ads1115_monitor_config_t *config, ads1115_monitor_event_t *event);
+
+/**
+ * @brief      monitor example service
+ * @param[out] *event points to a monitor event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service failed
+ * @note       call when the alert pin fires, it burst reads and programs the next window,
+ *             drain the pending alert edges and call ads1115_monitor_arm afterwards
+ */
+uint8_t ads1115_monitor_service(ads1115_monitor_event_t *event);
+
+/**
+ * @brief  monitor example arm
+ * @return status code
+ *         - 0 success
+ *         - 1 arm failed
+ * @note   one conversion register read releases the latched alert, there is no bus
+ *         activity after it until the alert pin fires again
+ */
+uint8_t ads1115_monitor_arm(void);
+
+/**
+ * @brief  monitor example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_monitor_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_pair.c
+ * @brief     driver ads1115 pair source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_pair.h"
+
+static ads1115_handle_t gs_handle;        /**< ads1115 handle */
+static ads1115_power_t gs_power;          /**< power engine */
+static uint16_t gs_conf[2];               /**< voltage and current config words */
+static ads1115_power_input_t gs_input;    /**< input being converted */
+static uint64_t gs_start_us;              /**< conversion start time */
+static uint32_t gs_wait_us;               /**< conversion wait */
+static uint8_t gs_inited;                 /**< 1 if inited */
+
+/**
+ * @brief      start a conversion
+ * @param[in]  input is the input to convert
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       the time is taken after the write, both inputs share the offset so it cancels
+ */
+static uint8_t a_ads1115_pair_start(ads1115_power_input_t input)
+{
+    if (ads1115_start_single_read_word(&gs_handle, gs_conf[input], &gs_wait_us) != 0)
+    {
+        return 1;
+    }
+    gs_start_us = ads1115_interface_timestamp_us();
+    gs_input = input;
+    
+    return 0;
+}
+
+/**
+ * @brief     pair example init
+ * @param[in] addr is the iic device address
+ * @param[in] v_channel is the voltage channel
+ * @param[in] i_channel is the current channel
+ * @param[in] rate is the sample rate
+ * @param[in] v_ratio is the voltage divider ratio
+ * @param[in] i_per_volt is the current per shunt volt, 1 / shunt ohm
+ * @param[in] window is the number of pairs per average
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      both channels convert single shot with their own range, the first voltage conversion is started here
+ */
+uint8_t ads1115_pair_init(ads1115_address_t addr, ads1115_channel_t v_channel, ads1115_channel_t i_channel,
+                          ads1115_rate_t rate, float v_ratio, float i_per_volt, uint32_t window)
+{
+    uint8_t res;
+    float v_lsb;
+    float i_lsb;
+    
+    /* check the config */
+    if ((v_channel == i_channel) || (rate > ADS1115_RATE_860SPS))
+    {
+        ads1115_interface_debug_print("ads1115: pair config is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* a voltage gap spans two conversions, allow the clock tolerance, the bus and scheduling on top */
+    v_lsb = ads1115_range_to_full_scale_v(ADS1115_PAIR_DEFAULT_V_RANGE) / 32768.0f;
+    i_lsb = ads1115_range_to_full_scale_v(ADS1115_PAIR_DEFAULT_I_RANGE) / 32768.0f;
+    res = ads1115_power_init(&gs_power, v_lsb * v_ratio, i_lsb * i_per_volt, window,
+                             ads1115_rate_to_period_us(rate) * 4);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: power init failed.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* one word per input switches the mux, the range and starts in one write */
+    gs_conf[ADS1115_POWER_INPUT_VOLTAGE] = ADS1115_CONFIG_WORD(v_channel, ADS1115_PAIR_DEFAULT_V_RANGE, rate, 1,
+                                                               ADS1115_COMPARE_THRESHOLD, ADS1115_PIN_LOW, 0,
+                                                               ADS1115_COMPARATOR_QUEUE_NONE_CONV);
+    gs_conf[ADS1115_POWER_INPUT_CURRENT] = ADS1115_CONFIG_WORD(i_channel, ADS1115_PAIR_DEFAULT_I_RANGE, rate, 1,
+                                                               ADS1115_COMPARE_THRESHOLD, ADS1115_PIN_LOW, 0,
+                                                               ADS1115_COMPARATOR_QUEUE_NONE_CONV);
+    
+    /* prime the first voltage conversion */
+    res = a_ads1115_pair_start(ADS1115_POWER_INPUT_VOLTAGE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: start single read word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    gs_inited = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief      pair example read
+ * @param[out] *sample points to a power sample buffer
+ * @param[out] *valid points to a sample valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       converts one voltage and one current sample, each conversion starts right after the previous
+ *             one is read with a single write, the voltage is interpolated to the current sample time
+ */
+uint8_t ads1115_pair_read(ads1115_power_sample_t *sample, ads1115_bool_t *valid)
+{
+    uint8_t res;
+    uint8_t i;
+    int16_t raw;
+    uint64_t start_us;
+    ads1115_bool_t v;
+    ads1115_power_input_t input;
+    
+    if ((sample == NULL) || (valid == NULL) || (gs_inited == 0))
+    {
+        return 1;
+    }
+    
+    *valid = ADS1115_BOOL_FALSE;
+    for (i = 0; i < 2; i++)
+    {
+        /* finish the running conversion */
+        ads1115_interface_delay_until_us(gs_start_us + gs_wait_us);
+        res = ads1115_read_raw(&gs_handle, &raw);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: read raw failed.\n");
+            
+            return 1;
+        }
+        
+        /* start the other input before the math */
+        input = gs_input;
+        start_us = gs_start_us;
+        res = a_ads1115_pair_start((input == ADS1115_POWER_INPUT_VOLTAGE) ? ADS1115_POWER_INPUT_CURRENT :
+                                   ADS1115_POWER_INPUT_VOLTAGE);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: start single read word failed.\n");
+            
+            return 1;
+        }
+        (void)ads1115_power_update(&gs_power, input, raw, start_us, sample, &v);
+        if (v == ADS1115_BOOL_TRUE)
+        {
+            *valid = ADS1115_BOOL_TRUE;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      pair example get average
+ * @param[out] *average points to a power average buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new average
+ * @note       none
+ */
+uint8_t ads1115_pair_get_average(ads1115_power_average_t *average)
+{
+    if (ads1115_power_get_average(&gs_power, average) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get the pair counters
+ * @param[out] *pairs points to an aligned pair counter buffer
+ * @param[out] *skipped points to a skipped current sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_pair_get_counters(uint32_t *pairs, uint32_t *skipped)
+{
+    if ((pairs == NULL) || (skipped == NULL))
+    {
+        return 1;
+    }
+    (void)ads1115_power_get_counters(&gs_power, pairs, skipped);
+    
+    return 0;
+}
+
+/**
+ * @brief  pair example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_pair_deinit(void)
+{
+    uint8_t res;
+    
+    /* deinit ads1115 */
+    gs_inited = 0;
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_pair.h
+ * @brief     driver ads1115 pair header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_PAIR_H
+#define DRIVER_ADS1115_PAIR_H
+
+#include "driver_ads1115_interface.h"
+#include "driver_ads1115_power.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 pair example default definition
+ */
+#define ADS1115_PAIR_DEFAULT_V_RANGE        ADS1115_RANGE_2P048V        /**< set voltage range 2.048V */
+#define ADS1115_PAIR_DEFAULT_I_RANGE        ADS1115_RANGE_0P256V        /**< set current range 0.256V */
+
+/**
+ * @brief     pair example init
+ * @param[in] addr is the iic device address
+ * @param[in] v_channel is the voltage channel
+ * @param[in] i_channel is the current channel
+ * @param[in] rate is the sample rate
+ * @param[in] v_ratio is the voltage divider ratio
+ * @param[in] i_per_volt is the current per shunt volt, 1 / shunt ohm
+ * @param[in] window is the number of pairs per average
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      both channels convert single shot with their own range, the first voltage conversion is started here
+ */
+uint8_t ads1115_pair_init(ads1115_address_t addr, ads1115_channel_t v_channel, ads1115_channel_t i_channel,
+                          ads1115_rate_t rate, float v_ratio, float i_per_volt, uint32_t window);
+
+/**
+ * @brief      pair example read
+ * @param[out] *sample points to a power sample buffer
+ * @param[out] *valid points to a sample valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       converts one voltage and one current sample, each conversion starts right after the previous
+ *             one is read with a single write, the voltage is interpolated to the current sample time
+ */
+uint8_t ads1115_pair_read(ads1115_power_sample_t *sample, ads1115_bool_t *valid);
+
+/**
+ * @brief      pair example get average
+ * @param[out] *average points to a power average buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new average
+ * @note       none
+ */
+uint8_t ads1115_pair_get_average(ads1115_power_average_t *average);
+
+/**
+ * @brief      get the pair counters
+ * @param[out] *pairs points to an aligned pair counter buffer
+ * @param[out] *skipped points to a skipped current sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get counters failed
+ * @note       none
+ */
+uint8_t ads1115_pair_get_counters(uint32_t *pairs, uint32_t *skipped);
+
+/**
+ * @brief  pair example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_pair_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_scan.c
+ * @brief     driver ads1115 scan source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_scan.h"
+
+static ads1115_handle_t gs_handle;                            /**< ads1115 handle */
+static uint16_t gs_conf[ADS1115_SCAN_MAX_CHANNELS];           /**< config word per channel */
+static uint8_t gs_channels;                                   /**< channels per scan */
+static uint8_t gs_index;                                      /**< channel being converted */
+static uint64_t gs_start_us;                                  /**< conversion start time */
+static uint32_t gs_wait_us;                                   /**< conversion wait */
+
+/**
+ * @brief     start a conversion
+ * @param[in] index is the channel index in the scan
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the time is taken after the write, every channel shares the offset
+ */
+static uint8_t a_ads1115_scan_start(uint8_t index)
+{
+    if (ads1115_start_single_read_word(&gs_handle, gs_conf[index], &gs_wait_us) != 0)
+    {
+        return 1;
+    }
+    gs_start_us = ads1115_interface_timestamp_us();
+    gs_index = index;
+    
+    return 0;
+}
+
+/**
+ * @brief     scan example init
+ * @param[in] addr is the iic device address
+ * @param[in] *channel points to the scan channel list
+ * @param[in] channels is the number of channels in the list
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every channel converts single shot, the first conversion is started here
+ */
+uint8_t ads1115_scan_init(ads1115_address_t addr, const ads1115_channel_t *channel, uint8_t channels,
+                          ads1115_rate_t rate)
+{
+    uint8_t res;
+    uint8_t i;
+    
+    /* check the config */
+    if ((channel == NULL) || (channels == 0) || (channels > ADS1115_SCAN_MAX_CHANNELS) ||
+        (rate > ADS1115_RATE_860SPS))
+    {
+        ads1115_interface_debug_print("ads1115: scan config is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* one word per channel switches the mux and starts in one write */
+    for (i = 0; i < channels; i++)
+    {
+        gs_conf[i] = ADS1115_CONFIG_WORD(channel[i], ADS1115_SCAN_DEFAULT_RANGE, rate, 1,
+                                         ADS1115_COMPARE_THRESHOLD, ADS1115_PIN_LOW, 0,
+                                         ADS1115_COMPARATOR_QUEUE_NONE_CONV);
+    }
+    gs_channels = channels;
+    
+    /* prime the first conversion */
+    res = a_ads1115_scan_start(0);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: start single read word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        gs_channels = 0;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      scan example read
+ * @param[out] *raw points to a raw adc buffer of one entry per channel
+ * @param[out] *timestamp_us points to a conversion time buffer of one entry per channel
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one scan in list order, each conversion starts right after the previous one is read
+ *             with a single write and is stamped with its own start time, so channel k lags channel 0
+ */
+uint8_t ads1115_scan_read(int16_t *raw, uint64_t *timestamp_us)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t index;
+    
+    if ((raw == NULL) || (timestamp_us == NULL) || (gs_channels == 0))
+    {
+        return 1;
+    }
+    
+    for (i = 0; i < gs_channels; i++)
+    {
+        /* finish the running conversion */
+        ads1115_interface_delay_until_us(gs_start_us + gs_wait_us);
+        index = gs_index;
+        res = ads1115_read_raw(&gs_handle, &raw[index]);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: read raw failed.\n");
+            
+            return 1;
+        }
+        timestamp_us[index] = gs_start_us;
+        
+        /* start the next channel at once */
+        res = a_ads1115_scan_start((uint8_t)((index + 1) % gs_channels));
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: start single read word failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  scan example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_scan_deinit(void)
+{
+    uint8_t res;
+    
+    /* deinit ads1115 */
+    gs_channels = 0;
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
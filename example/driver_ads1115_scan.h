@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_scan.h
+ * @brief     driver ads1115 scan header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_SCAN_H
+#define DRIVER_ADS1115_SCAN_H
+
+#include "driver_ads1115_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 scan example default definition
+ */
+#define ADS1115_SCAN_DEFAULT_RANGE        ADS1115_RANGE_6P144V        /**< set range 6.144V */
+#define ADS1115_SCAN_MAX_CHANNELS         8                           /**< channels per scan at most */
+
+/**
+ * @brief     scan example init
+ * @param[in] addr is the iic device address
+ * @param[in] *channel points to the scan channel list
+ * @param[in] channels is the number of channels in the list
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every channel converts single shot, the first conversion is started here
+ */
+uint8_t ads1115_scan_init(ads1115_address_t addr, const ads1115_channel_t *channel, uint8_t channels,
+                          ads1115_rate_t rate);
+
+/**
+ * @brief      scan example read
+ * @param[out] *raw points to a raw adc buffer of one entry per channel
+ * @param[out] *timestamp_us points to a conversion time buffer of one entry per channel
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one scan in list order, each conversion starts right after the previous one is read
+ *             with a single write and is stamped with its own start time, so channel k lags channel 0
+ */
+uint8_t ads1115_scan_read(int16_t *raw, uint64_t *timestamp_us);
+
+/**
+ * @brief  scan example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_scan_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
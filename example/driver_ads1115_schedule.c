@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_schedule.c
+ * @brief     driver ads1115 schedule source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_schedule.h"
+
+static ads1115_handle_t gs_handle[ADS1115_SCHEDULE_MAX_DEVICES];                                        /**< ads1115 handles */
+static ads1115_scheduler_t gs_scheduler;                                                                /**< ads1115 scheduler */
+static ads1115_scheduler_task_t gs_task[ADS1115_SCHEDULE_MAX_DEVICES * ADS1115_SCHEDULE_CHANNELS];      /**< channel tasks */
+static uint8_t gs_addr;                                                                                 /**< first addr pin */
+static uint8_t gs_devices;                                                                              /**< device number */
+
+/**
+ * @brief     init one device
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] addr is the iic device address
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_ads1115_schedule_device_init(ads1115_handle_t *handle, ads1115_address_t addr, ads1115_rate_t rate)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* write range, rate and disabled compare in one transaction */
+    res = ads1115_set_config_word(handle, ADS1115_CONFIG_WORD(ADS1115_CHANNEL_AIN0_GND, ADS1115_SCHEDULE_DEFAULT_RANGE, rate,
+                                                              ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                              ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                              ADS1115_COMPARATOR_QUEUE_NONE_CONV));
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set config word failed.\n");
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     schedule example init
+ * @param[in] addr is the addr pin of the first device
+ * @param[in] devices is the device number, the following addr pins are used in order
+ * @param[in] rate is the sample rate of every device
+ * @param[in] period_us is the period of AIN0_GND, AINk_GND runs 2^k times slower
+ * @param[in] policy is the scheduling policy
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every device converts single shot
+ */
+uint8_t ads1115_schedule_init(ads1115_address_t addr, uint8_t devices, ads1115_rate_t rate,
+                              uint32_t period_us, ads1115_scheduler_policy_t policy)
+{
+    uint8_t res;
+    uint8_t d;
+    uint8_t c;
+    
+    if ((devices == 0) || ((uint32_t)addr + devices > ADS1115_SCHEDULE_MAX_DEVICES) || (period_us == 0))
+    {
+        ads1115_interface_debug_print("ads1115: devices or period is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* scheduler init */
+    res = ads1115_scheduler_init(&gs_scheduler, policy, ADS1115_SCHEDULE_DEFAULT_TRANSACTION,
+                                 ads1115_interface_timestamp_us);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: scheduler init failed.\n");
+        
+        return 1;
+    }
+    
+    /* one task per channel, each channel half the rate of the previous one */
+    for (d = 0; d < devices; d++)
+    {
+        res = a_ads1115_schedule_device_init(&gs_handle[d], (ads1115_address_t)(addr + d), rate);
+        if (res != 0)
+        {
+            gs_devices = d;
+            (void)ads1115_schedule_deinit();
+            
+            return 1;
+        }
+        for (c = 0; c < ADS1115_SCHEDULE_CHANNELS; c++)
+        {
+            res = ads1115_scheduler_add_task(&gs_scheduler, &gs_task[d * ADS1115_SCHEDULE_CHANNELS + c], &gs_handle[d],
+                                             (ads1115_channel_t)(ADS1115_CHANNEL_AIN0_GND + c), period_us << c, 0,
+                                             NULL, NULL);
+            if (res != 0)
+            {
+                ads1115_interface_debug_print("ads1115: scheduler add task failed.\n");
+                gs_devices = d + 1;
+                (void)ads1115_schedule_deinit();
+                
+                return 1;
+            }
+        }
+    }
+    gs_addr = (uint8_t)addr;
+    gs_devices = devices;
+    
+    return 0;
+}
+
+/**
+ * @brief      schedule example check the task set
+ * @param[out] *device_load points to a worst device utilization buffer
+ * @param[out] *bus_load points to a predicted bus utilization buffer
+ * @return     status code
+ *             - 0 schedulable
+ *             - 1 not schedulable
+ * @note       none
+ */
+uint8_t ads1115_schedule_check(float *device_load, float *bus_load)
+{
+    if (ads1115_scheduler_check(&gs_scheduler, device_load, bus_load) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     schedule example run
+ * @param[in] ms is the run time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      sleeps until the next release or ready time between the steps
+ */
+uint8_t ads1115_schedule_run(uint32_t ms)
+{
+    uint64_t end_us;
+    uint64_t next_us;
+    
+    /* release the first jobs */
+    if (ads1115_scheduler_start(&gs_scheduler) != 0)
+    {
+        return 1;
+    }
+    end_us = ads1115_interface_timestamp_us() + (uint64_t)ms * 1000ULL;
+    
+    while (ads1115_interface_timestamp_us() < end_us)
+    {
+        if (ads1115_scheduler_run(&gs_scheduler, &next_us) != 0)
+        {
+            return 1;
+        }
+        ads1115_interface_delay_until_us((next_us < end_us) ? next_us : end_us);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      schedule example get the measured statistics
+ * @param[out] *misses points to a total deadline miss counter buffer
+ * @param[out] *bus_load points to a measured bus utilization buffer
+ * @param[out] *tasks points to a task number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_schedule_get_statistics(uint32_t *misses, float *bus_load, uint8_t *tasks)
+{
+    if (ads1115_scheduler_get_statistics(&gs_scheduler, misses, bus_load) != 0)
+    {
+        return 1;
+    }
+    *tasks = gs_scheduler.count;
+    
+    return 0;
+}
+
+/**
+ * @brief      schedule example get the counters of a task
+ * @param[in]  index is the task index
+ * @param[out] *info points to a task information buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       tasks are ordered by device, then by channel
+ */
+uint8_t ads1115_schedule_get_task(uint8_t index, ads1115_schedule_info_t *info)
+{
+    ads1115_scheduler_task_t *task;
+    
+    if (index >= gs_scheduler.count)
+    {
+        return 1;
+    }
+    
+    task = gs_scheduler.task[index];
+    info->addr = (uint8_t)(gs_addr + index / ADS1115_SCHEDULE_CHANNELS);
+    info->channel = (uint8_t)(index % ADS1115_SCHEDULE_CHANNELS);
+    info->period_us = task->period_us;
+    info->jobs = task->jobs;
+    info->misses = task->misses;
+    info->max_latency_us = task->max_latency_us;
+    info->v = task->v;
+    
+    return 0;
+}
+
+/**
+ * @brief  schedule example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_schedule_deinit(void)
+{
+    uint8_t d;
+    uint8_t res = 0;
+    
+    /* deinit every device */
+    for (d = 0; d < gs_devices; d++)
+    {
+        if (ads1115_deinit(&gs_handle[d]) != 0)
+        {
+            res = 1;
+        }
+    }
+    gs_devices = 0;
+    
+    return res;
+}
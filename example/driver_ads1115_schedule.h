@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_schedule.h
+ * @brief     driver ads1115 schedule header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_SCHEDULE_H
+#define DRIVER_ADS1115_SCHEDULE_H
+
+#include "driver_ads1115_interface.h"
+#include "driver_ads1115_scheduler.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 schedule example default definition
+ */
+#define ADS1115_SCHEDULE_DEFAULT_RANGE          ADS1115_RANGE_6P144V        /**< set range 6.144V */
+#define ADS1115_SCHEDULE_DEFAULT_TRANSACTION    75                          /**< one register transaction at 400kHz in us */
+#define ADS1115_SCHEDULE_MAX_DEVICES            4                           /**< devices on one bus at most */
+#define ADS1115_SCHEDULE_CHANNELS               4                           /**< scheduled channels per device */
+
+/**
+ * @brief ads1115 schedule example task information structure definition
+ */
+typedef struct ads1115_schedule_info_s
+{
+    uint8_t addr;                   /**< device address pin */
+    uint8_t channel;                /**< channel index from AIN0_GND on */
+    uint32_t period_us;             /**< release period */
+    uint32_t jobs;                  /**< completed jobs */
+    uint32_t misses;                /**< deadline misses */
+    uint32_t max_latency_us;        /**< worst release to completion latency */
+    float v;                        /**< last converted result */
+} ads1115_schedule_info_t;
+
+/**
+ * @brief     schedule example init
+ * @param[in] addr is the addr pin of the first device
+ * @param[in] devices is the device number, the following addr pins are used in order
+ * @param[in] rate is the sample rate of every device
+ * @param[in] period_us is the period of AIN0_GND, AINk_GND runs 2^k times slower
+ * @param[in] policy is the scheduling policy
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every device converts single shot
+ */
+uint8_t ads1115_schedule_init(ads1115_address_t addr, uint8_t devices, ads1115_rate_t rate,
+                              uint32_t period_us, ads1115_scheduler_policy_t policy);
+
+/**
+ * @brief      schedule example check the task set
+ * @param[out] *device_load points to a worst device utilization buffer
+ * @param[out] *bus_load points to a predicted bus utilization buffer
+ * @return     status code
+ *             - 0 schedulable
+ *             - 1 not schedulable
+ * @note       none
+ */
+uint8_t ads1115_schedule_check(float *device_load, float *bus_load);
+
+/**
+ * @brief     schedule example run
+ * @param[in] ms is the run time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      sleeps until the next release or ready time between the steps
+ */
+uint8_t ads1115_schedule_run(uint32_t ms);
+
+/**
+ * @brief      schedule example get the measured statistics
+ * @param[out] *misses points to a total deadline miss counter buffer
+ * @param[out] *bus_load points to a measured bus utilization buffer
+ * @param[out] *tasks points to a task number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_schedule_get_statistics(uint32_t *misses, float *bus_load, uint8_t *tasks);
+
+/**
+ * @brief      schedule example get the counters of a task
+ * @param[in]  index is the task index
+ * @param[out] *info points to a task information buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       tasks are ordered by device, then by channel
+ */
+uint8_t ads1115_schedule_get_task(uint8_t index, ads1115_schedule_info_t *info);
+
+/**
+ * @brief  schedule example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_schedule_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,397 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_stream.c
+ * @brief     driver ads1115 stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_stream.h"
+
+static ads1115_handle_t gs_handle;            /**< ads1115 handle */
+static ads1115_sequence_t gs_sequence;        /**< ads1115 sequence */
+static ads1115_clock_t gs_clock;              /**< ads1115 clock recovery from the ready edges */
+static volatile uint32_t gs_edges;            /**< ready edges counted by the clock */
+static uint8_t gs_ready;                      /**< 1 when the reads are tagged by the ready edges */
+
+/**
+ * @brief      tag a read
+ * @param[in]  read_us is the time the read started
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 tag failed
+ * @note       counts the ready edges when they are fed, else paces the read times by the period,
+ *             the read times never refit the period since only reads judged fresh would feed it
+ */
+static uint8_t a_ads1115_stream_tag(uint64_t read_us, uint32_t *seq, ads1115_bool_t *fresh)
+{
+    if (gs_ready != 0)
+    {
+        return (ads1115_sequence_update_edges(&gs_sequence, gs_edges, seq, fresh) != 0) ? 1 : 0;
+    }
+    
+    return (ads1115_sequence_update_time(&gs_sequence, read_us, seq, fresh) != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     stream example init
+ * @param[in] addr is the iic device address
+ * @param[in] channel is the adc channel
+ * @param[in] rate is the adc sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip runs in continuous mode
+ */
+uint8_t ads1115_stream_init(ads1115_address_t addr, ads1115_channel_t channel, ads1115_rate_t rate)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(&gs_handle, ads1115_handle_t); 
+    DRIVER_ADS1115_LINK_IIC_INIT(&gs_handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(&gs_handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(&gs_handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
+    
+    /* set addr pin */
+    res = ads1115_set_addr_pin(&gs_handle, addr);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* ads1115 init */
+    res = ads1115_init(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* write channel, range, rate and disabled compare in one transaction */
+    res = ads1115_set_config_word(&gs_handle, ADS1115_CONFIG_WORD(channel, ADS1115_STREAM_DEFAULT_RANGE, rate,
+                                                                  ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                                  ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                                  ADS1115_COMPARATOR_QUEUE_NONE_CONV));
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* start continuous read */
+    res = ads1115_start_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: start continus read mode failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* track the conversions from now */
+    res = ads1115_sequence_init(&gs_sequence, rate, ads1115_interface_timestamp_us());
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: sequence init failed.\n");
+        (void)ads1115_stop_continuous_read(&gs_handle);
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* recover the conversion period from the ready edges */
+    gs_edges = 0;
+    gs_ready = 0;
+    res = ads1115_clock_init(&gs_clock, rate);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: clock init failed.\n");
+        (void)ads1115_stop_continuous_read(&gs_handle);
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example read
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *s points to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one iic transaction, the range comes from the shadow config
+ */
+uint8_t ads1115_stream_read(int16_t *raw, float *s)
+{
+    uint32_t seq;
+    ads1115_bool_t fresh;
+    
+    return ads1115_stream_read_sequence(raw, s, &seq, &fresh);
+}
+
+/**
+ * @brief      stream example read with a sequence number
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *s points to a converted adc buffer
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a read that is not fresh returns the previous conversion again
+ */
+uint8_t ads1115_stream_read_sequence(int16_t *raw, float *s, uint32_t *seq, ads1115_bool_t *fresh)
+{
+    uint64_t read_us;
+    
+    /* read data */
+    read_us = ads1115_interface_timestamp_us();
+    if (ads1115_continuous_read(&gs_handle, raw, s) != 0)
+    {
+        return 1;
+    }
+    
+    /* tag the sample */
+    if (a_ads1115_stream_tag(read_us, seq, fresh) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example read a block of samples
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *timestamp_us points to a timestamp buffer
+ * @param[out] *seq points to a sequence number buffer
+ * @param[in]  n is the number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       paced by the conversion period, a repeated sequence number marks a duplicate
+ */
+uint8_t ads1115_stream_read_block(int16_t *raw, uint64_t *timestamp_us, uint32_t *seq, uint32_t n)
+{
+    uint32_t i;
+    ads1115_bool_t fresh;
+    
+    /* read data */
+    if (ads1115_read_n(&gs_handle, raw, NULL, timestamp_us, NULL, n) != 0)
+    {
+        return 1;
+    }
+    
+    /* tag the samples, a ready edge stream times them by the fitted conversion instead of the read */
+    for (i = 0; i < n; i++)
+    {
+        if (a_ads1115_stream_tag(timestamp_us[i], &seq[i], &fresh) != 0)
+        {
+            return 1;
+        }
+        if (gs_ready != 0)
+        {
+            (void)ads1115_clock_get_sample_time(&gs_clock, gs_edges - 1, &timestamp_us[i]);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the sequence counters
+ * @param[out] *samples points to a fresh sample counter buffer
+ * @param[out] *duplicates points to a duplicate read counter buffer
+ * @param[out] *drops points to a dropped conversion counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_stream_get_counters(uint32_t *samples, uint32_t *duplicates, uint32_t *drops)
+{
+    if (ads1115_sequence_get_counters(&gs_sequence, samples, duplicates, drops) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example enable the conversion ready edges
+ * @return    status code
+ *            - 0 success
+ *            - 1 enable failed
+ * @note      the alert pin pulses low once per conversion, feed every falling edge to
+ *            ads1115_stream_edge and the reads are tagged by the edge count from then on
+ */
+uint8_t ads1115_stream_enable_ready(void)
+{
+    uint8_t res;
+    
+    /* set the conversion ready pin */
+    res = ads1115_set_conversion_ready_pin(&gs_handle, ADS1115_BOOL_TRUE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set conversion ready pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* count from the first edge */
+    gs_edges = 0;
+    gs_sequence.edges = 0;
+    gs_ready = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example feed a conversion ready edge
+ * @param[in] timestamp_us is the edge timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 edge is rejected
+ * @note      call it from the gpio interrupt or the edge poll of the reading thread,
+ *            the fitted period paces the sequence and the handle once the edge window is full
+ */
+uint8_t ads1115_stream_edge(uint64_t timestamp_us)
+{
+    float period;
+    
+    /* fit the edge */
+    if (ads1115_clock_update(&gs_clock, timestamp_us) != 0)
+    {
+        return 1;
+    }
+    
+    /* the clock counts the edges lost between two timestamps too */
+    gs_edges = gs_clock.last_sample + 1;
+    
+    /* a full window averages the edge jitter out */
+    if ((gs_clock.len == ADS1115_CLOCK_WINDOW) && (ads1115_clock_get_period(&gs_clock, &period) == 0))
+    {
+        (void)ads1115_sequence_set_period(&gs_sequence, (uint32_t)(period + 0.5f));
+        (void)ads1115_clock_apply(&gs_clock, &gs_handle);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the ready edge statistics
+ * @param[out] *edges points to an edge counter buffer
+ * @param[out] *missed points to a missed edge counter buffer
+ * @param[out] *rejected points to a rejected edge counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_stream_get_edges(uint32_t *edges, uint32_t *missed, uint32_t *rejected)
+{
+    if ((edges == NULL) || (ads1115_clock_get_statistics(&gs_clock, missed, rejected) != 0))
+    {
+        return 1;
+    }
+    *edges = gs_edges;
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the conversion period
+ * @param[out] *period_us points to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       fitted to the ready edges once two arrived, else the datasheet period
+ */
+uint8_t ads1115_stream_get_period(float *period_us)
+{
+    if (period_us == NULL)
+    {
+        return 1;
+    }
+    if (ads1115_clock_get_period(&gs_clock, period_us) != 0)
+    {
+        *period_us = (float)gs_sequence.period_us;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_stream_deinit(void)
+{
+    uint8_t res;
+    
+    /* stop continuous read */
+    res = ads1115_stop_continuous_read(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* deinit ads1115 */
+    res = ads1115_deinit(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
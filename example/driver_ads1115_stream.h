@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_stream.h
+ * @brief     driver ads1115 stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_STREAM_H
+#define DRIVER_ADS1115_STREAM_H
+
+#include "driver_ads1115_interface.h"
+#include "driver_ads1115_sequence.h"
+#include "driver_ads1115_clock.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ads1115_example_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 stream example default definition
+ */
+#define ADS1115_STREAM_DEFAULT_RANGE        ADS1115_RANGE_6P144V        /**< set range 6.144V */
+#define ADS1115_STREAM_DEFAULT_RATE         ADS1115_RATE_860SPS         /**< set 860 SPS */
+
+/**
+ * @brief     stream example init
+ * @param[in] addr is the iic device address
+ * @param[in] channel is the adc channel
+ * @param[in] rate is the adc sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip runs in continuous mode
+ */
+uint8_t ads1115_stream_init(ads1115_address_t addr, ads1115_channel_t channel, ads1115_rate_t rate);
+
+/**
+ * @brief      stream example read
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *s points to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one iic transaction, the range comes from the shadow config
+ */
+uint8_t ads1115_stream_read(int16_t *raw, float *s);
+
+/**
+ * @brief      stream example read with a sequence number
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *s points to a converted adc buffer
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a read that is not fresh returns the previous conversion again
+ */
+uint8_t ads1115_stream_read_sequence(int16_t *raw, float *s, uint32_t *seq, ads1115_bool_t *fresh);
+
+/**
+ * @brief      stream example read a block of samples
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *timestamp_us points to a timestamp buffer
+ * @param[out] *seq points to a sequence number buffer
+ * @param[in]  n is the number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       paced by the conversion period, a repeated sequence number marks a duplicate
+ */
+uint8_t ads1115_stream_read_block(int16_t *raw, uint64_t *timestamp_us, uint32_t *seq, uint32_t n);
+
+/**
+ * @brief      stream example get the sequence counters
+ * @param[out] *samples points to a fresh sample counter buffer
+ * @param[out] *duplicates points to a duplicate read counter buffer
+ * @param[out] *drops points to a dropped conversion counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_stream_get_counters(uint32_t *samples, uint32_t *duplicates, uint32_t *drops);
+
+/**
+ * @brief     stream example enable the conversion ready edges
+ * @return    status code
+ *            - 0 success
+ *            - 1 enable failed
+ * @note      the alert pin pulses low once per conversion, feed every falling edge to
+ *            ads1115_stream_edge and the reads are tagged by the edge count from then on
+ */
+uint8_t ads1115_stream_enable_ready(void);
+
+/**
+ * @brief     stream example feed a conversion ready edge
+ * @param[in] timestamp_us is the edge timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 edge is rejected
+ * @note      call it from the gpio interrupt or the edge poll of the reading thread,
+ *            the fitted period paces the sequence and the handle once the edge window is full
+ */
+uint8_t ads1115_stream_edge(uint64_t timestamp_us);
+
+/**
+ * @brief      stream example get the ready edge statistics
+ * @param[out] *edges points to an edge counter buffer
+ * @param[out] *missed points to a missed edge counter buffer
+ * @param[out] *rejected points to a rejected edge counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t ads1115_stream_get_edges(uint32_t *edges, uint32_t *missed, uint32_t *rejected);
+
+/**
+ * @brief      stream example get the conversion period
+ * @param[out] *period_us points to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       fitted to the ready edges once two arrived, else the datasheet period
+ */
+uint8_t ads1115_stream_get_period(float *period_us);
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ads1115_stream_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
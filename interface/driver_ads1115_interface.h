@@ -102,6 +102,20 @@ uint8_t ads1115_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
  */
 void ads1115_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t ads1115_interface_timestamp_us(void);
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us is the monotonic wake time in us
+ * @note      returns at once when the deadline has passed
+ */
+void ads1115_interface_delay_until_us(uint64_t deadline_us);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt is the format data
@@ -109,6 +123,20 @@ void ads1115_interface_delay_ms(uint32_t ms);
  */
 void ads1115_interface_debug_print(const char *const fmt, ...);
 
+/**
+ * @brief     interface bus lock
+ * @param[in] *bus points to the bus lock argument
+ * @note      none
+ */
+void ads1115_interface_lock(void *bus);
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *bus points to the bus lock argument
+ * @note      none
+ */
+void ads1115_interface_unlock(void *bus);
+
 /**
  * @}
  */
@@ -103,6 +103,26 @@ void ads1115_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t ads1115_interface_timestamp_us(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us is the monotonic wake time in us
+ * @note      returns at once when the deadline has passed
+ */
+void ads1115_interface_delay_until_us(uint64_t deadline_us)
+{
+
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt is the format data
@@ -112,3 +132,23 @@ void ads1115_interface_debug_print(const char *const fmt, ...)
 {
 
 }
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *bus points to the bus lock argument
+ * @note      none
+ */
+void ads1115_interface_lock(void *bus)
+{
+
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *bus points to the bus lock argument
+ * @note      none
+ */
+void ads1115_interface_unlock(void *bus)
+{
+
+}
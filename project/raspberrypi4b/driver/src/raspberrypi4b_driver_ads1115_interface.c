@@ -37,7 +37,10 @@
 
 #include "driver_ads1115_interface.h"
 #include "iic.h"
+#include <pthread.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
@@ -48,17 +51,37 @@
  * @brief iic device handle definition
  */
 static int gs_fd;                           /**< iic handle */
+static uint32_t gs_users = 0;               /**< handles sharing the iic handle, guarded by gs_mutex */
+
+/**
+ * @brief iic device lock definition
+ */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< iic bus lock */
 
 /**
  * @brief  interface iic bus init
  * @return status code
  *         - 0 success
  *         - 1 iic init failed
- * @note   none
+ * @note   handles on the same bus share one iic handle, the count is taken under gs_mutex
+ *         so handles opened from different threads never open the device twice
  */
 uint8_t ads1115_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    pthread_mutex_lock(&gs_mutex);
+    if (gs_users == 0)
+    {
+        if (iic_init(IIC_DEVICE_NAME, &gs_fd) != 0)
+        {
+            pthread_mutex_unlock(&gs_mutex);
+            
+            return 1;
+        }
+    }
+    gs_users++;
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return 0;
 }
 
 /**
@@ -66,11 +89,29 @@ uint8_t ads1115_interface_iic_init(void)
  * @return status code
  *         - 0 success
  *         - 1 iic deinit failed
- * @note   none
+ * @note   the iic handle is closed with the last handle, the count is taken under gs_mutex
  */
 uint8_t ads1115_interface_iic_deinit(void)
 {
-    return iic_deinit(gs_fd);
+    uint8_t res;
+    
+    pthread_mutex_lock(&gs_mutex);
+    if (gs_users == 0)
+    {
+        pthread_mutex_unlock(&gs_mutex);
+        
+        return 1;
+    }
+    if (--gs_users != 0)
+    {
+        pthread_mutex_unlock(&gs_mutex);
+        
+        return 0;
+    }
+    res = iic_deinit(gs_fd);
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return res;
 }
 
 /**
@@ -115,6 +156,37 @@ void ads1115_interface_delay_ms(uint32_t ms)
     usleep(ms * 1000);
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t ads1115_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us is the monotonic wake time in us
+ * @note      clock_nanosleep on CLOCK_MONOTONIC with TIMER_ABSTIME, so loops keep their phase
+ */
+void ads1115_interface_delay_until_us(uint64_t deadline_us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+    ts.tv_nsec = (long)((deadline_us % 1000000ULL) * 1000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        
+    }
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt is the format data
@@ -134,3 +206,23 @@ void ads1115_interface_debug_print(const char *const fmt, ...)
     len = strlen((char *)str);
     (void)printf((uint8_t *)str, len);
 }
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *bus points to the bus lock argument
+ * @note      bus points to a pthread_mutex_t, NULL means the IIC_DEVICE_NAME bus
+ */
+void ads1115_interface_lock(void *bus)
+{
+    (void)pthread_mutex_lock((bus != NULL) ? (pthread_mutex_t *)bus : &gs_mutex);
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *bus points to the bus lock argument
+ * @note      bus points to a pthread_mutex_t, NULL means the IIC_DEVICE_NAME bus
+ */
+void ads1115_interface_unlock(void *bus)
+{
+    (void)pthread_mutex_unlock((bus != NULL) ? (pthread_mutex_t *)bus : &gs_mutex);
+}
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ads1115d_client.h
+ * @brief     ads1115d client header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef ADS1115D_CLIENT_H
+#define ADS1115D_CLIENT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup ads1115d_client ads1115d_client function
+ * @brief    ads1115d_client function modules
+ * @{
+ */
+
+/**
+ * @brief ads1115d protocol definition
+ */
+#define ADS1115D_DEFAULT_SOCKET        "/tmp/ads1115d.sock"        /**< default socket path */
+#define ADS1115D_KEEP                  0xFF                        /**< keep the current range or rate */
+
+/**
+ * @brief ads1115d operation enumeration definition
+ */
+typedef enum
+{
+    ADS1115D_OP_READ        = 0x01,        /**< one sample no older than arg ms */
+    ADS1115D_OP_SUBSCRIBE   = 0x02,        /**< one sample event every arg ms */
+    ADS1115D_OP_UNSUBSCRIBE = 0x03,        /**< stop the subscription with the same id */
+    ADS1115D_OP_CONFIG      = 0x04,        /**< set the range and rate of a device */
+    ADS1115D_OP_SAMPLE      = 0x81,        /**< subscription sample event */
+} ads1115d_op_t;
+
+/**
+ * @brief ads1115d request structure definition
+ */
+typedef struct ads1115d_request_s
+{
+    uint8_t op;               /**< ads1115d_op_t */
+    uint8_t device;           /**< ads1115_address_t of the device */
+    uint8_t channel;          /**< ads1115_channel_t */
+    uint8_t range;            /**< ads1115_range_t or ADS1115D_KEEP */
+    uint8_t rate;             /**< ads1115_rate_t or ADS1115D_KEEP */
+    uint8_t reserved[3];      /**< zero */
+    uint32_t id;              /**< echoed in the response */
+    uint32_t arg;             /**< max age or period in ms */
+} ads1115d_request_t;
+
+/**
+ * @brief ads1115d response structure definition
+ */
+typedef struct ads1115d_response_s
+{
+    uint8_t op;                   /**< ads1115d_op_t */
+    uint8_t status;               /**< 0 success, 1 failed, 4 busy or full, 5 invalid */
+    uint8_t device;               /**< ads1115_address_t of the device */
+    uint8_t channel;              /**< ads1115_channel_t */
+    uint32_t id;                  /**< request id */
+    int16_t raw;                  /**< raw sample */
+    uint16_t reserved;            /**< zero */
+    float v;                      /**< converted sample */
+    uint64_t timestamp_ns;        /**< monotonic sample time */
+} ads1115d_response_t;
+
+/**
+ * @brief      connect to the daemon
+ * @param[in]  *path is the socket path, NULL for the default
+ * @param[out] *fd points to a socket fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 connect failed
+ * @note       one message per packet, host byte order
+ */
+uint8_t ads1115d_client_connect(const char *path, int *fd);
+
+/**
+ * @brief     close the connection
+ * @param[in] fd is the socket fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the daemon drops the subscriptions of the connection
+ */
+uint8_t ads1115d_client_close(int fd);
+
+/**
+ * @brief     send a request
+ * @param[in] fd is the socket fd
+ * @param[in] *request points to a request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ * @note      none
+ */
+uint8_t ads1115d_client_send(int fd, const ads1115d_request_t *request);
+
+/**
+ * @brief      receive a response or a sample event
+ * @param[in]  fd is the socket fd
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 receive failed
+ * @note       blocks until a message arrives
+ */
+uint8_t ads1115d_client_receive(int fd, ads1115d_response_t *response);
+
+/**
+ * @brief      read one sample
+ * @param[in]  fd is the socket fd
+ * @param[in]  device is the ads1115_address_t of the device
+ * @param[in]  channel is the ads1115_channel_t
+ * @param[in]  max_age_ms is the accepted sample age
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sample events arriving before the response are dropped
+ */
+uint8_t ads1115d_client_read(int fd, uint8_t device, uint8_t channel, uint32_t max_age_ms,
+                             ads1115d_response_t *response);
+
+/**
+ * @brief     subscribe to a channel
+ * @param[in] fd is the socket fd
+ * @param[in] device is the ads1115_address_t of the device
+ * @param[in] channel is the ads1115_channel_t
+ * @param[in] period_ms is the event period
+ * @param[in] id is the subscription id carried by its events
+ * @return    status code
+ *            - 0 success
+ *            - 1 subscribe failed
+ * @note      the acknowledgement and the events arrive through ads1115d_client_receive
+ */
+uint8_t ads1115d_client_subscribe(int fd, uint8_t device, uint8_t channel, uint32_t period_ms, uint32_t id);
+
+/**
+ * @brief     unsubscribe
+ * @param[in] fd is the socket fd
+ * @param[in] id is the subscription id
+ * @return    status code
+ *            - 0 success
+ *            - 1 unsubscribe failed
+ * @note      none
+ */
+uint8_t ads1115d_client_unsubscribe(int fd, uint32_t id);
+
+/**
+ * @brief      set the range and rate of a device
+ * @param[in]  fd is the socket fd
+ * @param[in]  device is the ads1115_address_t of the device
+ * @param[in]  range is the ads1115_range_t or ADS1115D_KEEP
+ * @param[in]  rate is the ads1115_rate_t or ADS1115D_KEEP
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config failed
+ * @note       applied once the conversions in flight on the device are done
+ */
+uint8_t ads1115d_client_config(int fd, uint8_t device, uint8_t range, uint8_t rate, ads1115d_response_t *response);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
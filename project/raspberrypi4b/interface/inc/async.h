@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      async.h
+ * @brief     async header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include "driver_ads1115_executor.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup async async function
+ * @brief    async function modules
+ * @{
+ */
+
+/**
+ * @brief async notify max definition
+ */
+#define ASYNC_NOTIFY_MAX 16        /**< ready edges a bus holds for the worker */
+
+/**
+ * @brief async request type enumeration definition
+ */
+typedef enum
+{
+    ASYNC_REQUEST_READ   = 0x00,        /**< read a channel */
+    ASYNC_REQUEST_CONFIG = 0x01,        /**< run a config function */
+} async_request_type_t;
+
+/**
+ * @brief async request structure definition
+ */
+typedef struct async_request_s
+{
+    ads1115_op_t op;                                                     /**< executor operation, holds status, raw and v */
+    async_request_type_t type;                                           /**< request type */
+    uint8_t (*config)(ads1115_handle_t *handle, void *arg);              /**< config function of a config request */
+    void (*callback)(struct async_request_s *request);                   /**< completion callback run on the worker */
+    void *arg;                                                           /**< user argument */
+    uint64_t timestamp_us;                                               /**< completion time */
+    struct async_bus_s *bus;                                             /**< bus the request waits on, internal */
+    struct async_request_s *next;                                        /**< submit link, internal */
+} async_request_t;
+
+/**
+ * @brief async bus structure definition
+ */
+typedef struct async_bus_s
+{
+    ads1115_executor_t executor;                         /**< conversion executor of the bus, worker only */
+    async_request_t *head;                               /**< submitted requests not yet on the executor */
+    async_request_t *tail;                               /**< submitted requests tail */
+    ads1115_handle_t *notify[ASYNC_NOTIFY_MAX];          /**< ready edges not yet on the executor */
+    uint8_t notify_len;                                  /**< ready edges length */
+    struct async_bus_s *next;                            /**< next bus of the engine */
+    struct async_s *engine;                              /**< engine serving the bus */
+} async_bus_t;
+
+/**
+ * @brief async engine structure definition
+ */
+typedef struct async_s
+{
+    pthread_t thread;                    /**< worker thread */
+    pthread_mutex_t mutex;               /**< submit mutex, never held across bus io or callbacks */
+    pthread_cond_t cond;                 /**< submit condition */
+    async_bus_t *bus;                    /**< bus list */
+    uint8_t stop;                        /**< stop flag */
+} async_t;
+
+/**
+ * @brief     async engine init
+ * @param[in] *engine points to an async engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      one worker thread serves every bus added to the engine
+ */
+uint8_t async_init(async_t *engine);
+
+/**
+ * @brief     async engine deinit
+ * @param[in] *engine points to an async engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      requests not yet finished complete with status 1
+ */
+uint8_t async_deinit(async_t *engine);
+
+/**
+ * @brief     add an iic bus to the engine
+ * @param[in] *engine points to an async engine structure
+ * @param[in] *bus points to an async bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      each bus has its own executor, the bus must stay valid until async_deinit
+ */
+uint8_t async_add_bus(async_t *engine, async_bus_t *bus);
+
+/**
+ * @brief     submit a read request
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to an async request structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] *callback points to a completion callback
+ * @param[in] *arg is the user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      the request must stay valid until its callback runs,
+ *            a callback may submit again, the handle must be on the bus
+ */
+uint8_t async_submit(async_bus_t *bus, async_request_t *request, ads1115_handle_t *handle,
+                     ads1115_channel_t channel, void (*callback)(async_request_t *request), void *arg);
+
+/**
+ * @brief     submit a config request
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to an async request structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *config points to a config function called on the worker with the handle and arg
+ * @param[in] *callback points to a completion callback
+ * @param[in] *arg is the user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      config runs once the conversion in flight on the device finishes,
+ *            so it keeps its order with the reads of the device, a config error completes with status 1
+ */
+uint8_t async_submit_config(async_bus_t *bus, async_request_t *request, ads1115_handle_t *handle,
+                            uint8_t (*config)(ads1115_handle_t *handle, void *arg),
+                            void (*callback)(async_request_t *request), void *arg);
+
+/**
+ * @brief     wake the conversion of a device on its conversion ready edge
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 notify failed
+ * @note      call from the ready pin handler, without it the worker waits the conversion period,
+ *            the edge is handed to the worker, so an edge without a conversion in flight is dropped there,
+ *            it fails when ASYNC_NOTIFY_MAX edges are already pending
+ */
+uint8_t async_notify(async_bus_t *bus, ads1115_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      cache.h
+ * @brief     cache header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "driver_ads1115.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup cache cache function
+ * @brief    cache function modules
+ * @{
+ */
+
+/**
+ * @brief cache channel definition
+ */
+#define CACHE_CHANNEL_MAX 8        /**< one slot per ads1115_channel_t */
+
+/**
+ * @brief cache entry structure definition
+ */
+typedef struct cache_entry_s
+{
+    int16_t raw;                  /**< raw sample */
+    float v;                      /**< converted sample */
+    uint64_t timestamp_ns;        /**< sample time */
+} cache_entry_t;
+
+/**
+ * @brief cache structure definition
+ */
+typedef struct cache_s
+{
+    ads1115_handle_t *handle;                       /**< device used by refresh reads */
+    pthread_mutex_t mutex;                          /**< serializes the conversions */
+    uint32_t seq[CACHE_CHANNEL_MAX];                /**< per channel sequence, odd while writing */
+    cache_entry_t entry[CACHE_CHANNEL_MAX];         /**< per channel latest value */
+    uint64_t hits;                                  /**< reads served from the cache */
+    uint64_t refreshes;                             /**< reads that ran a conversion */
+} cache_t;
+
+/**
+ * @brief     init the cache
+ * @param[in] *cache points to a cache structure
+ * @param[in] *handle points to an initialized ads1115 handle in single shot mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t cache_init(cache_t *cache, ads1115_handle_t *handle);
+
+/**
+ * @brief     deinit the cache
+ * @param[in] *cache points to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t cache_deinit(cache_t *cache);
+
+/**
+ * @brief     publish a sample
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the sample channel
+ * @param[in] raw is the raw sample
+ * @param[in] v is the converted sample
+ * @param[in] timestamp_ns is the monotonic sample time
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      for samples the acquisition thread read itself
+ */
+uint8_t cache_publish(cache_t *cache, ads1115_channel_t channel, int16_t raw, float v, uint64_t timestamp_ns);
+
+/**
+ * @brief     drop every cached sample
+ * @param[in] *cache points to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      call after the range or rate changed, the channels read as never published
+ */
+uint8_t cache_clear(cache_t *cache);
+
+/**
+ * @brief     convert a channel and publish the sample
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the channel to convert
+ * @return    status code
+ *            - 0 success
+ *            - 1 refresh failed
+ * @note      one single shot conversion with the cache mutex held
+ */
+uint8_t cache_refresh(cache_t *cache, ads1115_channel_t channel);
+
+/**
+ * @brief      get the latest sample
+ * @param[in]  *cache points to a cache structure
+ * @param[in]  channel is the sample channel
+ * @param[out] *entry points to a cache entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ *             - 2 nothing published yet
+ * @note       never blocks and never touches the bus
+ */
+uint8_t cache_get(cache_t *cache, ads1115_channel_t channel, cache_entry_t *entry);
+
+/**
+ * @brief      get a sample no older than a bound
+ * @param[in]  *cache points to a cache structure
+ * @param[in]  channel is the sample channel
+ * @param[in]  max_age_ms is the staleness bound
+ * @param[out] *entry points to a cache entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       converts only when the cached sample is too old, concurrent callers share one conversion
+ */
+uint8_t cache_get_fresh(cache_t *cache, ads1115_channel_t channel, uint32_t max_age_ms, cache_entry_t *entry);
+
+/**
+ * @brief      get the cache statistics
+ * @param[in]  *cache points to a cache structure
+ * @param[out] *hits points to a hit counter buffer
+ * @param[out] *refreshes points to a refresh counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t cache_get_statistics(cache_t *cache, uint64_t *hits, uint64_t *refreshes);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
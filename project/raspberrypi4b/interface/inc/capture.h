@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      capture.h
+ * @brief     capture header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup capture capture function
+ * @brief    capture function modules
+ * @{
+ */
+
+/**
+ * @brief capture definition
+ */
+#define CAPTURE_MAGIC              "ADS1115C"        /**< file magic, 8 bytes */
+#define CAPTURE_CHUNK_MAGIC        0x4B4E4843U       /**< "CHNK" */
+#define CAPTURE_VERSION            1                 /**< format version */
+#define CAPTURE_CHUNK_SAMPLES      2048              /**< int16 samples per chunk */
+#define CAPTURE_STREAM_MAX         8                 /**< chunks open at once in the writer */
+#define CAPTURE_CHUNK_SPAN_NS      4000000000ULL     /**< a chunk is closed once it spans this time */
+
+/**
+ * @brief capture file header structure definition
+ */
+typedef struct capture_header_s
+{
+    char magic[8];                    /**< CAPTURE_MAGIC */
+    uint16_t version;                 /**< CAPTURE_VERSION */
+    uint16_t header_size;             /**< sizeof(capture_header_t) */
+    uint32_t chunk_size;              /**< sizeof(capture_chunk_t) */
+    uint32_t chunk_samples;           /**< CAPTURE_CHUNK_SAMPLES */
+    uint32_t reserved0;               /**< zero */
+    uint64_t start_realtime_ns;       /**< wall clock at open */
+    uint64_t max_span_ns;             /**< largest written_ns - first_ns of any chunk */
+    uint8_t reserved[24];             /**< zero */
+} capture_header_t;
+
+/**
+ * @brief capture chunk header structure definition
+ */
+typedef struct capture_chunk_header_s
+{
+    uint32_t magic;                   /**< CAPTURE_CHUNK_MAGIC */
+    uint16_t count;                   /**< valid samples */
+    uint8_t addr;                     /**< ads1115_address_t of the device */
+    uint8_t channel;                  /**< ads1115_channel_t */
+    uint8_t range;                    /**< ads1115_range_t */
+    uint8_t rate;                     /**< ads1115_rate_t */
+    uint16_t reserved0;               /**< zero */
+    float lsb_v;                      /**< volts per raw count */
+    uint32_t first_seq;               /**< sequence number of the first sample */
+    uint32_t last_seq;                /**< sequence number of the last sample */
+    uint64_t first_ns;                /**< time of the first sample */
+    uint64_t last_ns;                 /**< time of the last sample */
+    uint64_t written_ns;              /**< write order key, never decreases along the file */
+    uint8_t reserved[16];             /**< zero */
+} capture_chunk_header_t;
+
+/**
+ * @brief capture chunk structure definition
+ */
+typedef struct capture_chunk_s
+{
+    capture_chunk_header_t header;                 /**< chunk header */
+    int16_t raw[CAPTURE_CHUNK_SAMPLES];            /**< samples */
+} capture_chunk_t;
+
+/**
+ * @brief capture writer structure definition
+ */
+typedef struct capture_writer_s
+{
+    int fd;                                         /**< output fd */
+    uint32_t chunks;                                /**< chunks written */
+    uint64_t written_ns;                            /**< last write order key */
+    capture_header_t header;                        /**< file header */
+    uint8_t used[CAPTURE_STREAM_MAX];               /**< 1 if the open chunk is in use */
+    capture_chunk_t open[CAPTURE_STREAM_MAX];       /**< open chunks */
+} capture_writer_t;
+
+/**
+ * @brief capture reader structure definition
+ */
+typedef struct capture_reader_s
+{
+    int fd;                                /**< input fd */
+    size_t size;                           /**< mapped size */
+    const uint8_t *base;                   /**< mapped file */
+    const capture_header_t *header;        /**< file header */
+    uint32_t chunks;                       /**< complete chunks in the file */
+} capture_reader_t;
+
+/**
+ * @brief capture query structure definition
+ */
+typedef struct capture_query_s
+{
+    uint8_t addr;                 /**< ads1115_address_t of the device */
+    uint8_t channel;              /**< ads1115_channel_t */
+    uint64_t t0_ns;               /**< window start */
+    uint64_t t1_ns;               /**< window end, inclusive */
+    uint32_t next;                /**< next chunk to visit */
+} capture_query_t;
+
+/**
+ * @brief     create a capture file
+ * @param[in] *writer points to a capture writer structure
+ * @param[in] *path is the output file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t capture_writer_open(capture_writer_t *writer, const char *path);
+
+/**
+ * @brief     append one sample
+ * @param[in] *writer points to a capture writer structure
+ * @param[in] *chunk points to a chunk header holding the addr, channel, range, rate and lsb_v of the sample
+ * @param[in] timestamp_ns is the sample time
+ * @param[in] seq is the conversion sequence number
+ * @param[in] raw is the raw sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ *            - 4 too many open streams
+ * @note      a full chunk is written at once, a sequence gap or a new range or rate starts a new chunk,
+ *            any open chunk older than CAPTURE_CHUNK_SPAN_NS is written so a slow stream keeps the
+ *            reader's search window short
+ */
+uint8_t capture_writer_append(capture_writer_t *writer, const capture_chunk_header_t *chunk,
+                              uint64_t timestamp_ns, uint32_t seq, int16_t raw);
+
+/**
+ * @brief     write the open chunks and close the file
+ * @param[in] *writer points to a capture writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t capture_writer_close(capture_writer_t *writer);
+
+/**
+ * @brief     map a capture file
+ * @param[in] *reader points to a capture reader structure
+ * @param[in] *path is the input file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      a torn chunk at the end of the file is ignored
+ */
+uint8_t capture_reader_open(capture_reader_t *reader, const char *path);
+
+/**
+ * @brief     unmap a capture file
+ * @param[in] *reader points to a capture reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      slices served before are invalid afterwards
+ */
+uint8_t capture_reader_close(capture_reader_t *reader);
+
+/**
+ * @brief      start a time window query
+ * @param[in]  *reader points to a capture reader structure
+ * @param[out] *query points to a capture query structure
+ * @param[in]  addr is the ads1115_address_t of the device
+ * @param[in]  channel is the ads1115_channel_t
+ * @param[in]  t0_ns is the window start
+ * @param[in]  t1_ns is the window end, inclusive
+ * @return     status code
+ *             - 0 success
+ *             - 1 query failed
+ * @note       binary search on the chunk write order, O(log n) chunk headers are touched,
+ *             the slices then scan the chunks written up to about CAPTURE_CHUNK_SPAN_NS after t1
+ */
+uint8_t capture_reader_query(capture_reader_t *reader, capture_query_t *query, uint8_t addr, uint8_t channel,
+                             uint64_t t0_ns, uint64_t t1_ns);
+
+/**
+ * @brief      get the next slice of a query
+ * @param[in]  *reader points to a capture reader structure
+ * @param[in]  *query points to a capture query structure
+ * @param[out] **chunk points to a chunk header pointer
+ * @param[out] **raw points to a sample pointer into the mapping
+ * @param[out] *n points to a sample number buffer
+ * @param[out] *index points to the index of the first slice sample in its chunk
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more slices
+ * @note       zero copy, use capture_sample_time for the time of a slice sample
+ */
+uint8_t capture_reader_next(capture_reader_t *reader, capture_query_t *query, const capture_chunk_header_t **chunk,
+                            const int16_t **raw, uint32_t *n, uint32_t *index);
+
+/**
+ * @brief     get the time of a chunk sample
+ * @param[in] *chunk points to a chunk header
+ * @param[in] index is the sample index in the chunk
+ * @return    sample time in ns
+ * @note      interpolated between the first and the last sample, a chunk never spans a sequence gap
+ */
+uint64_t capture_sample_time(const capture_chunk_header_t *chunk, uint32_t index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
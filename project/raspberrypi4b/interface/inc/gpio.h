@@ -23,13 +23,14 @@
  *
  * @file      gpio.h
  * @brief     gpio header file
- * @version   1.0.0
+ * @version   2.0.0
  * @author    Shifeng Li
- * @date      2022-11-11
+ * @date      2026-10-18
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.0      <td>Shifeng Li  <td>use a pollable fd instead of a pthread
  * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
  */
@@ -52,22 +53,84 @@
  */
 
 /**
- * @brief  gpio interrupt init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief gpio device line definition
  */
-uint8_t gpio_interrupt_init(void);
+#define GPIO_DEVICE_LINE 17        /**< default gpio device line */
 
 /**
- * @brief  gpio interrupt deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief gpio chip and line forward declaration
  */
-uint8_t gpio_interrupt_deinit(void);
+struct gpiod_chip;
+struct gpiod_line;
+
+/**
+ * @brief gpio interrupt structure definition
+ */
+typedef struct gpio_interrupt_s
+{
+    struct gpiod_chip *chip;        /**< gpio chip handle */
+    struct gpiod_line *line;        /**< gpio line handle */
+    int fd;                         /**< pollable event file descriptor */
+    uint32_t count;                 /**< falling edge counter */
+    uint64_t timestamp_ns;          /**< last falling edge timestamp */
+} gpio_interrupt_t;
+
+/**
+ * @brief     gpio interrupt init
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @param[in] line is the gpio line number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      no thread is created, the edges are queued by the kernel until read
+ */
+uint8_t gpio_interrupt_init(gpio_interrupt_t *gpio, uint32_t line);
+
+/**
+ * @brief     gpio interrupt deinit
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_interrupt_deinit(gpio_interrupt_t *gpio);
+
+/**
+ * @brief      get the pollable file descriptor
+ * @param[in]  *gpio points to a gpio interrupt structure
+ * @param[out] *fd points to a file descriptor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get fd failed
+ * @note       the fd becomes readable when an edge is pending and can be added to an epoll set
+ */
+uint8_t gpio_interrupt_get_fd(gpio_interrupt_t *gpio, int *fd);
+
+/**
+ * @brief         read the pending falling edges without blocking
+ * @param[in]     *gpio points to a gpio interrupt structure
+ * @param[out]    *timestamp_ns points to a timestamp buffer
+ * @param[in,out] *len points to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          len is the buffer capacity on input and the edge number on output,
+ *                the edges beyond the capacity are counted but their timestamps are dropped
+ */
+uint8_t gpio_interrupt_read(gpio_interrupt_t *gpio, uint64_t *timestamp_ns, uint16_t *len);
+
+/**
+ * @brief     wait for a falling edge
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @param[in] timeout_ms is the timeout in ms and -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 4 timeout
+ * @note      none
+ */
+uint8_t gpio_interrupt_wait(gpio_interrupt_t *gpio, int32_t timeout_ms);
 
 /**
  * @}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record.h
+ * @brief     record header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include "driver_ads1115_codec.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup record record function
+ * @brief    record function modules
+ * @{
+ */
+
+/**
+ * @brief record definition
+ */
+#define RECORD_MAGIC             "ADS1115R"        /**< file magic, 8 bytes */
+#define RECORD_VERSION           1                 /**< format version */
+#define RECORD_STREAM_MAX        8                 /**< streams described in the header */
+#define RECORD_BATCH             256               /**< samples buffered before a write */
+#define RECORD_FLAG_DUPLICATE    (1 << 0)          /**< the sample repeats the previous conversion */
+#define RECORD_HEADER_PACKED     (1 << 0)          /**< the body is a list of packed blocks */
+#define RECORD_PACK_SAMPLES      1024              /**< samples per packed block at most */
+
+/**
+ * @brief record stream structure definition
+ */
+typedef struct record_stream_s
+{
+    uint8_t addr;             /**< ads1115_address_t of the device */
+    uint8_t channel;          /**< ads1115_channel_t */
+    uint8_t range;            /**< ads1115_range_t */
+    uint8_t rate;             /**< ads1115_rate_t */
+    float lsb_v;              /**< volts per raw count */
+} record_stream_t;
+
+/**
+ * @brief record header structure definition
+ */
+typedef struct record_header_s
+{
+    char magic[8];                                   /**< RECORD_MAGIC */
+    uint16_t version;                                /**< RECORD_VERSION */
+    uint16_t header_size;                            /**< sizeof(record_header_t) */
+    uint16_t sample_size;                            /**< sizeof(record_sample_t) */
+    uint8_t stream_count;                            /**< valid stream entries */
+    uint8_t flags;                                   /**< RECORD_HEADER_* */
+    uint64_t start_realtime_ns;                      /**< wall clock at open */
+    uint64_t start_monotonic_ns;                     /**< monotonic clock at open */
+    record_stream_t stream[RECORD_STREAM_MAX];       /**< stream descriptions */
+} record_header_t;
+
+/**
+ * @brief record sample structure definition
+ */
+typedef struct record_sample_s
+{
+    uint64_t timestamp_ns;        /**< monotonic sample time */
+    uint32_t seq;                 /**< conversion sequence number */
+    int16_t raw;                  /**< raw sample */
+    uint8_t stream;               /**< index into the header streams */
+    uint8_t flags;                /**< RECORD_FLAG_* */
+} record_sample_t;
+
+/**
+ * @brief record packed block structure definition
+ */
+typedef struct record_block_s
+{
+    uint64_t first_ns;            /**< monotonic time of the first sample */
+    uint64_t last_ns;             /**< monotonic time of the last sample */
+    uint32_t first_seq;           /**< sequence number of the first sample, the others follow without a gap */
+    uint8_t stream;               /**< index into the header streams */
+    uint8_t reserved;             /**< zero */
+    uint16_t frame_size;          /**< bytes of the codec frame that follows */
+} record_block_t;
+
+/**
+ * @brief record structure definition
+ */
+typedef struct record_s
+{
+    int fd;                                                         /**< output fd */
+    uint8_t close_fd;                                               /**< 1 if the fd is owned */
+    uint8_t packed;                                                 /**< 1 if the body is packed */
+    uint32_t len;                                                   /**< buffered samples */
+    uint64_t samples;                                               /**< samples written */
+    record_sample_t buf[RECORD_BATCH];                              /**< sample buffer */
+    record_block_t block;                                           /**< packed block being filled */
+    uint32_t pack_len;                                              /**< samples in the packed block */
+    int16_t pack[RECORD_PACK_SAMPLES];                              /**< packed block samples */
+    uint8_t frame[ADS1115_CODEC_FRAME_MAX(RECORD_PACK_SAMPLES)];    /**< codec frame */
+} record_t;
+
+/**
+ * @brief     open a record and write its header
+ * @param[in] *record points to a record structure
+ * @param[in] *path is the output file, "-" for stdout
+ * @param[in] *stream points to a stream description buffer
+ * @param[in] count is the number of streams
+ * @param[in] flags is RECORD_HEADER_* or 0
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      host byte order
+ */
+uint8_t record_open(record_t *record, const char *path, const record_stream_t *stream, uint8_t count, uint8_t flags);
+
+/**
+ * @brief     append samples
+ * @param[in] *record points to a record structure
+ * @param[in] *samples points to a sample buffer
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      buffered, a full buffer and the new samples leave in one writev,
+ *            a packed record drops duplicates and starts a new block on a stream change or a sequence gap
+ */
+uint8_t record_write(record_t *record, const record_sample_t *samples, uint32_t n);
+
+/**
+ * @brief     write the buffered samples
+ * @param[in] *record points to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      a packed record ends its current block
+ */
+uint8_t record_flush(record_t *record);
+
+/**
+ * @brief     flush and close a record
+ * @param[in] *record points to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      stdout is flushed but not closed
+ */
+uint8_t record_close(record_t *record);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
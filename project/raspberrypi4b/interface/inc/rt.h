@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.h
+ * @brief     rt header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RT_H
+#define RT_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup rt rt function
+ * @brief    rt function modules
+ * @{
+ */
+
+/**
+ * @brief rt statistics definition
+ */
+#define RT_HISTOGRAM_BINS     32           /**< wake latency histogram bins */
+#define RT_HISTOGRAM_BIN_NS   10000        /**< wake latency histogram bin width */
+
+/**
+ * @brief rt config structure definition
+ */
+typedef struct rt_config_s
+{
+    int priority;                 /**< SCHED_FIFO priority, 0 means SCHED_OTHER */
+    int cpu;                      /**< pinned cpu, -1 means no pinning */
+    uint8_t lock_memory;          /**< mlockall before start */
+    uint32_t period_ns;           /**< pacing period */
+} rt_config_t;
+
+/**
+ * @brief rt statistics structure definition
+ */
+typedef struct rt_statistics_s
+{
+    uint64_t count;                               /**< cycle counter */
+    uint64_t overruns;                            /**< missed period counter */
+    uint64_t sum_ns;                              /**< wake latency sum */
+    uint64_t min_ns;                              /**< min wake latency */
+    uint64_t max_ns;                              /**< max wake latency */
+    uint32_t histogram[RT_HISTOGRAM_BINS];        /**< wake latency histogram, the last bin holds the rest */
+} rt_statistics_t;
+
+/**
+ * @brief rt runner structure definition
+ */
+typedef struct rt_s
+{
+    pthread_t thread;                                        /**< acquisition thread */
+    rt_config_t config;                                      /**< runner config */
+    uint8_t (*step)(void *arg, uint64_t timestamp_ns);       /**< point to a cycle function address */
+    void *arg;                                               /**< cycle argument */
+    volatile uint8_t stop;                                   /**< stop flag */
+    volatile uint8_t running;                                /**< running flag */
+    volatile uint32_t seq;                                   /**< statistics sequence */
+    rt_statistics_t statistics;                              /**< wake latency statistics */
+} rt_t;
+
+/**
+ * @brief     rt runner init
+ * @param[in] *rt points to an rt runner structure
+ * @param[in] *config points to an rt config structure
+ * @param[in] *step points to a cycle function address
+ * @param[in] *arg is the cycle argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      step runs once per period on the acquisition thread and stops the runner by returning non zero,
+ *            it must not allocate or block
+ */
+uint8_t rt_init(rt_t *rt, const rt_config_t *config, uint8_t (*step)(void *arg, uint64_t timestamp_ns), void *arg);
+
+/**
+ * @brief     rt runner start
+ * @param[in] *rt points to an rt runner structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      SCHED_FIFO and mlockall need CAP_SYS_NICE and CAP_IPC_LOCK or root
+ */
+uint8_t rt_start(rt_t *rt);
+
+/**
+ * @brief     rt runner stop
+ * @param[in] *rt points to an rt runner structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      waits for the acquisition thread to exit
+ */
+uint8_t rt_stop(rt_t *rt);
+
+/**
+ * @brief      wait until the step stops the runner
+ * @param[in]  *rt points to an rt runner structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 join failed
+ * @note       none
+ */
+uint8_t rt_join(rt_t *rt);
+
+/**
+ * @brief      get a consistent copy of the statistics
+ * @param[in]  *rt points to an rt runner structure
+ * @param[out] *statistics points to an rt statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       never blocks the acquisition thread
+ */
+uint8_t rt_get_statistics(rt_t *rt, rt_statistics_t *statistics);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
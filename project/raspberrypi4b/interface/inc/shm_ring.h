@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm_ring.h
+ * @brief     shm ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup shm_ring shm_ring function
+ * @brief    shm_ring function modules
+ * @{
+ */
+
+/**
+ * @brief shm ring definition
+ */
+#define SHM_RING_MAGIC            0x41445331U        /**< "ADS1" */
+#define SHM_RING_VERSION          1                  /**< layout version */
+#define SHM_RING_NAME_MAX         64                 /**< object name length */
+
+/**
+ * @brief shm ring sample structure definition
+ */
+typedef struct shm_ring_sample_s
+{
+    uint64_t timestamp_ns;        /**< monotonic sample time */
+    uint32_t seq;                 /**< conversion sequence number */
+    int16_t raw;                  /**< raw sample */
+    uint8_t channel;              /**< ads1115_channel_t of the sample */
+    uint8_t addr;                 /**< ads1115_address_t of the device */
+    float v;                      /**< converted sample */
+    uint32_t reserved;            /**< keep 8 byte alignment */
+} shm_ring_sample_t;
+
+/**
+ * @brief shm ring header structure definition
+ */
+typedef struct shm_ring_header_s
+{
+    uint32_t magic;                   /**< SHM_RING_MAGIC once the ring is ready */
+    uint32_t version;                 /**< SHM_RING_VERSION */
+    uint32_t capacity;                /**< slots, a power of two */
+    uint32_t sample_size;             /**< sizeof(shm_ring_sample_t) */
+    uint8_t pad0[48];                 /**< keep head on its own cache line */
+    uint64_t head;                    /**< samples published since creation */
+    uint8_t pad1[56];                 /**< cache line padding */
+} shm_ring_header_t;
+
+/**
+ * @brief shm ring structure definition
+ */
+typedef struct shm_ring_s
+{
+    char name[SHM_RING_NAME_MAX];             /**< shared memory object name */
+    int fd;                                   /**< shared memory fd */
+    size_t size;                              /**< mapped size */
+    shm_ring_header_t *header;                /**< mapped header */
+    shm_ring_sample_t *samples;               /**< mapped slots */
+    uint64_t mask;                            /**< capacity - 1 */
+    uint64_t cursor;                          /**< reader position */
+    uint64_t lost;                            /**< samples the reader fell behind on */
+    uint8_t writer;                           /**< 1 for the publisher */
+} shm_ring_t;
+
+/**
+ * @brief     create the ring as the publisher
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *name is the shared memory object name such as "/ads1115"
+ * @param[in] capacity is the number of slots, a power of two
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the object appears in /dev/shm
+ */
+uint8_t shm_ring_publisher_init(shm_ring_t *ring, const char *name, uint32_t capacity);
+
+/**
+ * @brief     publish samples
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *samples points to a sample buffer
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      never waits for readers, slow readers lose the oldest samples
+ */
+uint8_t shm_ring_publish(shm_ring_t *ring, const shm_ring_sample_t *samples, uint32_t n);
+
+/**
+ * @brief     remove the ring as the publisher
+ * @param[in] *ring points to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      mapped readers keep their mapping until they deinit
+ */
+uint8_t shm_ring_publisher_deinit(shm_ring_t *ring);
+
+/**
+ * @brief     open the ring as a reader
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *name is the shared memory object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      read only mapping, the cursor starts at the newest sample
+ */
+uint8_t shm_ring_reader_init(shm_ring_t *ring, const char *name);
+
+/**
+ * @brief      get the next batch in place
+ * @param[in]  *ring points to a shm ring structure
+ * @param[out] **samples points to a sample pointer
+ * @param[out] *n points to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 peek failed
+ * @note       no syscall and no copy, the batch stops at the end of the ring
+ */
+uint8_t shm_ring_reader_peek(shm_ring_t *ring, const shm_ring_sample_t **samples, uint32_t *n);
+
+/**
+ * @brief     finish a batch
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] n is the number of samples consumed
+ * @return    status code
+ *            - 0 success
+ *            - 1 release failed
+ *            - 2 the batch was overwritten while it was read
+ * @note      discard the batch results when 2 is returned
+ */
+uint8_t shm_ring_reader_release(shm_ring_t *ring, uint32_t n);
+
+/**
+ * @brief     close the ring as a reader
+ * @param[in] *ring points to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t shm_ring_reader_deinit(shm_ring_t *ring);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
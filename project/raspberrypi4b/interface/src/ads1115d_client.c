@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ads1115d_client.c
+ * @brief     ads1115d client source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "ads1115d_client.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static uint32_t gs_id = 0x80000000U;        /**< ids of the blocking calls */
+
+/**
+ * @brief      send a request and wait for its response
+ * @param[in]  fd is the socket fd
+ * @param[in]  *request points to a request structure
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 call failed
+ * @note       none
+ */
+static uint8_t a_ads1115d_client_call(int fd, ads1115d_request_t *request, ads1115d_response_t *response)
+{
+    request->id = __atomic_fetch_add(&gs_id, 1, __ATOMIC_RELAXED);
+    if (ads1115d_client_send(fd, request) != 0)
+    {
+        return 1;
+    }
+    do
+    {
+        if (ads1115d_client_receive(fd, response) != 0)
+        {
+            return 1;
+        }
+    } while ((response->op != request->op) || (response->id != request->id));
+    
+    return (response->status == 0) ? 0 : 1;
+}
+
+/**
+ * @brief      connect to the daemon
+ * @param[in]  *path is the socket path, NULL for the default
+ * @param[out] *fd points to a socket fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 connect failed
+ * @note       one message per packet, host byte order
+ */
+uint8_t ads1115d_client_connect(const char *path, int *fd)
+{
+    struct sockaddr_un addr;
+    
+    if (fd == NULL)
+    {
+        return 1;
+    }
+    memset(&addr, 0, sizeof(struct sockaddr_un));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, (path != NULL) ? path : ADS1115D_DEFAULT_SOCKET, sizeof(addr.sun_path) - 1);
+    
+    *fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (*fd < 0)
+    {
+        perror("ads1115d_client: socket failed.\n");
+        
+        return 1;
+    }
+    if (connect(*fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        perror("ads1115d_client: connect failed.\n");
+        (void)close(*fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close the connection
+ * @param[in] fd is the socket fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the daemon drops the subscriptions of the connection
+ */
+uint8_t ads1115d_client_close(int fd)
+{
+    if (close(fd) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     send a request
+ * @param[in] fd is the socket fd
+ * @param[in] *request points to a request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ * @note      none
+ */
+uint8_t ads1115d_client_send(int fd, const ads1115d_request_t *request)
+{
+    if (request == NULL)
+    {
+        return 1;
+    }
+    if (send(fd, request, sizeof(ads1115d_request_t), MSG_NOSIGNAL) != (ssize_t)sizeof(ads1115d_request_t))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      receive a response or a sample event
+ * @param[in]  fd is the socket fd
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 receive failed
+ * @note       blocks until a message arrives
+ */
+uint8_t ads1115d_client_receive(int fd, ads1115d_response_t *response)
+{
+    ssize_t n;
+    
+    if (response == NULL)
+    {
+        return 1;
+    }
+    do
+    {
+        n = recv(fd, response, sizeof(ads1115d_response_t), 0);
+    } while ((n < 0) && (errno == EINTR));
+    if (n != (ssize_t)sizeof(ads1115d_response_t))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read one sample
+ * @param[in]  fd is the socket fd
+ * @param[in]  device is the ads1115_address_t of the device
+ * @param[in]  channel is the ads1115_channel_t
+ * @param[in]  max_age_ms is the accepted sample age
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sample events arriving before the response are dropped
+ */
+uint8_t ads1115d_client_read(int fd, uint8_t device, uint8_t channel, uint32_t max_age_ms,
+                             ads1115d_response_t *response)
+{
+    ads1115d_request_t request;
+    
+    memset(&request, 0, sizeof(ads1115d_request_t));
+    request.op = ADS1115D_OP_READ;
+    request.device = device;
+    request.channel = channel;
+    request.arg = max_age_ms;
+    
+    return a_ads1115d_client_call(fd, &request, response);
+}
+
+/**
+ * @brief     subscribe to a channel
+ * @param[in] fd is the socket fd
+ * @param[in] device is the ads1115_address_t of the device
+ * @param[in] channel is the ads1115_channel_t
+ * @param[in] period_ms is the event period
+ * @param[in] id is the subscription id carried by its events
+ * @return    status code
+ *            - 0 success
+ *            - 1 subscribe failed
+ * @note      the acknowledgement and the events arrive through ads1115d_client_receive
+ */
+uint8_t ads1115d_client_subscribe(int fd, uint8_t device, uint8_t channel, uint32_t period_ms, uint32_t id)
+{
+    ads1115d_request_t request;
+    
+    memset(&request, 0, sizeof(ads1115d_request_t));
+    request.op = ADS1115D_OP_SUBSCRIBE;
+    request.device = device;
+    request.channel = channel;
+    request.id = id;
+    request.arg = period_ms;
+    
+    return ads1115d_client_send(fd, &request);
+}
+
+/**
+ * @brief     unsubscribe
+ * @param[in] fd is the socket fd
+ * @param[in] id is the subscription id
+ * @return    status code
+ *            - 0 success
+ *            - 1 unsubscribe failed
+ * @note      none
+ */
+uint8_t ads1115d_client_unsubscribe(int fd, uint32_t id)
+{
+    ads1115d_request_t request;
+    
+    memset(&request, 0, sizeof(ads1115d_request_t));
+    request.op = ADS1115D_OP_UNSUBSCRIBE;
+    request.id = id;
+    
+    return ads1115d_client_send(fd, &request);
+}
+
+/**
+ * @brief      set the range and rate of a device
+ * @param[in]  fd is the socket fd
+ * @param[in]  device is the ads1115_address_t of the device
+ * @param[in]  range is the ads1115_range_t or ADS1115D_KEEP
+ * @param[in]  rate is the ads1115_rate_t or ADS1115D_KEEP
+ * @param[out] *response points to a response structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config failed
+ * @note       applied once the conversions in flight on the device are done
+ */
+uint8_t ads1115d_client_config(int fd, uint8_t device, uint8_t range, uint8_t rate, ads1115d_response_t *response)
+{
+    ads1115d_request_t request;
+    
+    memset(&request, 0, sizeof(ads1115d_request_t));
+    request.op = ADS1115D_OP_CONFIG;
+    request.device = device;
+    request.range = range;
+    request.rate = rate;
+    
+    return a_ads1115d_client_call(fd, &request, response);
+}
@@ -0,0 +1,518 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      async.c
+ * @brief     async source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "async.h"
+#include "driver_ads1115_interface.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief     executor continuation of a request
+ * @param[in] *op points to the operation of a request
+ * @note      runs on the worker without the engine mutex
+ */
+static void a_async_resume(ads1115_op_t *op)
+{
+    async_request_t *request = (async_request_t *)op->arg;
+    
+    request->timestamp_us = ads1115_interface_timestamp_us();
+    if (request->callback != NULL)
+    {
+        request->callback(request);
+    }
+}
+
+/**
+ * @brief     executor config function of a config request
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *arg points to an async request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 config failed
+ * @note      none
+ */
+static uint8_t a_async_config(ads1115_handle_t *handle, void *arg)
+{
+    async_request_t *request = (async_request_t *)arg;
+    
+    return request->config(handle, request->arg);
+}
+
+/**
+ * @brief     cancel the operations of a list
+ * @param[in] *op points to the list head
+ * @note      none
+ */
+static void a_async_cancel(ads1115_op_t *op)
+{
+    ads1115_op_t *next;
+    
+    for (; op != NULL; op = next)
+    {
+        next = op->next;
+        op->next = NULL;
+        op->state = ADS1115_OP_STATE_IDLE;
+        op->status = 1;
+        a_async_resume(op);
+    }
+}
+
+/**
+ * @brief     hand submitted requests to the executor of a bus
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to the detached request list
+ * @note      runs on the worker without the engine mutex
+ */
+static void a_async_queue(async_bus_t *bus, async_request_t *request)
+{
+    uint8_t res;
+    async_request_t *next;
+    
+    for (; request != NULL; request = next)
+    {
+        next = request->next;
+        request->next = NULL;
+        if (request->type == ASYNC_REQUEST_CONFIG)
+        {
+            res = ads1115_executor_submit_config(&bus->executor, &request->op, request->op.handle,
+                                                 a_async_config, a_async_resume, request);
+        }
+        else
+        {
+            res = ads1115_executor_submit(&bus->executor, &request->op, request->op.handle,
+                                          request->op.channel, a_async_resume, request);
+        }
+        if (res != 0)
+        {
+            request->op.status = 1;
+            a_async_resume(&request->op);
+        }
+    }
+}
+
+/**
+ * @brief     async worker pthread
+ * @param[in] *p points to an async engine structure
+ * @return    NULL
+ * @note      the mutex only guards the bus inboxes, so submit and notify never wait on bus io or callbacks,
+ *            the buses are served one after another, so the transactions of one bus never overlap
+ */
+static void *a_async_worker(void *p)
+{
+    async_t *engine = (async_t *)p;
+    async_bus_t *bus;
+    async_request_t *list;
+    async_request_t *request;
+    ads1115_handle_t *notify[ASYNC_NOTIFY_MAX];
+    uint8_t notify_len;
+    uint8_t pending;
+    uint8_t i;
+    uint64_t next_us;
+    uint64_t wait_us;
+    struct timespec ts;
+    
+    pthread_mutex_lock(&engine->mutex);
+    while (engine->stop == 0)
+    {
+        wait_us = UINT64_MAX;
+        for (bus = engine->bus; (bus != NULL) && (engine->stop == 0); bus = bus->next)
+        {
+            /* take the inbox of the bus */
+            list = bus->head;
+            bus->head = NULL;
+            bus->tail = NULL;
+            for (request = list; request != NULL; request = request->next)
+            {
+                request->bus = NULL;
+            }
+            notify_len = bus->notify_len;
+            memcpy(notify, bus->notify, sizeof(ads1115_handle_t *) * notify_len);
+            bus->notify_len = 0;
+            pthread_mutex_unlock(&engine->mutex);
+            
+            /* start idle devices and read the ready conversions without the mutex */
+            a_async_queue(bus, list);
+            for (i = 0; i < notify_len; i++)
+            {
+                (void)ads1115_executor_notify(&bus->executor, notify[i]);
+            }
+            (void)ads1115_executor_run(&bus->executor, &next_us);
+            
+            pthread_mutex_lock(&engine->mutex);
+            if (next_us < wait_us)
+            {
+                wait_us = next_us;
+            }
+        }
+        if (engine->stop != 0)
+        {
+            break;
+        }
+        
+        /* serve again at once when requests or edges came in meanwhile */
+        pending = 0;
+        for (bus = engine->bus; bus != NULL; bus = bus->next)
+        {
+            if ((bus->head != NULL) || (bus->notify_len != 0))
+            {
+                pending = 1;
+            }
+        }
+        if (pending != 0)
+        {
+            continue;
+        }
+        
+        /* sleep until the next conversion or a new request */
+        if (wait_us == UINT64_MAX)
+        {
+            pthread_cond_wait(&engine->cond, &engine->mutex);
+        }
+        else if (wait_us > ads1115_interface_timestamp_us())
+        {
+            ts.tv_sec = (time_t)(wait_us / 1000000ULL);
+            ts.tv_nsec = (long)((wait_us % 1000000ULL) * 1000ULL);
+            (void)pthread_cond_timedwait(&engine->cond, &engine->mutex, &ts);
+        }
+        else
+        {
+            /* run again now */
+        }
+    }
+    pthread_mutex_unlock(&engine->mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief     queue a request on the inbox of a bus
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to an async request structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      the request fields are set by the caller
+ */
+static uint8_t a_async_submit(async_bus_t *bus, async_request_t *request)
+{
+    async_t *engine = bus->engine;
+    
+    pthread_mutex_lock(&engine->mutex);
+    if ((engine->stop != 0) || (request->bus != NULL))
+    {
+        pthread_mutex_unlock(&engine->mutex);
+        
+        return 1;
+    }
+    request->bus = bus;
+    request->next = NULL;
+    if (bus->tail == NULL)
+    {
+        bus->head = request;
+    }
+    else
+    {
+        bus->tail->next = request;
+    }
+    bus->tail = request;
+    pthread_cond_signal(&engine->cond);
+    pthread_mutex_unlock(&engine->mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief     async engine init
+ * @param[in] *engine points to an async engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      one worker thread serves every bus added to the engine
+ */
+uint8_t async_init(async_t *engine)
+{
+    pthread_condattr_t attr;
+    
+    if (engine == NULL)
+    {
+        return 1;
+    }
+    memset(engine, 0, sizeof(async_t));
+    
+    /* wait on the monotonic clock of the interface timestamp */
+    if (pthread_condattr_init(&attr) != 0)
+    {
+        perror("async: init cond attr failed.\n");
+        
+        return 1;
+    }
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    if (pthread_cond_init(&engine->cond, &attr) != 0)
+    {
+        perror("async: init cond failed.\n");
+        (void)pthread_condattr_destroy(&attr);
+        
+        return 1;
+    }
+    (void)pthread_condattr_destroy(&attr);
+    if (pthread_mutex_init(&engine->mutex, NULL) != 0)
+    {
+        perror("async: init mutex failed.\n");
+        (void)pthread_cond_destroy(&engine->cond);
+        
+        return 1;
+    }
+    
+    /* creat the worker pthread */
+    if (pthread_create(&engine->thread, NULL, a_async_worker, engine) != 0)
+    {
+        perror("async: creat pthread failed.\n");
+        (void)pthread_mutex_destroy(&engine->mutex);
+        (void)pthread_cond_destroy(&engine->cond);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     async engine deinit
+ * @param[in] *engine points to an async engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      requests not yet finished complete with status 1
+ */
+uint8_t async_deinit(async_t *engine)
+{
+    async_bus_t *bus;
+    async_request_t *list;
+    async_request_t *request;
+    ads1115_op_t *running;
+    ads1115_op_t *queued;
+    
+    if (engine == NULL)
+    {
+        return 1;
+    }
+    
+    /* stop the worker */
+    pthread_mutex_lock(&engine->mutex);
+    engine->stop = 1;
+    pthread_cond_signal(&engine->cond);
+    pthread_mutex_unlock(&engine->mutex);
+    if (pthread_join(engine->thread, NULL) != 0)
+    {
+        perror("async: join pthread failed.\n");
+        
+        return 1;
+    }
+    
+    /* cancel the unfinished requests of every bus */
+    for (bus = engine->bus; bus != NULL; bus = bus->next)
+    {
+        running = bus->executor.running;
+        queued = bus->executor.queued;
+        list = bus->head;
+        bus->executor.running = NULL;
+        bus->executor.queued = NULL;
+        bus->executor.queued_tail = NULL;
+        bus->head = NULL;
+        bus->tail = NULL;
+        bus->notify_len = 0;
+        a_async_cancel(running);
+        a_async_cancel(queued);
+        for (request = list; request != NULL; request = list)
+        {
+            list = request->next;
+            request->next = NULL;
+            request->bus = NULL;
+            request->op.status = 1;
+            a_async_resume(&request->op);
+        }
+    }
+    (void)pthread_mutex_destroy(&engine->mutex);
+    (void)pthread_cond_destroy(&engine->cond);
+    
+    return 0;
+}
+
+/**
+ * @brief     add an iic bus to the engine
+ * @param[in] *engine points to an async engine structure
+ * @param[in] *bus points to an async bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      each bus has its own executor, the bus must stay valid until async_deinit
+ */
+uint8_t async_add_bus(async_t *engine, async_bus_t *bus)
+{
+    if ((engine == NULL) || (bus == NULL))
+    {
+        return 1;
+    }
+    
+    memset(bus, 0, sizeof(async_bus_t));
+    (void)ads1115_executor_init(&bus->executor, ads1115_interface_timestamp_us);
+    bus->engine = engine;
+    pthread_mutex_lock(&engine->mutex);
+    if (engine->stop != 0)
+    {
+        pthread_mutex_unlock(&engine->mutex);
+        
+        return 1;
+    }
+    bus->next = engine->bus;
+    engine->bus = bus;
+    pthread_mutex_unlock(&engine->mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief     submit a read request
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to an async request structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] *callback points to a completion callback
+ * @param[in] *arg is the user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      the request must stay valid until its callback runs,
+ *            a callback may submit again, the handle must be on the bus
+ */
+uint8_t async_submit(async_bus_t *bus, async_request_t *request, ads1115_handle_t *handle,
+                     ads1115_channel_t channel, void (*callback)(async_request_t *request), void *arg)
+{
+    if ((bus == NULL) || (bus->engine == NULL) || (request == NULL) || (handle == NULL))
+    {
+        return 1;
+    }
+    
+    request->type = ASYNC_REQUEST_READ;
+    request->config = NULL;
+    request->callback = callback;
+    request->arg = arg;
+    request->op.handle = handle;
+    request->op.channel = channel;
+    
+    return a_async_submit(bus, request);
+}
+
+/**
+ * @brief     submit a config request
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *request points to an async request structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *config points to a config function called on the worker with the handle and arg
+ * @param[in] *callback points to a completion callback
+ * @param[in] *arg is the user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      config runs once the conversion in flight on the device finishes,
+ *            so it keeps its order with the reads of the device, a config error completes with status 1
+ */
+uint8_t async_submit_config(async_bus_t *bus, async_request_t *request, ads1115_handle_t *handle,
+                            uint8_t (*config)(ads1115_handle_t *handle, void *arg),
+                            void (*callback)(async_request_t *request), void *arg)
+{
+    if ((bus == NULL) || (bus->engine == NULL) || (request == NULL) || (handle == NULL) || (config == NULL))
+    {
+        return 1;
+    }
+    
+    request->type = ASYNC_REQUEST_CONFIG;
+    request->config = config;
+    request->callback = callback;
+    request->arg = arg;
+    request->op.handle = handle;
+    
+    return a_async_submit(bus, request);
+}
+
+/**
+ * @brief     wake the conversion of a device on its conversion ready edge
+ * @param[in] *bus points to an async bus structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 notify failed
+ * @note      call from the ready pin handler, without it the worker waits the conversion period,
+ *            the edge is handed to the worker, so an edge without a conversion in flight is dropped there,
+ *            it fails when ASYNC_NOTIFY_MAX edges are already pending
+ */
+uint8_t async_notify(async_bus_t *bus, ads1115_handle_t *handle)
+{
+    uint8_t i;
+    uint8_t res = 0;
+    async_t *engine;
+    
+    if ((bus == NULL) || (bus->engine == NULL) || (handle == NULL))
+    {
+        return 1;
+    }
+    
+    engine = bus->engine;
+    pthread_mutex_lock(&engine->mutex);
+    for (i = 0; i < bus->notify_len; i++)
+    {
+        if (bus->notify[i] == handle)
+        {
+            break;
+        }
+    }
+    if (i == bus->notify_len)
+    {
+        if (bus->notify_len < ASYNC_NOTIFY_MAX)
+        {
+            bus->notify[bus->notify_len++] = handle;
+            pthread_cond_signal(&engine->cond);
+        }
+        else
+        {
+            res = 1;
+        }
+    }
+    pthread_mutex_unlock(&engine->mutex);
+    
+    return res;
+}
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      cache.c
+ * @brief     cache source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "cache.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_cache_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      copy a channel without a lock
+ * @param[in]  *cache points to a cache structure
+ * @param[in]  channel is the sample channel
+ * @param[out] *entry points to a cache entry buffer
+ * @return     1 if the channel was published else 0
+ * @note       retries while a writer is inside the channel, a cleared channel has a zero timestamp
+ */
+static uint8_t a_cache_load(cache_t *cache, uint8_t channel, cache_entry_t *entry)
+{
+    uint32_t begin;
+    uint32_t end;
+    
+    do
+    {
+        begin = __atomic_load_n(&cache->seq[channel], __ATOMIC_ACQUIRE);
+        memcpy(entry, &cache->entry[channel], sizeof(cache_entry_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&cache->seq[channel], __ATOMIC_RELAXED);
+    } while (((begin & 1) != 0) || (begin != end));
+    
+    return ((begin != 0) && (entry->timestamp_ns != 0)) ? 1 : 0;
+}
+
+/**
+ * @brief     publish a channel
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the sample channel
+ * @param[in] *entry points to a cache entry
+ * @note      writers enter the channel by moving its sequence from even to odd
+ */
+static void a_cache_store(cache_t *cache, uint8_t channel, const cache_entry_t *entry)
+{
+    uint32_t seq;
+    
+    do
+    {
+        seq = __atomic_load_n(&cache->seq[channel], __ATOMIC_RELAXED) & ~1U;
+    } while (!__atomic_compare_exchange_n(&cache->seq[channel], &seq, seq + 1, 0,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&cache->entry[channel], entry, sizeof(cache_entry_t));
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_fetch_add(&cache->seq[channel], 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief     convert a channel, the mutex must be held
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the channel to convert
+ * @return    status code
+ *            - 0 success
+ *            - 1 convert failed
+ * @note      none
+ */
+static uint8_t a_cache_convert(cache_t *cache, ads1115_channel_t channel)
+{
+    cache_entry_t entry;
+    
+    if (ads1115_set_channel(cache->handle, channel) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_single_read(cache->handle, &entry.raw, &entry.v) != 0)
+    {
+        return 1;
+    }
+    entry.timestamp_ns = a_cache_now_ns();
+    a_cache_store(cache, (uint8_t)channel, &entry);
+    __atomic_fetch_add(&cache->refreshes, 1, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+/**
+ * @brief     init the cache
+ * @param[in] *cache points to a cache structure
+ * @param[in] *handle points to an initialized ads1115 handle in single shot mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t cache_init(cache_t *cache, ads1115_handle_t *handle)
+{
+    if ((cache == NULL) || (handle == NULL))
+    {
+        return 1;
+    }
+    memset(cache, 0, sizeof(cache_t));
+    cache->handle = handle;
+    if (pthread_mutex_init(&cache->mutex, NULL) != 0)
+    {
+        perror("cache: init mutex failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     deinit the cache
+ * @param[in] *cache points to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t cache_deinit(cache_t *cache)
+{
+    if (cache == NULL)
+    {
+        return 1;
+    }
+    if (pthread_mutex_destroy(&cache->mutex) != 0)
+    {
+        perror("cache: destroy mutex failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     publish a sample
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the sample channel
+ * @param[in] raw is the raw sample
+ * @param[in] v is the converted sample
+ * @param[in] timestamp_ns is the monotonic sample time
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      for samples the acquisition thread read itself
+ */
+uint8_t cache_publish(cache_t *cache, ads1115_channel_t channel, int16_t raw, float v, uint64_t timestamp_ns)
+{
+    cache_entry_t entry;
+    
+    if ((cache == NULL) || ((uint32_t)channel >= CACHE_CHANNEL_MAX))
+    {
+        return 1;
+    }
+    entry.raw = raw;
+    entry.v = v;
+    entry.timestamp_ns = timestamp_ns;
+    a_cache_store(cache, (uint8_t)channel, &entry);
+    
+    return 0;
+}
+
+/**
+ * @brief     drop every cached sample
+ * @param[in] *cache points to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      call after the range or rate changed, the channels read as never published
+ */
+uint8_t cache_clear(cache_t *cache)
+{
+    uint8_t channel;
+    cache_entry_t entry;
+    
+    if (cache == NULL)
+    {
+        return 1;
+    }
+    memset(&entry, 0, sizeof(cache_entry_t));
+    for (channel = 0; channel < CACHE_CHANNEL_MAX; channel++)
+    {
+        a_cache_store(cache, channel, &entry);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     convert a channel and publish the sample
+ * @param[in] *cache points to a cache structure
+ * @param[in] channel is the channel to convert
+ * @return    status code
+ *            - 0 success
+ *            - 1 refresh failed
+ * @note      one single shot conversion with the cache mutex held
+ */
+uint8_t cache_refresh(cache_t *cache, ads1115_channel_t channel)
+{
+    uint8_t res;
+    
+    if ((cache == NULL) || ((uint32_t)channel >= CACHE_CHANNEL_MAX))
+    {
+        return 1;
+    }
+    
+    (void)pthread_mutex_lock(&cache->mutex);
+    res = a_cache_convert(cache, channel);
+    (void)pthread_mutex_unlock(&cache->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief      get the latest sample
+ * @param[in]  *cache points to a cache structure
+ * @param[in]  channel is the sample channel
+ * @param[out] *entry points to a cache entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ *             - 2 nothing published yet
+ * @note       never blocks and never touches the bus
+ */
+uint8_t cache_get(cache_t *cache, ads1115_channel_t channel, cache_entry_t *entry)
+{
+    if ((cache == NULL) || (entry == NULL) || ((uint32_t)channel >= CACHE_CHANNEL_MAX))
+    {
+        return 1;
+    }
+    if (a_cache_load(cache, (uint8_t)channel, entry) == 0)
+    {
+        return 2;
+    }
+    __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+/**
+ * @brief      get a sample no older than a bound
+ * @param[in]  *cache points to a cache structure
+ * @param[in]  channel is the sample channel
+ * @param[in]  max_age_ms is the staleness bound
+ * @param[out] *entry points to a cache entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       converts only when the cached sample is too old, concurrent callers share one conversion
+ */
+uint8_t cache_get_fresh(cache_t *cache, ads1115_channel_t channel, uint32_t max_age_ms, cache_entry_t *entry)
+{
+    uint8_t res;
+    uint64_t max_age_ns;
+    uint64_t request_ns;
+    
+    if ((cache == NULL) || (entry == NULL) || ((uint32_t)channel >= CACHE_CHANNEL_MAX))
+    {
+        return 1;
+    }
+    
+    /* fast path without the lock */
+    max_age_ns = (uint64_t)max_age_ms * 1000000ULL;
+    request_ns = a_cache_now_ns();
+    if ((a_cache_load(cache, (uint8_t)channel, entry) != 0) &&
+        (request_ns - entry->timestamp_ns <= max_age_ns))
+    {
+        __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+        
+        return 0;
+    }
+    
+    /* callers queued behind a conversion take its sample */
+    (void)pthread_mutex_lock(&cache->mutex);
+    if ((a_cache_load(cache, (uint8_t)channel, entry) != 0) &&
+        (entry->timestamp_ns >= request_ns))
+    {
+        (void)pthread_mutex_unlock(&cache->mutex);
+        __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+        
+        return 0;
+    }
+    res = a_cache_convert(cache, channel);
+    (void)pthread_mutex_unlock(&cache->mutex);
+    if (res != 0)
+    {
+        return 1;
+    }
+    (void)a_cache_load(cache, (uint8_t)channel, entry);
+    
+    return 0;
+}
+
+/**
+ * @brief      get the cache statistics
+ * @param[in]  *cache points to a cache structure
+ * @param[out] *hits points to a hit counter buffer
+ * @param[out] *refreshes points to a refresh counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t cache_get_statistics(cache_t *cache, uint64_t *hits, uint64_t *refreshes)
+{
+    if ((cache == NULL) || (hits == NULL) || (refreshes == NULL))
+    {
+        return 1;
+    }
+    *hits = __atomic_load_n(&cache->hits, __ATOMIC_RELAXED);
+    *refreshes = __atomic_load_n(&cache->refreshes, __ATOMIC_RELAXED);
+    
+    return 0;
+}
@@ -0,0 +1,612 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      capture.c
+ * @brief     capture source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "capture.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief     write a buffer at an offset
+ * @param[in] fd is the output fd
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the data length
+ * @param[in] offset is the file offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_capture_pwrite(int fd, const void *buf, size_t len, off_t offset)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+    ssize_t n;
+    
+    while (len > 0)
+    {
+        n = pwrite(fd, p, len, offset);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("capture: write failed.\n");
+            
+            return 1;
+        }
+        p += n;
+        len -= (size_t)n;
+        offset += n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write an open chunk to the end of the file
+ * @param[in] *writer points to a capture writer structure
+ * @param[in] slot is the open chunk index
+ * @param[in] now_ns is the time the chunk is closed
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      written_ns never decreases, so the file stays sorted by it
+ */
+static uint8_t a_capture_write_chunk(capture_writer_t *writer, uint8_t slot, uint64_t now_ns)
+{
+    capture_chunk_t *chunk = &writer->open[slot];
+    uint64_t span;
+    off_t offset;
+    
+    if (now_ns < chunk->header.last_ns)
+    {
+        now_ns = chunk->header.last_ns;
+    }
+    if (now_ns < writer->written_ns)
+    {
+        now_ns = writer->written_ns;
+    }
+    chunk->header.written_ns = now_ns;
+    writer->written_ns = now_ns;
+    if (chunk->header.count < CAPTURE_CHUNK_SAMPLES)
+    {
+        memset(&chunk->raw[chunk->header.count], 0, sizeof(int16_t) * (CAPTURE_CHUNK_SAMPLES - chunk->header.count));
+    }
+    offset = (off_t)sizeof(capture_header_t) + (off_t)writer->chunks * (off_t)sizeof(capture_chunk_t);
+    if (a_capture_pwrite(writer->fd, chunk, sizeof(capture_chunk_t), offset) != 0)
+    {
+        return 1;
+    }
+    writer->chunks++;
+    writer->used[slot] = 0;
+    
+    /* a wider chunk widens the reader's search window */
+    span = now_ns - chunk->header.first_ns;
+    if (span > writer->header.max_span_ns)
+    {
+        writer->header.max_span_ns = span;
+        if (a_capture_pwrite(writer->fd, &writer->header, sizeof(capture_header_t), 0) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     create a capture file
+ * @param[in] *writer points to a capture writer structure
+ * @param[in] *path is the output file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t capture_writer_open(capture_writer_t *writer, const char *path)
+{
+    struct timespec ts;
+    
+    if ((writer == NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    memset(writer, 0, sizeof(capture_writer_t));
+    writer->fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (writer->fd < 0)
+    {
+        perror("capture: open failed.\n");
+        
+        return 1;
+    }
+    memcpy(writer->header.magic, CAPTURE_MAGIC, 8);
+    writer->header.version = CAPTURE_VERSION;
+    writer->header.header_size = sizeof(capture_header_t);
+    writer->header.chunk_size = sizeof(capture_chunk_t);
+    writer->header.chunk_samples = CAPTURE_CHUNK_SAMPLES;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    writer->header.start_realtime_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    if (a_capture_pwrite(writer->fd, &writer->header, sizeof(capture_header_t), 0) != 0)
+    {
+        (void)close(writer->fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     append one sample
+ * @param[in] *writer points to a capture writer structure
+ * @param[in] *chunk points to a chunk header holding the addr, channel, range, rate and lsb_v of the sample
+ * @param[in] timestamp_ns is the sample time
+ * @param[in] seq is the conversion sequence number
+ * @param[in] raw is the raw sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ *            - 4 too many open streams
+ * @note      a full chunk is written at once, a sequence gap or a new range or rate starts a new chunk,
+ *            any open chunk older than CAPTURE_CHUNK_SPAN_NS is written so a slow stream keeps the
+ *            reader's search window short
+ */
+uint8_t capture_writer_append(capture_writer_t *writer, const capture_chunk_header_t *chunk,
+                              uint64_t timestamp_ns, uint32_t seq, int16_t raw)
+{
+    capture_chunk_header_t *h;
+    uint8_t slot;
+    uint8_t i;
+    
+    if ((writer == NULL) || (chunk == NULL))
+    {
+        return 1;
+    }
+    
+    /* close the chunks that span too long, a slow stream would widen every query */
+    for (i = 0; i < CAPTURE_STREAM_MAX; i++)
+    {
+        if ((writer->used[i] != 0) && (timestamp_ns > writer->open[i].header.first_ns) &&
+            (timestamp_ns - writer->open[i].header.first_ns >= CAPTURE_CHUNK_SPAN_NS))
+        {
+            if (a_capture_write_chunk(writer, i, timestamp_ns) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    /* find the open chunk of the stream */
+    slot = CAPTURE_STREAM_MAX;
+    for (i = 0; i < CAPTURE_STREAM_MAX; i++)
+    {
+        if ((writer->used[i] != 0) && (writer->open[i].header.addr == chunk->addr) &&
+            (writer->open[i].header.channel == chunk->channel))
+        {
+            slot = i;
+            
+            break;
+        }
+    }
+    
+    /* close it when the sample cannot continue it */
+    if (slot != CAPTURE_STREAM_MAX)
+    {
+        h = &writer->open[slot].header;
+        if ((h->range != chunk->range) || (h->rate != chunk->rate) || (seq != h->last_seq + 1))
+        {
+            if (a_capture_write_chunk(writer, slot, timestamp_ns) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    /* start a new chunk */
+    if ((slot == CAPTURE_STREAM_MAX) || (writer->used[slot] == 0))
+    {
+        if (slot == CAPTURE_STREAM_MAX)
+        {
+            for (i = 0; i < CAPTURE_STREAM_MAX; i++)
+            {
+                if (writer->used[i] == 0)
+                {
+                    slot = i;
+                    
+                    break;
+                }
+            }
+            if (slot == CAPTURE_STREAM_MAX)
+            {
+                return 4;
+            }
+        }
+        h = &writer->open[slot].header;
+        memset(h, 0, sizeof(capture_chunk_header_t));
+        h->magic = CAPTURE_CHUNK_MAGIC;
+        h->addr = chunk->addr;
+        h->channel = chunk->channel;
+        h->range = chunk->range;
+        h->rate = chunk->rate;
+        h->lsb_v = chunk->lsb_v;
+        h->first_seq = seq;
+        h->first_ns = timestamp_ns;
+        writer->used[slot] = 1;
+    }
+    
+    /* append */
+    h = &writer->open[slot].header;
+    writer->open[slot].raw[h->count] = raw;
+    h->count++;
+    h->last_seq = seq;
+    h->last_ns = timestamp_ns;
+    if (h->count == CAPTURE_CHUNK_SAMPLES)
+    {
+        return a_capture_write_chunk(writer, slot, timestamp_ns);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write the open chunks and close the file
+ * @param[in] *writer points to a capture writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t capture_writer_close(capture_writer_t *writer)
+{
+    uint8_t res = 0;
+    uint8_t slot;
+    uint8_t i;
+    
+    if (writer == NULL)
+    {
+        return 1;
+    }
+    
+    /* oldest last sample first */
+    while (res == 0)
+    {
+        slot = CAPTURE_STREAM_MAX;
+        for (i = 0; i < CAPTURE_STREAM_MAX; i++)
+        {
+            if ((writer->used[i] != 0) &&
+                ((slot == CAPTURE_STREAM_MAX) || (writer->open[i].header.last_ns < writer->open[slot].header.last_ns)))
+            {
+                slot = i;
+            }
+        }
+        if (slot == CAPTURE_STREAM_MAX)
+        {
+            break;
+        }
+        res = a_capture_write_chunk(writer, slot, writer->open[slot].header.last_ns);
+    }
+    if (close(writer->fd) != 0)
+    {
+        perror("capture: close failed.\n");
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     map a capture file
+ * @param[in] *reader points to a capture reader structure
+ * @param[in] *path is the input file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      a torn chunk at the end of the file is ignored
+ */
+uint8_t capture_reader_open(capture_reader_t *reader, const char *path)
+{
+    struct stat st;
+    void *p;
+    
+    if ((reader == NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    memset(reader, 0, sizeof(capture_reader_t));
+    reader->fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (reader->fd < 0)
+    {
+        perror("capture: open failed.\n");
+        
+        return 1;
+    }
+    if (fstat(reader->fd, &st) != 0)
+    {
+        perror("capture: stat failed.\n");
+        (void)close(reader->fd);
+        
+        return 1;
+    }
+    if ((size_t)st.st_size < sizeof(capture_header_t))
+    {
+        (void)fprintf(stderr, "capture: %s is not a capture file.\n", path);
+        (void)close(reader->fd);
+        
+        return 1;
+    }
+    reader->size = (size_t)st.st_size;
+    p = mmap(NULL, reader->size, PROT_READ, MAP_SHARED, reader->fd, 0);
+    if (p == MAP_FAILED)
+    {
+        perror("capture: mmap failed.\n");
+        (void)close(reader->fd);
+        
+        return 1;
+    }
+    reader->base = (const uint8_t *)p;
+    reader->header = (const capture_header_t *)p;
+    if ((memcmp(reader->header->magic, CAPTURE_MAGIC, 8) != 0) ||
+        (reader->header->version != CAPTURE_VERSION) ||
+        (reader->header->header_size != sizeof(capture_header_t)) ||
+        (reader->header->chunk_size != sizeof(capture_chunk_t)) ||
+        (reader->header->chunk_samples != CAPTURE_CHUNK_SAMPLES))
+    {
+        (void)fprintf(stderr, "capture: %s is not a capture file.\n", path);
+        (void)capture_reader_close(reader);
+        
+        return 1;
+    }
+    reader->chunks = (uint32_t)((reader->size - sizeof(capture_header_t)) / sizeof(capture_chunk_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap a capture file
+ * @param[in] *reader points to a capture reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      slices served before are invalid afterwards
+ */
+uint8_t capture_reader_close(capture_reader_t *reader)
+{
+    uint8_t res = 0;
+    
+    if ((reader == NULL) || (reader->base == NULL))
+    {
+        return 1;
+    }
+    if (munmap((void *)reader->base, reader->size) != 0)
+    {
+        perror("capture: munmap failed.\n");
+        res = 1;
+    }
+    if (close(reader->fd) != 0)
+    {
+        perror("capture: close failed.\n");
+        res = 1;
+    }
+    reader->base = NULL;
+    reader->header = NULL;
+    
+    return res;
+}
+
+/**
+ * @brief     get a chunk of the mapping
+ * @param[in] *reader points to a capture reader structure
+ * @param[in] index is the chunk index
+ * @return    pointer to the chunk
+ * @note      none
+ */
+static const capture_chunk_t *a_capture_chunk(const capture_reader_t *reader, uint32_t index)
+{
+    return (const capture_chunk_t *)(reader->base + sizeof(capture_header_t) + (size_t)index * sizeof(capture_chunk_t));
+}
+
+/**
+ * @brief      start a time window query
+ * @param[in]  *reader points to a capture reader structure
+ * @param[out] *query points to a capture query structure
+ * @param[in]  addr is the ads1115_address_t of the device
+ * @param[in]  channel is the ads1115_channel_t
+ * @param[in]  t0_ns is the window start
+ * @param[in]  t1_ns is the window end, inclusive
+ * @return     status code
+ *             - 0 success
+ *             - 1 query failed
+ * @note       binary search on the chunk write order, O(log n) chunk headers are touched,
+ *             the slices then scan the chunks written up to about CAPTURE_CHUNK_SPAN_NS after t1
+ */
+uint8_t capture_reader_query(capture_reader_t *reader, capture_query_t *query, uint8_t addr, uint8_t channel,
+                             uint64_t t0_ns, uint64_t t1_ns)
+{
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+    
+    if ((reader == NULL) || (reader->base == NULL) || (query == NULL) || (t1_ns < t0_ns))
+    {
+        return 1;
+    }
+    
+    /* a chunk holding samples at or after t0 was written at or after t0 */
+    lo = 0;
+    hi = reader->chunks;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (a_capture_chunk(reader, mid)->header.written_ns < t0_ns)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    query->addr = addr;
+    query->channel = channel;
+    query->t0_ns = t0_ns;
+    query->t1_ns = t1_ns;
+    query->next = lo;
+    
+    return 0;
+}
+
+/**
+ * @brief     find the first chunk sample at or after a time
+ * @param[in] *h points to a chunk header
+ * @param[in] t_ns is the time
+ * @return    sample index, count if none
+ * @note      none
+ */
+static uint32_t a_capture_lower(const capture_chunk_header_t *h, uint64_t t_ns)
+{
+    uint32_t lo = 0;
+    uint32_t hi = h->count;
+    uint32_t mid;
+    
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (capture_sample_time(h, mid) < t_ns)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return lo;
+}
+
+/**
+ * @brief      get the next slice of a query
+ * @param[in]  *reader points to a capture reader structure
+ * @param[in]  *query points to a capture query structure
+ * @param[out] **chunk points to a chunk header pointer
+ * @param[out] **raw points to a sample pointer into the mapping
+ * @param[out] *n points to a sample number buffer
+ * @param[out] *index points to the index of the first slice sample in its chunk
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more slices
+ * @note       zero copy, use capture_sample_time for the time of a slice sample
+ */
+uint8_t capture_reader_next(capture_reader_t *reader, capture_query_t *query, const capture_chunk_header_t **chunk,
+                            const int16_t **raw, uint32_t *n, uint32_t *index)
+{
+    const capture_chunk_t *c;
+    const capture_chunk_header_t *h;
+    uint64_t limit;
+    uint32_t i0;
+    uint32_t i1;
+    
+    if ((reader == NULL) || (reader->base == NULL) || (query == NULL) ||
+        (chunk == NULL) || (raw == NULL) || (n == NULL) || (index == NULL))
+    {
+        return 1;
+    }
+    
+    /* no chunk written later than this can start inside the window */
+    limit = query->t1_ns + reader->header->max_span_ns;
+    if (limit < query->t1_ns)
+    {
+        limit = UINT64_MAX;
+    }
+    while (query->next < reader->chunks)
+    {
+        c = a_capture_chunk(reader, query->next);
+        h = &c->header;
+        if (h->written_ns > limit)
+        {
+            break;
+        }
+        query->next++;
+        if ((h->magic != CAPTURE_CHUNK_MAGIC) || (h->count == 0) || (h->count > CAPTURE_CHUNK_SAMPLES) ||
+            (h->addr != query->addr) || (h->channel != query->channel) ||
+            (h->last_ns < query->t0_ns) || (h->first_ns > query->t1_ns))
+        {
+            continue;
+        }
+        i0 = a_capture_lower(h, query->t0_ns);
+        i1 = (query->t1_ns == UINT64_MAX) ? h->count : a_capture_lower(h, query->t1_ns + 1);
+        if (i1 <= i0)
+        {
+            continue;
+        }
+        *chunk = h;
+        *raw = &c->raw[i0];
+        *n = i1 - i0;
+        *index = i0;
+        
+        return 0;
+    }
+    query->next = reader->chunks;
+    
+    return 1;
+}
+
+/**
+ * @brief     get the time of a chunk sample
+ * @param[in] *chunk points to a chunk header
+ * @param[in] index is the sample index in the chunk
+ * @return    sample time in ns
+ * @note      interpolated between the first and the last sample, a chunk never spans a sequence gap
+ */
+uint64_t capture_sample_time(const capture_chunk_header_t *chunk, uint32_t index)
+{
+    if ((chunk->count < 2) || (index == 0))
+    {
+        return chunk->first_ns;
+    }
+    if (index >= (uint32_t)chunk->count - 1)
+    {
+        return chunk->last_ns;
+    }
+    
+    return chunk->first_ns + (uint64_t)((double)(chunk->last_ns - chunk->first_ns) * index / (chunk->count - 1));
+}
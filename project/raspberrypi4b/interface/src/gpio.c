@@ -23,20 +23,22 @@
  *
  * @file      gpio.c
  * @brief     gpio source file
- * @version   1.0.0
+ * @version   2.0.0
  * @author    Shifeng Li
- * @date      2022-11-11
+ * @date      2026-10-18
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.0      <td>Shifeng Li  <td>use a pollable fd instead of a pthread
  * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
  */
 
 #include "gpio.h"
 #include <gpiod.h>
-#include <pthread.h>
+#include <poll.h>
+#include <string.h>
 
 /**
  * @brief gpio device name definition
@@ -44,72 +46,31 @@
 #define GPIO_DEVICE_NAME "/dev/gpiochip0"        /**< gpio device name */
 
 /**
- * @brief gpio device line definition
+ * @brief gpio event batch definition
  */
-#define GPIO_DEVICE_LINE 17                      /**< gpio device line */
+#define GPIO_EVENT_BATCH 16                      /**< events read per syscall */
 
 /**
- * @brief global var definition
+ * @brief     gpio interrupt init
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @param[in] line is the gpio line number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      no thread is created, the edges are queued by the kernel until read
  */
-static struct gpiod_chip *gs_chip;        /**< gpio chip handle */
-static struct gpiod_line *gs_line;        /**< gpio line handle */
-static pthread_t gs_pid;                  /**< gpio pthread pid */
-extern volatile uint8_t g_flag;           /**< interrupt flag */
-
-/**
- * @brief  gpio interrupt pthread
- * @param  *p ponts to an args buffer
- * @return NULL
- * @note   none
- */
-static void *a_gpio_interrupt_pthread(void *p)
+uint8_t gpio_interrupt_init(gpio_interrupt_t *gpio, uint32_t line)
 {
-    int res;
-    struct gpiod_line_event event;
-    
-    /* enable catching cancel signal */
-    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-
-    /* cancel the pthread at once */
-    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-
-    /* loop */
-    while (1)
+    if (gpio == NULL)
     {
-        /* wait for the event */
-        res = gpiod_line_event_wait(gs_line, NULL);
-        if (res == 1)
-        {
-            /* read the event */
-            if (gpiod_line_event_read(gs_line, &event) != 0)
-            {
-                continue;
-            }
-
-            /* if the falling edge */
-            if (event.event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
-            {
-                /* set the flag */
-                g_flag = 1;
-            }
-        }
+        return 1;
     }
-}
-
-/**
- * @brief  gpio interrupt init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
- */
-uint8_t gpio_interrupt_init(void)
-{
-    uint8_t res;
+    memset(gpio, 0, sizeof(gpio_interrupt_t));
+    gpio->fd = -1;
     
     /* open the gpio group */
-    gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
-    if (gs_chip == NULL)
+    gpio->chip = gpiod_chip_open(GPIO_DEVICE_NAME);
+    if (gpio->chip == NULL)
     {
         perror("gpio: open failed.\n");
 
@@ -117,30 +78,30 @@ uint8_t gpio_interrupt_init(void)
     }
     
     /* get the gpio line */
-    gs_line = gpiod_chip_get_line(gs_chip, GPIO_DEVICE_LINE);
-    if (gs_line == NULL) 
+    gpio->line = gpiod_chip_get_line(gpio->chip, line);
+    if (gpio->line == NULL) 
     {
         perror("gpio: get line failed.\n");
-        gpiod_chip_close(gs_chip);
+        gpiod_chip_close(gpio->chip);
 
         return 1;
     }
 
     /* catch the falling edge */
-    if (gpiod_line_request_falling_edge_events(gs_line, "gpiointerrupt") < 0)
+    if (gpiod_line_request_falling_edge_events(gpio->line, "gpiointerrupt") < 0)
     {
         perror("gpio: set edge events failed.\n");
-        gpiod_chip_close(gs_chip);
+        gpiod_chip_close(gpio->chip);
 
         return 1;
     }
-
-    /* creat a gpio interrupt pthread */
-    res = pthread_create(&gs_pid, NULL, a_gpio_interrupt_pthread, NULL);
-    if (res != 0)
+    
+    /* get the event fd */
+    gpio->fd = gpiod_line_event_get_fd(gpio->line);
+    if (gpio->fd < 0)
     {
-        perror("gpio: creat pthread failed.\n");
-        gpiod_chip_close(gs_chip);
+        perror("gpio: get event fd failed.\n");
+        gpiod_chip_close(gpio->chip);
 
         return 1;
     }
@@ -149,27 +110,153 @@ uint8_t gpio_interrupt_init(void)
 }
 
 /**
- * @brief  gpio interrupt deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     gpio interrupt deinit
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t gpio_interrupt_deinit(void)
+uint8_t gpio_interrupt_deinit(gpio_interrupt_t *gpio)
 {
-    uint8_t res;
+    if ((gpio == NULL) || (gpio->chip == NULL))
+    {
+        return 1;
+    }
+    
+    /* close the gpio */
+    gpiod_chip_close(gpio->chip);
+    gpio->chip = NULL;
+    gpio->line = NULL;
+    gpio->fd = -1;
     
-    /* close the gpio interrupt pthread */
-    res = pthread_cancel(gs_pid);
-    if (res != 0)
+    return 0;
+}
+
+/**
+ * @brief      get the pollable file descriptor
+ * @param[in]  *gpio points to a gpio interrupt structure
+ * @param[out] *fd points to a file descriptor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get fd failed
+ * @note       the fd becomes readable when an edge is pending and can be added to an epoll set
+ */
+uint8_t gpio_interrupt_get_fd(gpio_interrupt_t *gpio, int *fd)
+{
+    if ((gpio == NULL) || (gpio->fd < 0))
     {
-        perror("gpio: delete pthread failed.\n");
+        return 1;
+    }
+    *fd = gpio->fd;
+    
+    return 0;
+}
 
+/**
+ * @brief         read the pending falling edges without blocking
+ * @param[in]     *gpio points to a gpio interrupt structure
+ * @param[out]    *timestamp_ns points to a timestamp buffer
+ * @param[in,out] *len points to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          len is the buffer capacity on input and the edge number on output,
+ *                the edges beyond the capacity are counted but their timestamps are dropped
+ */
+uint8_t gpio_interrupt_read(gpio_interrupt_t *gpio, uint64_t *timestamp_ns, uint16_t *len)
+{
+    int i;
+    int res;
+    uint16_t num = 0;
+    struct pollfd pfd;
+    struct gpiod_line_event events[GPIO_EVENT_BATCH];
+    
+    if ((gpio == NULL) || (gpio->fd < 0))
+    {
         return 1;
     }
+    
+    pfd.fd = gpio->fd;
+    pfd.events = POLLIN;
+    while (1)
+    {
+        /* check pending events without blocking */
+        pfd.revents = 0;
+        res = poll(&pfd, 1, 0);
+        if (res < 0)
+        {
+            perror("gpio: poll failed.\n");
+            
+            return 1;
+        }
+        if ((res == 0) || ((pfd.revents & POLLIN) == 0))
+        {
+            break;
+        }
+        
+        /* read a batch of events */
+        res = gpiod_line_event_read_multiple(gpio->line, events, GPIO_EVENT_BATCH);
+        if (res < 0)
+        {
+            perror("gpio: read events failed.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < res; i++)
+        {
+            if (events[i].event_type != GPIOD_LINE_EVENT_FALLING_EDGE)
+            {
+                continue;
+            }
+            gpio->count++;
+            gpio->timestamp_ns = (uint64_t)events[i].ts.tv_sec * 1000000000ULL + (uint64_t)events[i].ts.tv_nsec;
+            if ((timestamp_ns != NULL) && (num < *len))
+            {
+                timestamp_ns[num] = gpio->timestamp_ns;
+            }
+            num++;
+        }
+    }
+    *len = num;
+    
+    return 0;
+}
 
-    /* close the gpio */
-    gpiod_chip_close(gs_chip);
+/**
+ * @brief     wait for a falling edge
+ * @param[in] *gpio points to a gpio interrupt structure
+ * @param[in] timeout_ms is the timeout in ms and -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 4 timeout
+ * @note      none
+ */
+uint8_t gpio_interrupt_wait(gpio_interrupt_t *gpio, int32_t timeout_ms)
+{
+    int res;
+    struct pollfd pfd;
+    
+    if ((gpio == NULL) || (gpio->fd < 0))
+    {
+        return 1;
+    }
+    
+    pfd.fd = gpio->fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    res = poll(&pfd, 1, timeout_ms);
+    if (res < 0)
+    {
+        perror("gpio: poll failed.\n");
+        
+        return 1;
+    }
+    if (res == 0)
+    {
+        return 4;
+    }
     
     return 0;
 }
@@ -0,0 +1,370 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record.c
+ * @brief     record source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "record.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief     write every byte of an iovec list
+ * @param[in] fd is the output fd
+ * @param[in] *iov points to an iovec list, modified on partial writes
+ * @param[in] cnt is the iovec count
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_record_writev(int fd, struct iovec *iov, int cnt)
+{
+    ssize_t n;
+    
+    while (cnt > 0)
+    {
+        n = writev(fd, iov, cnt);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("record: write failed.\n");
+            
+            return 1;
+        }
+        while ((cnt > 0) && ((size_t)n >= iov->iov_len))
+        {
+            n -= (ssize_t)iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0)
+        {
+            iov->iov_base = (uint8_t *)iov->iov_base + n;
+            iov->iov_len -= (size_t)n;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     read a clock in ns
+ * @param[in] id is the clock id
+ * @return    time in ns
+ * @note      none
+ */
+static uint64_t a_record_clock_ns(clockid_t id)
+{
+    struct timespec ts;
+    
+    clock_gettime(id, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     open a record and write its header
+ * @param[in] *record points to a record structure
+ * @param[in] *path is the output file, "-" for stdout
+ * @param[in] *stream points to a stream description buffer
+ * @param[in] count is the number of streams
+ * @param[in] flags is RECORD_HEADER_* or 0
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      host byte order
+ */
+uint8_t record_open(record_t *record, const char *path, const record_stream_t *stream, uint8_t count, uint8_t flags)
+{
+    record_header_t header;
+    struct iovec iov;
+    
+    if ((record == NULL) || (path == NULL) || (stream == NULL) || (count == 0) || (count > RECORD_STREAM_MAX))
+    {
+        return 1;
+    }
+    memset(record, 0, sizeof(record_t));
+    record->packed = ((flags & RECORD_HEADER_PACKED) != 0) ? 1 : 0;
+    
+    /* open the output */
+    if (strcmp(path, "-") == 0)
+    {
+        (void)fflush(stdout);
+        record->fd = STDOUT_FILENO;
+    }
+    else
+    {
+        record->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (record->fd < 0)
+        {
+            perror("record: open failed.\n");
+            
+            return 1;
+        }
+        record->close_fd = 1;
+    }
+    
+    /* write the header */
+    memset(&header, 0, sizeof(record_header_t));
+    memcpy(header.magic, RECORD_MAGIC, 8);
+    header.version = RECORD_VERSION;
+    header.header_size = sizeof(record_header_t);
+    header.sample_size = sizeof(record_sample_t);
+    header.stream_count = count;
+    header.flags = flags;
+    header.start_realtime_ns = a_record_clock_ns(CLOCK_REALTIME);
+    header.start_monotonic_ns = a_record_clock_ns(CLOCK_MONOTONIC);
+    memcpy(header.stream, stream, sizeof(record_stream_t) * count);
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(record_header_t);
+    if (a_record_writev(record->fd, &iov, 1) != 0)
+    {
+        if (record->close_fd != 0)
+        {
+            (void)close(record->fd);
+        }
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     encode and write the packed block
+ * @param[in] *record points to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_record_pack(record_t *record)
+{
+    struct iovec iov[2];
+    uint32_t used;
+    
+    if (record->pack_len == 0)
+    {
+        return 0;
+    }
+    if (ads1115_codec_encode(record->pack, record->pack_len, record->frame, sizeof(record->frame), &used) != 0)
+    {
+        (void)fprintf(stderr, "record: encode failed.\n");
+        
+        return 1;
+    }
+    record->block.frame_size = (uint16_t)used;
+    iov[0].iov_base = &record->block;
+    iov[0].iov_len = sizeof(record_block_t);
+    iov[1].iov_base = record->frame;
+    iov[1].iov_len = used;
+    if (a_record_writev(record->fd, iov, 2) != 0)
+    {
+        return 1;
+    }
+    record->samples += record->pack_len;
+    record->pack_len = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     append samples to the packed block
+ * @param[in] *record points to a record structure
+ * @param[in] *samples points to a sample buffer
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_record_write_packed(record_t *record, const record_sample_t *samples, uint32_t n)
+{
+    uint32_t i;
+    
+    for (i = 0; i < n; i++)
+    {
+        if ((samples[i].flags & RECORD_FLAG_DUPLICATE) != 0)
+        {
+            continue;
+        }
+        
+        /* a block holds one stream without gaps */
+        if ((record->pack_len != 0) && ((samples[i].stream != record->block.stream) ||
+            (samples[i].seq != record->block.first_seq + record->pack_len)))
+        {
+            if (a_record_pack(record) != 0)
+            {
+                return 1;
+            }
+        }
+        if (record->pack_len == 0)
+        {
+            memset(&record->block, 0, sizeof(record_block_t));
+            record->block.first_ns = samples[i].timestamp_ns;
+            record->block.first_seq = samples[i].seq;
+            record->block.stream = samples[i].stream;
+        }
+        record->block.last_ns = samples[i].timestamp_ns;
+        record->pack[record->pack_len] = samples[i].raw;
+        record->pack_len++;
+        if (record->pack_len == RECORD_PACK_SAMPLES)
+        {
+            if (a_record_pack(record) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     append samples
+ * @param[in] *record points to a record structure
+ * @param[in] *samples points to a sample buffer
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      buffered, a full buffer and the new samples leave in one writev,
+ *            a packed record drops duplicates and starts a new block on a stream change or a sequence gap
+ */
+uint8_t record_write(record_t *record, const record_sample_t *samples, uint32_t n)
+{
+    struct iovec iov[2];
+    
+    if ((record == NULL) || (samples == NULL))
+    {
+        return 1;
+    }
+    if (record->packed != 0)
+    {
+        return a_record_write_packed(record, samples, n);
+    }
+    
+    /* buffer while there is room */
+    if (record->len + n <= RECORD_BATCH)
+    {
+        memcpy(&record->buf[record->len], samples, sizeof(record_sample_t) * n);
+        record->len += n;
+        
+        return 0;
+    }
+    
+    /* write the buffer and the new samples together */
+    iov[0].iov_base = record->buf;
+    iov[0].iov_len = sizeof(record_sample_t) * record->len;
+    iov[1].iov_base = (void *)samples;
+    iov[1].iov_len = sizeof(record_sample_t) * n;
+    if (a_record_writev(record->fd, iov, 2) != 0)
+    {
+        return 1;
+    }
+    record->samples += record->len + n;
+    record->len = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     write the buffered samples
+ * @param[in] *record points to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      a packed record ends its current block
+ */
+uint8_t record_flush(record_t *record)
+{
+    struct iovec iov;
+    
+    if (record == NULL)
+    {
+        return 1;
+    }
+    if (record->packed != 0)
+    {
+        return a_record_pack(record);
+    }
+    if (record->len == 0)
+    {
+        return 0;
+    }
+    iov.iov_base = record->buf;
+    iov.iov_len = sizeof(record_sample_t) * record->len;
+    if (a_record_writev(record->fd, &iov, 1) != 0)
+    {
+        return 1;
+    }
+    record->samples += record->len;
+    record->len = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     flush and close a record
+ * @param[in] *record points to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      stdout is flushed but not closed
+ */
+uint8_t record_close(record_t *record)
+{
+    uint8_t res;
+    
+    if (record == NULL)
+    {
+        return 1;
+    }
+    res = record_flush(record);
+    if ((record->close_fd != 0) && (close(record->fd) != 0))
+    {
+        perror("record: close failed.\n");
+        res = 1;
+    }
+    
+    return res;
+}
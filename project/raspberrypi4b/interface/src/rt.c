@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.c
+ * @brief     rt source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "rt.h"
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+/**
+ * @brief rt thread definition
+ */
+#define RT_STACK_SIZE        (1024 * 1024)        /**< acquisition thread stack size */
+#define RT_STACK_PREFAULT    (64 * 1024)          /**< stack bytes touched before the first cycle */
+
+/**
+ * @brief  touch the stack so the first cycles take no page faults
+ * @note   none
+ */
+static void a_rt_prefault_stack(void)
+{
+    volatile uint8_t buf[RT_STACK_PREFAULT];
+    uint32_t i;
+    
+    for (i = 0; i < RT_STACK_PREFAULT; i += 4096)
+    {
+        buf[i] = 0;
+    }
+    (void)buf[0];
+}
+
+/**
+ * @brief     advance a timespec
+ * @param[in] *ts points to a timespec structure
+ * @param[in] ns is the advance in ns
+ * @note      none
+ */
+static void a_rt_timespec_add(struct timespec *ts, uint64_t ns)
+{
+    ns += (uint64_t)ts->tv_nsec;
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+/**
+ * @brief     convert a timespec to ns
+ * @param[in] *ts points to a timespec structure
+ * @return    time in ns
+ * @note      none
+ */
+static uint64_t a_rt_timespec_ns(const struct timespec *ts)
+{
+    return (uint64_t)ts->tv_sec * 1000000000ULL + (uint64_t)ts->tv_nsec;
+}
+
+/**
+ * @brief     add one wake latency to the statistics
+ * @param[in] *rt points to an rt runner structure
+ * @param[in] latency_ns is the wake latency
+ * @param[in] overruns is the number of missed periods
+ * @note      the sequence lets readers copy without a lock
+ */
+static void a_rt_record(rt_t *rt, uint64_t latency_ns, uint64_t overruns)
+{
+    uint64_t bin;
+    rt_statistics_t *s = &rt->statistics;
+    
+    __atomic_fetch_add(&rt->seq, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    if ((s->count == 0) || (latency_ns < s->min_ns))
+    {
+        s->min_ns = latency_ns;
+    }
+    if (latency_ns > s->max_ns)
+    {
+        s->max_ns = latency_ns;
+    }
+    bin = latency_ns / RT_HISTOGRAM_BIN_NS;
+    s->histogram[(bin < RT_HISTOGRAM_BINS) ? bin : (RT_HISTOGRAM_BINS - 1)]++;
+    s->sum_ns += latency_ns;
+    s->overruns += overruns;
+    s->count++;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_fetch_add(&rt->seq, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief     acquisition pthread
+ * @param[in] *p points to an rt runner structure
+ * @return    NULL
+ * @note      paced by clock_nanosleep on absolute deadlines so the error never accumulates
+ */
+static void *a_rt_thread(void *p)
+{
+    rt_t *rt = (rt_t *)p;
+    struct timespec next;
+    struct timespec now;
+    uint64_t next_ns;
+    uint64_t now_ns;
+    uint64_t latency;
+    uint64_t skip;
+    
+    a_rt_prefault_stack();
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (rt->stop == 0)
+    {
+        /* sleep until the next absolute deadline */
+        a_rt_timespec_add(&next, rt->config.period_ns);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+        {
+            
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        next_ns = a_rt_timespec_ns(&next);
+        now_ns = a_rt_timespec_ns(&now);
+        latency = (now_ns > next_ns) ? (now_ns - next_ns) : 0;
+        
+        /* keep the phase when whole periods were lost */
+        skip = latency / rt->config.period_ns;
+        if (skip != 0)
+        {
+            a_rt_timespec_add(&next, skip * rt->config.period_ns);
+        }
+        a_rt_record(rt, latency, skip);
+        
+        /* run the cycle */
+        if (rt->step(rt->arg, now_ns) != 0)
+        {
+            break;
+        }
+    }
+    rt->running = 0;
+    
+    return NULL;
+}
+
+/**
+ * @brief     rt runner init
+ * @param[in] *rt points to an rt runner structure
+ * @param[in] *config points to an rt config structure
+ * @param[in] *step points to a cycle function address
+ * @param[in] *arg is the cycle argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      step runs once per period on the acquisition thread and stops the runner by returning non zero,
+ *            it must not allocate or block
+ */
+uint8_t rt_init(rt_t *rt, const rt_config_t *config, uint8_t (*step)(void *arg, uint64_t timestamp_ns), void *arg)
+{
+    if ((rt == NULL) || (config == NULL) || (step == NULL) || (config->period_ns == 0))
+    {
+        return 1;
+    }
+    
+    memset(rt, 0, sizeof(rt_t));
+    rt->config = *config;
+    rt->step = step;
+    rt->arg = arg;
+    
+    return 0;
+}
+
+/**
+ * @brief     rt runner start
+ * @param[in] *rt points to an rt runner structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      SCHED_FIFO and mlockall need CAP_SYS_NICE and CAP_IPC_LOCK or root
+ */
+uint8_t rt_start(rt_t *rt)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t cpus;
+    int res;
+    
+    if (rt == NULL)
+    {
+        return 1;
+    }
+    
+    /* lock the current and future pages */
+    if (rt->config.lock_memory != 0)
+    {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            perror("rt: mlockall failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* build the thread attributes */
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, RT_STACK_SIZE);
+    if (rt->config.priority > 0)
+    {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = rt->config.priority;
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+    if (rt->config.cpu >= 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(rt->config.cpu, &cpus);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpus);
+    }
+    
+    /* creat the acquisition pthread */
+    rt->stop = 0;
+    rt->running = 1;
+    res = pthread_create(&rt->thread, &attr, a_rt_thread, rt);
+    pthread_attr_destroy(&attr);
+    if (res != 0)
+    {
+        rt->running = 0;
+        errno = res;
+        perror("rt: creat pthread failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     rt runner stop
+ * @param[in] *rt points to an rt runner structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      waits for the acquisition thread to exit
+ */
+uint8_t rt_stop(rt_t *rt)
+{
+    if (rt == NULL)
+    {
+        return 1;
+    }
+    
+    rt->stop = 1;
+    
+    return rt_join(rt);
+}
+
+/**
+ * @brief      wait until the step stops the runner
+ * @param[in]  *rt points to an rt runner structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 join failed
+ * @note       none
+ */
+uint8_t rt_join(rt_t *rt)
+{
+    if (rt == NULL)
+    {
+        return 1;
+    }
+    
+    if (pthread_join(rt->thread, NULL) != 0)
+    {
+        perror("rt: join pthread failed.\n");
+        
+        return 1;
+    }
+    if (rt->config.lock_memory != 0)
+    {
+        (void)munlockall();
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get a consistent copy of the statistics
+ * @param[in]  *rt points to an rt runner structure
+ * @param[out] *statistics points to an rt statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       never blocks the acquisition thread
+ */
+uint8_t rt_get_statistics(rt_t *rt, rt_statistics_t *statistics)
+{
+    uint32_t begin;
+    uint32_t end;
+    
+    if ((rt == NULL) || (statistics == NULL))
+    {
+        return 1;
+    }
+    
+    do
+    {
+        begin = __atomic_load_n(&rt->seq, __ATOMIC_ACQUIRE);
+        memcpy(statistics, &rt->statistics, sizeof(rt_statistics_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&rt->seq, __ATOMIC_RELAXED);
+    } while (((begin & 1) != 0) || (begin != end));
+    
+    return 0;
+}
@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm_ring.c
+ * @brief     shm ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm_ring.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     get the object size of a capacity
+ * @param[in] capacity is the number of slots
+ * @return    size in bytes
+ * @note      none
+ */
+static size_t a_shm_ring_size(uint32_t capacity)
+{
+    return sizeof(shm_ring_header_t) + (size_t)capacity * sizeof(shm_ring_sample_t);
+}
+
+/**
+ * @brief     create the ring as the publisher
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *name is the shared memory object name such as "/ads1115"
+ * @param[in] capacity is the number of slots, a power of two
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the object appears in /dev/shm
+ */
+uint8_t shm_ring_publisher_init(shm_ring_t *ring, const char *name, uint32_t capacity)
+{
+    void *p;
+    
+    if ((ring == NULL) || (name == NULL) || (capacity < 2) || ((capacity & (capacity - 1)) != 0))
+    {
+        return 1;
+    }
+    memset(ring, 0, sizeof(shm_ring_t));
+    strncpy(ring->name, name, SHM_RING_NAME_MAX - 1);
+    ring->size = a_shm_ring_size(capacity);
+    
+    /* creat the object */
+    ring->fd = shm_open(ring->name, O_CREAT | O_RDWR, 0644);
+    if (ring->fd < 0)
+    {
+        perror("shm_ring: open failed.\n");
+        
+        return 1;
+    }
+    if ((ftruncate(ring->fd, 0) != 0) || (ftruncate(ring->fd, (off_t)ring->size) != 0))
+    {
+        perror("shm_ring: truncate failed.\n");
+        (void)close(ring->fd);
+        (void)shm_unlink(ring->name);
+        
+        return 1;
+    }
+    p = mmap(NULL, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->fd, 0);
+    if (p == MAP_FAILED)
+    {
+        perror("shm_ring: mmap failed.\n");
+        (void)close(ring->fd);
+        (void)shm_unlink(ring->name);
+        
+        return 1;
+    }
+    
+    /* readers accept the ring once the magic is visible */
+    ring->header = (shm_ring_header_t *)p;
+    ring->samples = (shm_ring_sample_t *)((uint8_t *)p + sizeof(shm_ring_header_t));
+    ring->mask = capacity - 1;
+    ring->writer = 1;
+    ring->header->version = SHM_RING_VERSION;
+    ring->header->capacity = capacity;
+    ring->header->sample_size = sizeof(shm_ring_sample_t);
+    __atomic_store_n(&ring->header->head, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->header->magic, SHM_RING_MAGIC, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     publish samples
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *samples points to a sample buffer
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      never waits for readers, slow readers lose the oldest samples
+ */
+uint8_t shm_ring_publish(shm_ring_t *ring, const shm_ring_sample_t *samples, uint32_t n)
+{
+    uint64_t head;
+    uint32_t i;
+    
+    if ((ring == NULL) || (ring->writer == 0) || (samples == NULL))
+    {
+        return 1;
+    }
+    
+    /* one slot in flight at a time, each head store is visible before the next slot is overwritten */
+    head = __atomic_load_n(&ring->header->head, __ATOMIC_RELAXED);
+    for (i = 0; i < n; i++)
+    {
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        ring->samples[(head + i) & ring->mask] = samples[i];
+        __atomic_store_n(&ring->header->head, head + i + 1, __ATOMIC_RELEASE);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     remove the ring as the publisher
+ * @param[in] *ring points to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      mapped readers keep their mapping until they deinit
+ */
+uint8_t shm_ring_publisher_deinit(shm_ring_t *ring)
+{
+    uint8_t res = 0;
+    
+    if ((ring == NULL) || (ring->writer == 0))
+    {
+        return 1;
+    }
+    if (munmap(ring->header, ring->size) != 0)
+    {
+        perror("shm_ring: munmap failed.\n");
+        res = 1;
+    }
+    (void)close(ring->fd);
+    if (shm_unlink(ring->name) != 0)
+    {
+        perror("shm_ring: unlink failed.\n");
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     open the ring as a reader
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] *name is the shared memory object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      read only mapping, the cursor starts at the newest sample
+ */
+uint8_t shm_ring_reader_init(shm_ring_t *ring, const char *name)
+{
+    struct stat st;
+    void *p;
+    shm_ring_header_t *header;
+    
+    if ((ring == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    memset(ring, 0, sizeof(shm_ring_t));
+    strncpy(ring->name, name, SHM_RING_NAME_MAX - 1);
+    
+    /* map the object read only */
+    ring->fd = shm_open(ring->name, O_RDONLY, 0);
+    if (ring->fd < 0)
+    {
+        perror("shm_ring: open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(ring->fd, &st) != 0) || ((size_t)st.st_size < sizeof(shm_ring_header_t)))
+    {
+        (void)close(ring->fd);
+        
+        return 1;
+    }
+    ring->size = (size_t)st.st_size;
+    p = mmap(NULL, ring->size, PROT_READ, MAP_SHARED, ring->fd, 0);
+    if (p == MAP_FAILED)
+    {
+        perror("shm_ring: mmap failed.\n");
+        (void)close(ring->fd);
+        
+        return 1;
+    }
+    
+    /* check the layout */
+    header = (shm_ring_header_t *)p;
+    if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC) ||
+        (header->version != SHM_RING_VERSION) ||
+        (header->sample_size != sizeof(shm_ring_sample_t)) ||
+        (header->capacity < 2) || ((header->capacity & (header->capacity - 1)) != 0) ||
+        (a_shm_ring_size(header->capacity) != ring->size))
+    {
+        (void)munmap(p, ring->size);
+        (void)close(ring->fd);
+        
+        return 1;
+    }
+    ring->header = header;
+    ring->samples = (shm_ring_sample_t *)((uint8_t *)p + sizeof(shm_ring_header_t));
+    ring->mask = header->capacity - 1;
+    ring->cursor = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+    
+    return 0;
+}
+
+/**
+ * @brief      get the next batch in place
+ * @param[in]  *ring points to a shm ring structure
+ * @param[out] **samples points to a sample pointer
+ * @param[out] *n points to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 peek failed
+ * @note       no syscall and no copy, the batch stops at the end of the ring
+ */
+uint8_t shm_ring_reader_peek(shm_ring_t *ring, const shm_ring_sample_t **samples, uint32_t *n)
+{
+    uint64_t head;
+    uint64_t count;
+    uint64_t idx;
+    
+    if ((ring == NULL) || (ring->writer != 0) || (samples == NULL) || (n == NULL))
+    {
+        return 1;
+    }
+    
+    /* the slot after head may be under write, keep one slot of margin */
+    head = __atomic_load_n(&ring->header->head, __ATOMIC_ACQUIRE);
+    if (head - ring->cursor > ring->mask)
+    {
+        ring->lost += head - ring->cursor - ring->mask;
+        ring->cursor = head - ring->mask;
+    }
+    count = head - ring->cursor;
+    idx = ring->cursor & ring->mask;
+    if (idx + count > ring->mask + 1)
+    {
+        count = ring->mask + 1 - idx;
+    }
+    *samples = &ring->samples[idx];
+    *n = (uint32_t)count;
+    
+    return 0;
+}
+
+/**
+ * @brief     finish a batch
+ * @param[in] *ring points to a shm ring structure
+ * @param[in] n is the number of samples consumed
+ * @return    status code
+ *            - 0 success
+ *            - 1 release failed
+ *            - 2 the batch was overwritten while it was read
+ * @note      discard the batch results when 2 is returned
+ */
+uint8_t shm_ring_reader_release(shm_ring_t *ring, uint32_t n)
+{
+    uint64_t head;
+    
+    if ((ring == NULL) || (ring->writer != 0))
+    {
+        return 1;
+    }
+    
+    /* the batch is intact while the writer has not reached its first slot */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    head = __atomic_load_n(&ring->header->head, __ATOMIC_RELAXED);
+    if (n > head - ring->cursor)
+    {
+        return 1;
+    }
+    ring->cursor += n;
+    if (head - (ring->cursor - n) > ring->mask)
+    {
+        ring->lost += n;
+        
+        return 2;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close the ring as a reader
+ * @param[in] *ring points to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t shm_ring_reader_deinit(shm_ring_t *ring)
+{
+    if ((ring == NULL) || (ring->writer != 0))
+    {
+        return 1;
+    }
+    if (munmap(ring->header, ring->size) != 0)
+    {
+        perror("shm_ring: munmap failed.\n");
+        (void)close(ring->fd);
+        
+        return 1;
+    }
+    (void)close(ring->fd);
+    
+    return 0;
+}
@@ -0,0 +1,943 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ads1115d.c
+ * @brief     ads1115d source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "driver_ads1115_interface.h"
+#include "driver_ads1115_executor.h"
+#include "ads1115d_client.h"
+#include "cache.h"
+#include <errno.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief ads1115d limit definition
+ */
+#define ADS1115D_DEVICE_MAX         4                                                /**< one per addr pin */
+#define ADS1115D_CHANNEL_MAX        8                                                /**< one per ads1115_channel_t */
+#define ADS1115D_SLOT_MAX           (ADS1115D_DEVICE_MAX * ADS1115D_CHANNEL_MAX)     /**< device channel pairs */
+#define ADS1115D_CLIENT_MAX         32                                               /**< connections */
+#define ADS1115D_WAITER_MAX         256                                              /**< requests waiting for a conversion */
+#define ADS1115D_SUB_MAX            64                                               /**< subscriptions */
+
+/**
+ * @brief ads1115d device structure definition
+ */
+typedef struct ads1115d_device_s
+{
+    ads1115_handle_t handle;        /**< ads1115 handle */
+    uint8_t present;                /**< 1 if configured */
+    uint8_t config_pending;         /**< 1 while a config waits for the device to idle */
+    uint8_t range;                  /**< pending range */
+    uint8_t rate;                   /**< pending rate */
+    int config_client;              /**< client of the pending config, -1 if gone */
+    uint32_t config_id;             /**< id of the pending config */
+    cache_t cache;                  /**< latest sample per channel */
+} ads1115d_device_t;
+
+/**
+ * @brief ads1115d slot structure definition
+ */
+typedef struct ads1115d_slot_s
+{
+    ads1115_op_t op;                /**< conversion shared by every waiter */
+} ads1115d_slot_t;
+
+/**
+ * @brief ads1115d waiter structure definition
+ */
+typedef struct ads1115d_waiter_s
+{
+    uint8_t used;                   /**< 1 if in use */
+    uint8_t slot;                   /**< slot waited on */
+    int client;                     /**< client to answer */
+    int sub;                        /**< subscription index or -1 for a read */
+    uint32_t id;                    /**< request id */
+} ads1115d_waiter_t;
+
+/**
+ * @brief ads1115d subscription structure definition
+ */
+typedef struct ads1115d_sub_s
+{
+    uint8_t used;                   /**< 1 if in use */
+    uint8_t slot;                   /**< subscribed slot */
+    uint8_t waiting;                /**< 1 while a conversion is pending */
+    int client;                     /**< subscribed client */
+    uint32_t id;                    /**< subscription id */
+    uint64_t period_ns;             /**< event period */
+    uint64_t next_ns;               /**< next event time */
+    uint64_t last_ns;               /**< time of the last sample sent */
+} ads1115d_sub_t;
+
+/**
+ * @brief global var definition
+ */
+static ads1115d_device_t gs_device[ADS1115D_DEVICE_MAX];        /**< devices */
+static ads1115d_slot_t gs_slot[ADS1115D_SLOT_MAX];              /**< device channel pairs */
+static int gs_client[ADS1115D_CLIENT_MAX];                      /**< client fds, -1 if free */
+static ads1115d_waiter_t gs_waiter[ADS1115D_WAITER_MAX];        /**< waiting requests */
+static ads1115d_sub_t gs_sub[ADS1115D_SUB_MAX];                 /**< subscriptions */
+static ads1115_executor_t gs_executor;                          /**< conversion executor */
+static volatile sig_atomic_t gs_stop = 0;                       /**< stop flag */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_ads1115d_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     stop signal handler
+ * @param[in] signum is the signal number
+ * @note      none
+ */
+static void a_ads1115d_signal(int signum)
+{
+    (void)signum;
+    gs_stop = 1;
+}
+
+/**
+ * @brief      get the cached sample of a slot
+ * @param[in]  slot is the slot index
+ * @param[out] *entry points to a cache entry buffer
+ * @return     1 if a sample is cached else 0
+ * @note       none
+ */
+static uint8_t a_ads1115d_cached(uint8_t slot, cache_entry_t *entry)
+{
+    return (cache_get(&gs_device[slot / ADS1115D_CHANNEL_MAX].cache,
+                      (ads1115_channel_t)(slot % ADS1115D_CHANNEL_MAX), entry) == 0) ? 1 : 0;
+}
+
+/**
+ * @brief     send a message to a client
+ * @param[in] client is the client index
+ * @param[in] op is the message op
+ * @param[in] status is the message status
+ * @param[in] slot is the slot index
+ * @param[in] id is the request id
+ * @note      never blocks, a client that does not drain its socket loses messages
+ */
+static void a_ads1115d_send(int client, uint8_t op, uint8_t status, uint8_t slot, uint32_t id)
+{
+    ads1115d_response_t response;
+    cache_entry_t entry;
+    
+    if ((client < 0) || (gs_client[client] < 0))
+    {
+        return;
+    }
+    memset(&response, 0, sizeof(ads1115d_response_t));
+    response.op = op;
+    response.status = status;
+    response.device = (uint8_t)(slot / ADS1115D_CHANNEL_MAX);
+    response.channel = (uint8_t)(slot % ADS1115D_CHANNEL_MAX);
+    response.id = id;
+    if ((status == 0) && (a_ads1115d_cached(slot, &entry) != 0))
+    {
+        response.raw = entry.raw;
+        response.v = entry.v;
+        response.timestamp_ns = entry.timestamp_ns;
+    }
+    (void)send(gs_client[client], &response, sizeof(ads1115d_response_t), MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+/**
+ * @brief     conversion continuation
+ * @param[in] *op points to the completed operation
+ * @note      answers every request that waited on the conversion
+ */
+static void a_ads1115d_resume(ads1115_op_t *op)
+{
+    uint8_t slot = (uint8_t)(uintptr_t)op->arg;
+    uint8_t status;
+    uint32_t i;
+    uint64_t now;
+    
+    status = (op->status == 0) ? 0 : 1;
+    now = a_ads1115d_now_ns();
+    if (status == 0)
+    {
+        (void)cache_publish(&gs_device[slot / ADS1115D_CHANNEL_MAX].cache,
+                            (ads1115_channel_t)(slot % ADS1115D_CHANNEL_MAX), op->raw, op->v, now);
+    }
+    for (i = 0; i < ADS1115D_WAITER_MAX; i++)
+    {
+        if ((gs_waiter[i].used == 0) || (gs_waiter[i].slot != slot))
+        {
+            continue;
+        }
+        if (gs_waiter[i].sub < 0)
+        {
+            a_ads1115d_send(gs_waiter[i].client, ADS1115D_OP_READ, status, slot, gs_waiter[i].id);
+        }
+        else
+        {
+            gs_sub[gs_waiter[i].sub].waiting = 0;
+            if (status == 0)
+            {
+                gs_sub[gs_waiter[i].sub].last_ns = now;
+                a_ads1115d_send(gs_waiter[i].client, ADS1115D_OP_SAMPLE, 0, slot, gs_waiter[i].id);
+            }
+        }
+        gs_waiter[i].used = 0;
+    }
+}
+
+/**
+ * @brief     start the shared conversion of a slot if someone waits on it
+ * @param[in] slot is the slot index
+ * @note      a device with a pending config starts nothing until the config is applied
+ */
+static void a_ads1115d_kick(uint8_t slot)
+{
+    uint8_t device = (uint8_t)(slot / ADS1115D_CHANNEL_MAX);
+    uint32_t i;
+    
+    if ((gs_slot[slot].op.state != ADS1115_OP_STATE_IDLE) || (gs_device[device].config_pending != 0))
+    {
+        return;
+    }
+    for (i = 0; i < ADS1115D_WAITER_MAX; i++)
+    {
+        if ((gs_waiter[i].used != 0) && (gs_waiter[i].slot == slot))
+        {
+            (void)ads1115_executor_submit(&gs_executor, &gs_slot[slot].op, &gs_device[device].handle,
+                                          (ads1115_channel_t)(slot % ADS1115D_CHANNEL_MAX),
+                                          a_ads1115d_resume, (void *)(uintptr_t)slot);
+            
+            return;
+        }
+    }
+}
+
+/**
+ * @brief     wait on the next conversion of a slot
+ * @param[in] slot is the slot index
+ * @param[in] client is the client index
+ * @param[in] sub is the subscription index or -1 for a read
+ * @param[in] id is the request id
+ * @return    status code
+ *            - 0 success
+ *            - 4 no free waiter
+ * @note      requests on the same slot share one conversion
+ */
+static uint8_t a_ads1115d_wait(uint8_t slot, int client, int sub, uint32_t id)
+{
+    uint32_t i;
+    
+    for (i = 0; i < ADS1115D_WAITER_MAX; i++)
+    {
+        if (gs_waiter[i].used == 0)
+        {
+            gs_waiter[i].used = 1;
+            gs_waiter[i].slot = slot;
+            gs_waiter[i].client = client;
+            gs_waiter[i].sub = sub;
+            gs_waiter[i].id = id;
+            a_ads1115d_kick(slot);
+            
+            return 0;
+        }
+    }
+    
+    return 4;
+}
+
+/**
+ * @brief     handle one request
+ * @param[in] client is the client index
+ * @param[in] *request points to a request structure
+ * @note      none
+ */
+static void a_ads1115d_request(int client, const ads1115d_request_t *request)
+{
+    uint8_t slot;
+    uint8_t status;
+    uint64_t now;
+    uint32_t i;
+    cache_entry_t entry;
+    
+    /* unsubscribe needs no device */
+    if (request->op == ADS1115D_OP_UNSUBSCRIBE)
+    {
+        for (i = 0; i < ADS1115D_SUB_MAX; i++)
+        {
+            if ((gs_sub[i].used != 0) && (gs_sub[i].client == client) && (gs_sub[i].id == request->id))
+            {
+                gs_sub[i].used = 0;
+            }
+        }
+        for (i = 0; i < ADS1115D_WAITER_MAX; i++)
+        {
+            if ((gs_waiter[i].used != 0) && (gs_waiter[i].sub >= 0) && (gs_sub[gs_waiter[i].sub].used == 0))
+            {
+                gs_waiter[i].used = 0;
+            }
+        }
+        a_ads1115d_send(client, ADS1115D_OP_UNSUBSCRIBE, 0, 0, request->id);
+        
+        return;
+    }
+    
+    /* check the device and channel */
+    slot = (uint8_t)(request->device * ADS1115D_CHANNEL_MAX + request->channel);
+    if ((request->device >= ADS1115D_DEVICE_MAX) || (gs_device[request->device].present == 0) ||
+        (request->channel >= ADS1115D_CHANNEL_MAX))
+    {
+        a_ads1115d_send(client, request->op, 5, 0, request->id);
+        
+        return;
+    }
+    
+    now = a_ads1115d_now_ns();
+    if (request->op == ADS1115D_OP_READ)
+    {
+        /* answer from the cache or share the next conversion */
+        if ((a_ads1115d_cached(slot, &entry) != 0) && (now - entry.timestamp_ns <= (uint64_t)request->arg * 1000000ULL))
+        {
+            a_ads1115d_send(client, ADS1115D_OP_READ, 0, slot, request->id);
+        }
+        else if (a_ads1115d_wait(slot, client, -1, request->id) != 0)
+        {
+            a_ads1115d_send(client, ADS1115D_OP_READ, 4, slot, request->id);
+        }
+    }
+    else if (request->op == ADS1115D_OP_SUBSCRIBE)
+    {
+        status = 4;
+        if (request->arg == 0)
+        {
+            status = 5;
+        }
+        else
+        {
+            for (i = 0; i < ADS1115D_SUB_MAX; i++)
+            {
+                if (gs_sub[i].used == 0)
+                {
+                    gs_sub[i].used = 1;
+                    gs_sub[i].slot = slot;
+                    gs_sub[i].waiting = 0;
+                    gs_sub[i].client = client;
+                    gs_sub[i].id = request->id;
+                    gs_sub[i].period_ns = (uint64_t)request->arg * 1000000ULL;
+                    gs_sub[i].next_ns = now;
+                    gs_sub[i].last_ns = 0;
+                    status = 0;
+                    
+                    break;
+                }
+            }
+        }
+        a_ads1115d_send(client, ADS1115D_OP_SUBSCRIBE, status, slot, request->id);
+    }
+    else if (request->op == ADS1115D_OP_CONFIG)
+    {
+        /* one pending config per device */
+        if (gs_device[request->device].config_pending != 0)
+        {
+            a_ads1115d_send(client, ADS1115D_OP_CONFIG, 4, slot, request->id);
+        }
+        else if (((request->range != ADS1115D_KEEP) && (request->range > ADS1115_RANGE_0P256V)) ||
+                 ((request->rate != ADS1115D_KEEP) && (request->rate > ADS1115_RATE_860SPS)))
+        {
+            a_ads1115d_send(client, ADS1115D_OP_CONFIG, 5, slot, request->id);
+        }
+        else
+        {
+            gs_device[request->device].config_pending = 1;
+            gs_device[request->device].range = request->range;
+            gs_device[request->device].rate = request->rate;
+            gs_device[request->device].config_client = client;
+            gs_device[request->device].config_id = request->id;
+        }
+    }
+    else
+    {
+        a_ads1115d_send(client, request->op, 5, slot, request->id);
+    }
+}
+
+/**
+ * @brief     serve the due subscriptions
+ * @param[in] now is the current time
+ * @note      a new sample younger than half a period is sent without a conversion
+ */
+static void a_ads1115d_service(uint64_t now)
+{
+    uint32_t i;
+    ads1115d_sub_t *sub;
+    cache_entry_t entry;
+    
+    for (i = 0; i < ADS1115D_SUB_MAX; i++)
+    {
+        sub = &gs_sub[i];
+        if (sub->used == 0)
+        {
+            continue;
+        }
+        if ((sub->waiting == 0) && (sub->next_ns <= now))
+        {
+            if ((a_ads1115d_cached(sub->slot, &entry) != 0) && (entry.timestamp_ns > sub->last_ns) &&
+                (now - entry.timestamp_ns <= sub->period_ns / 2))
+            {
+                sub->last_ns = entry.timestamp_ns;
+                a_ads1115d_send(sub->client, ADS1115D_OP_SAMPLE, 0, sub->slot, sub->id);
+            }
+            else if (a_ads1115d_wait(sub->slot, sub->client, (int)i, sub->id) == 0)
+            {
+                sub->waiting = 1;
+            }
+            sub->next_ns += sub->period_ns;
+            if (sub->next_ns <= now)
+            {
+                sub->next_ns = now + sub->period_ns;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  get the next subscription time
+ * @return next subscription time, UINT64_MAX if none
+ * @note   subscriptions waiting on a conversion are woken by its completion
+ */
+static uint64_t a_ads1115d_next_sub(void)
+{
+    uint32_t i;
+    uint64_t next = UINT64_MAX;
+    
+    for (i = 0; i < ADS1115D_SUB_MAX; i++)
+    {
+        if ((gs_sub[i].used != 0) && (gs_sub[i].waiting == 0) && (gs_sub[i].next_ns < next))
+        {
+            next = gs_sub[i].next_ns;
+        }
+    }
+    
+    return next;
+}
+
+/**
+ * @brief  apply the pending configs of idle devices
+ * @note   the cached samples of a reconfigured device are dropped
+ */
+static void a_ads1115d_apply(void)
+{
+    uint8_t d;
+    uint8_t c;
+    uint8_t status;
+    uint8_t busy;
+    ads1115d_device_t *device;
+    
+    for (d = 0; d < ADS1115D_DEVICE_MAX; d++)
+    {
+        device = &gs_device[d];
+        if (device->config_pending == 0)
+        {
+            continue;
+        }
+        busy = 0;
+        for (c = 0; c < ADS1115D_CHANNEL_MAX; c++)
+        {
+            if (gs_slot[d * ADS1115D_CHANNEL_MAX + c].op.state != ADS1115_OP_STATE_IDLE)
+            {
+                busy = 1;
+            }
+        }
+        if (busy != 0)
+        {
+            continue;
+        }
+        status = 0;
+        if ((device->range != ADS1115D_KEEP) && (ads1115_set_range(&device->handle, (ads1115_range_t)device->range) != 0))
+        {
+            status = 1;
+        }
+        if ((device->rate != ADS1115D_KEEP) && (ads1115_set_rate(&device->handle, (ads1115_rate_t)device->rate) != 0))
+        {
+            status = 1;
+        }
+        device->config_pending = 0;
+        (void)cache_clear(&device->cache);
+        a_ads1115d_send(device->config_client, ADS1115D_OP_CONFIG, status, (uint8_t)(d * ADS1115D_CHANNEL_MAX), device->config_id);
+        for (c = 0; c < ADS1115D_CHANNEL_MAX; c++)
+        {
+            a_ads1115d_kick((uint8_t)(d * ADS1115D_CHANNEL_MAX + c));
+        }
+    }
+}
+
+/**
+ * @brief     drop a client
+ * @param[in] client is the client index
+ * @note      its waiting requests and subscriptions go with it
+ */
+static void a_ads1115d_drop(int client)
+{
+    uint32_t i;
+    
+    (void)close(gs_client[client]);
+    gs_client[client] = -1;
+    for (i = 0; i < ADS1115D_WAITER_MAX; i++)
+    {
+        if ((gs_waiter[i].used != 0) && (gs_waiter[i].client == client))
+        {
+            gs_waiter[i].used = 0;
+        }
+    }
+    for (i = 0; i < ADS1115D_SUB_MAX; i++)
+    {
+        if ((gs_sub[i].used != 0) && (gs_sub[i].client == client))
+        {
+            gs_sub[i].used = 0;
+        }
+    }
+    for (i = 0; i < ADS1115D_DEVICE_MAX; i++)
+    {
+        if (gs_device[i].config_client == client)
+        {
+            gs_device[i].config_client = -1;
+        }
+    }
+}
+
+/**
+ * @brief     init a device
+ * @param[in] addr is the addr pin
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      single shot mode, the alert pin disabled
+ */
+static uint8_t a_ads1115d_device_init(ads1115_address_t addr, ads1115_rate_t rate)
+{
+    ads1115_handle_t *handle = &gs_device[addr].handle;
+    
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(handle, ads1115_handle_t);
+    DRIVER_ADS1115_LINK_IIC_INIT(handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(handle, ads1115_interface_unlock);
+    
+    if (ads1115_set_addr_pin(handle, addr) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_init(handle) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_set_config_word(handle, ADS1115_CONFIG_WORD(ADS1115_CHANNEL_AIN0_GND, ADS1115_RANGE_6P144V, rate,
+                                                            ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                            ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                            ADS1115_COMPARATOR_QUEUE_NONE_CONV)) != 0)
+    {
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    if (cache_init(&gs_device[addr].cache, handle) != 0)
+    {
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    gs_device[addr].present = 1;
+    gs_device[addr].config_client = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief     open the listening socket
+ * @param[in] *path is the socket path
+ * @param[in] *fd points to a socket fd buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      a stale socket file is replaced
+ */
+static uint8_t a_ads1115d_listen(const char *path, int *fd)
+{
+    struct sockaddr_un addr;
+    
+    memset(&addr, 0, sizeof(struct sockaddr_un));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    *fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (*fd < 0)
+    {
+        perror("ads1115d: socket failed.\n");
+        
+        return 1;
+    }
+    (void)unlink(path);
+    if (bind(*fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        perror("ads1115d: bind failed.\n");
+        (void)close(*fd);
+        
+        return 1;
+    }
+    if (listen(*fd, ADS1115D_CLIENT_MAX) != 0)
+    {
+        perror("ads1115d: listen failed.\n");
+        (void)close(*fd);
+        (void)unlink(path);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the daemon
+ * @param[in] listen_fd is the listening socket
+ * @note      returns on SIGINT or SIGTERM
+ */
+static void a_ads1115d_loop(int listen_fd)
+{
+    struct pollfd fds[ADS1115D_CLIENT_MAX + 1];
+    int index[ADS1115D_CLIENT_MAX + 1];
+    ads1115d_request_t request;
+    struct timespec timeout;
+    uint64_t now;
+    uint64_t next_us;
+    uint64_t next_ns;
+    uint64_t sub_ns;
+    ssize_t n;
+    int fd;
+    int nfds;
+    int i;
+    
+    while (gs_stop == 0)
+    {
+        /* serve subscriptions, configs and conversions */
+        a_ads1115d_service(a_ads1115d_now_ns());
+        a_ads1115d_apply();
+        (void)ads1115_executor_run(&gs_executor, &next_us);
+        sub_ns = a_ads1115d_next_sub();
+        next_ns = (next_us == UINT64_MAX) ? UINT64_MAX : next_us * 1000ULL;
+        if (sub_ns < next_ns)
+        {
+            next_ns = sub_ns;
+        }
+        
+        /* wait for the next deadline or a message */
+        nfds = 0;
+        fds[nfds].fd = listen_fd;
+        fds[nfds].events = POLLIN;
+        index[nfds++] = -1;
+        for (i = 0; i < ADS1115D_CLIENT_MAX; i++)
+        {
+            if (gs_client[i] >= 0)
+            {
+                fds[nfds].fd = gs_client[i];
+                fds[nfds].events = POLLIN;
+                index[nfds++] = i;
+            }
+        }
+        now = a_ads1115d_now_ns();
+        if (next_ns != UINT64_MAX)
+        {
+            next_ns = (next_ns > now) ? (next_ns - now) : 0;
+            timeout.tv_sec = (time_t)(next_ns / 1000000000ULL);
+            timeout.tv_nsec = (long)(next_ns % 1000000000ULL);
+        }
+        if (ppoll(fds, (nfds_t)nfds, (next_ns != UINT64_MAX) ? &timeout : NULL, NULL) <= 0)
+        {
+            continue;
+        }
+        
+        /* read the messages */
+        for (i = 1; i < nfds; i++)
+        {
+            if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+            {
+                continue;
+            }
+            while (1)
+            {
+                n = recv(fds[i].fd, &request, sizeof(ads1115d_request_t), MSG_DONTWAIT);
+                if (n == (ssize_t)sizeof(ads1115d_request_t))
+                {
+                    a_ads1115d_request(index[i], &request);
+                }
+                else if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+                {
+                    break;
+                }
+                else if ((n == 0) || (n < 0))
+                {
+                    a_ads1115d_drop(index[i]);
+                    
+                    break;
+                }
+            }
+        }
+        
+        /* accept the new clients */
+        if ((fds[0].revents & POLLIN) != 0)
+        {
+            while ((fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+            {
+                for (i = 0; i < ADS1115D_CLIENT_MAX; i++)
+                {
+                    if (gs_client[i] < 0)
+                    {
+                        gs_client[i] = fd;
+                        
+                        break;
+                    }
+                }
+                if (i == ADS1115D_CLIENT_MAX)
+                {
+                    (void)close(fd);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc is arg numbers
+ * @param[in] **argv is the arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int i;
+    int listen_fd;
+    int longindex = 0;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"addr", required_argument, NULL, 1},
+        {"rate", required_argument, NULL, 2},
+        {"socket", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+    uint8_t addr_mask = 0;
+    ads1115_rate_t rate = ADS1115_RATE_860SPS;
+    const char *path = ADS1115D_DEFAULT_SOCKET;
+    struct sigaction sa;
+    
+    /* parse */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            /* addr, may be given once per device */
+            case 1 :
+            {
+                if (strcmp("GND", optarg) == 0)
+                {
+                    addr_mask |= 1 << ADS1115_ADDR_GND;
+                }
+                else if (strcmp("VCC", optarg) == 0)
+                {
+                    addr_mask |= 1 << ADS1115_ADDR_VCC;
+                }
+                else if (strcmp("SDA", optarg) == 0)
+                {
+                    addr_mask |= 1 << ADS1115_ADDR_SDA;
+                }
+                else if (strcmp("SCL", optarg) == 0)
+                {
+                    addr_mask |= 1 << ADS1115_ADDR_SCL;
+                }
+                else
+                {
+                    ads1115_interface_debug_print("ads1115d: param is invalid.\n");
+                    
+                    return 1;
+                }
+                
+                break;
+            }
+            
+            /* rate */
+            case 2 :
+            {
+                for (i = 0; i < 8; i++)
+                {
+                    if (ads1115_rate_to_sps((ads1115_rate_t)i) == (uint32_t)atol(optarg))
+                    {
+                        rate = (ads1115_rate_t)i;
+                        
+                        break;
+                    }
+                }
+                if (i == 8)
+                {
+                    ads1115_interface_debug_print("ads1115d: param is invalid.\n");
+                    
+                    return 1;
+                }
+                
+                break;
+            }
+            
+            /* socket */
+            case 3 :
+            {
+                path = optarg;
+                
+                break;
+            }
+            
+            /* help and others */
+            default :
+            {
+                ads1115_interface_debug_print("Usage:\n");
+                ads1115_interface_debug_print("  ads1115d [--addr=<VCC | GND | SCL | SDA>]... [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>]\n");
+                ads1115_interface_debug_print("           [--socket=<path>]\n");
+                ads1115_interface_debug_print("\n");
+                ads1115_interface_debug_print("Options:\n");
+                ads1115_interface_debug_print("      --addr=<VCC | GND | SCL | SDA>     Add a device by its addr pin, repeat for more devices.([default: GND])\n");
+                ads1115_interface_debug_print("  -h, --help                             Show the help.\n");
+                ads1115_interface_debug_print("      --rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>\n");
+                ads1115_interface_debug_print("                                         Set the sample rate in SPS.([default: 860])\n");
+                ads1115_interface_debug_print("      --socket=<path>                    Set the UNIX socket path.([default: %s])\n", ADS1115D_DEFAULT_SOCKET);
+                
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (addr_mask == 0)
+    {
+        addr_mask = 1 << ADS1115_ADDR_GND;
+    }
+    
+    /* init the devices once */
+    for (i = 0; i < ADS1115D_CLIENT_MAX; i++)
+    {
+        gs_client[i] = -1;
+    }
+    for (i = 0; i < ADS1115D_DEVICE_MAX; i++)
+    {
+        if ((addr_mask & (1 << i)) != 0)
+        {
+            if (a_ads1115d_device_init((ads1115_address_t)i, rate) != 0)
+            {
+                ads1115_interface_debug_print("ads1115d: init device %d failed.\n", i);
+                
+                goto failed;
+            }
+        }
+    }
+    (void)ads1115_executor_init(&gs_executor, ads1115_interface_timestamp_us);
+    if (a_ads1115d_listen(path, &listen_fd) != 0)
+    {
+        goto failed;
+    }
+    
+    /* stop on SIGINT and SIGTERM */
+    memset(&sa, 0, sizeof(struct sigaction));
+    sa.sa_handler = a_ads1115d_signal;
+    (void)sigaction(SIGINT, &sa, NULL);
+    (void)sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    
+    ads1115_interface_debug_print("ads1115d: listening on %s.\n", path);
+    a_ads1115d_loop(listen_fd);
+    
+    /* close the clients and the devices */
+    for (i = 0; i < ADS1115D_CLIENT_MAX; i++)
+    {
+        if (gs_client[i] >= 0)
+        {
+            (void)close(gs_client[i]);
+        }
+    }
+    (void)close(listen_fd);
+    (void)unlink(path);
+    for (i = 0; i < ADS1115D_DEVICE_MAX; i++)
+    {
+        if (gs_device[i].present != 0)
+        {
+            (void)cache_deinit(&gs_device[i].cache);
+            (void)ads1115_deinit(&gs_device[i].handle);
+        }
+    }
+    
+    return 0;
+    
+    failed:
+    for (i = 0; i < ADS1115D_DEVICE_MAX; i++)
+    {
+        if (gs_device[i].present != 0)
+        {
+            (void)cache_deinit(&gs_device[i].cache);
+            (void)ads1115_deinit(&gs_device[i].handle);
+        }
+    }
+    
+    return 1;
+}
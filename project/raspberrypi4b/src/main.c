@@ -34,150 +34,2005 @@
  * </table>
  */
 
+#include "driver_ads1115_align_test.h"
+#include "driver_ads1115_clock_test.h"
+#include "driver_ads1115_codec_test.h"
 #include "driver_ads1115_compare_test.h"
+#include "driver_ads1115_deadband_test.h"
+#include "driver_ads1115_executor_test.h"
 #include "driver_ads1115_mutichannel_test.h"
+#include "driver_ads1115_power_test.h"
 #include "driver_ads1115_read_test.h"
 #include "driver_ads1115_register_test.h"
+#include "driver_ads1115_rms_test.h"
+#include "driver_ads1115_scheduler_test.h"
+#include "driver_ads1115_sequence_test.h"
+#include "driver_ads1115_trigger_test.h"
 #include "driver_ads1115_basic.h"
 #include "driver_ads1115_interrupt.h"
+#include "driver_ads1115_monitor.h"
+#include "driver_ads1115_alarm.h"
 #include "driver_ads1115_shot.h"
+#include "driver_ads1115_duty.h"
+#include "driver_ads1115_stream.h"
+#include "driver_ads1115_deadband.h"
+#include "driver_ads1115_trigger.h"
+#include "driver_ads1115_rms.h"
+#include "driver_ads1115_pair.h"
+#include "driver_ads1115_scan.h"
+#include "driver_ads1115_align.h"
+#include "driver_ads1115_schedule.h"
 #include "gpio.h"
+#include "rt.h"
+#include "shm_ring.h"
+#include "record.h"
+#include "capture.h"
+#include "async.h"
 #include <getopt.h>
 #include <stdlib.h>
 
 /**
  * @brief global var definition
  */
-volatile uint8_t g_flag;            /**< interrupt flag */
+static gpio_interrupt_t gs_gpio;        /**< gpio interrupt handle */
+static rt_t gs_rt;                      /**< rt runner handle */
+static shm_ring_t gs_ring;              /**< shm ring handle */
+static capture_writer_t gs_capture;     /**< capture writer handle */
+static async_t gs_async;                /**< async engine handle */
+static async_bus_t gs_bus;              /**< async iic bus handle */
+static ads1115_handle_t gs_device[4];   /**< multi device handles */
 
 /**
- * @brief     ads1115 full function
- * @param[in] argc is arg numbers
- * @param[in] **argv is the arg address
+ * @brief shm ring capacity definition
+ */
+#define RT_SHM_RING_CAPACITY 65536        /**< about 76 s at 860 SPS */
+
+/**
+ * @brief record block definition
+ */
+#define RECORD_BLOCK 64                   /**< samples per paced block read */
+#define RECORD_TRIGGER_RING 8192          /**< trigger history in samples, about 9.5 s at 860 SPS */
+
+/**
+ * @brief record trigger ring definition
+ */
+static ads1115_trigger_sample_t gs_trigger_ring[RECORD_TRIGGER_RING];        /**< trigger history */
+
+/**
+ * @brief async example context definition
+ */
+typedef struct async_context_s
+{
+    pthread_mutex_t mutex;            /**< done mutex */
+    pthread_cond_t cond;              /**< done condition */
+    uint32_t times;                   /**< reads per slot */
+    uint32_t active;                  /**< slots still reading */
+    uint32_t errors;                  /**< failed reads */
+} async_context_t;
+
+/**
+ * @brief async example slot definition
+ */
+typedef struct async_slot_s
+{
+    async_request_t request;          /**< read request */
+    async_context_t *ctx;             /**< shared context */
+    uint32_t count;                   /**< finished reads */
+} async_slot_t;
+
+/**
+ * @brief rt example context definition
+ */
+typedef struct rt_context_s
+{
+    uint32_t times;                   /**< samples to take */
+    uint32_t count;                   /**< samples taken */
+    uint32_t errors;                  /**< failed reads */
+    int16_t raw;                      /**< last raw sample */
+    float s;                          /**< last converted sample */
+    shm_ring_t *ring;                 /**< ring to publish to, NULL for none */
+    ads1115_deadband_t *deadband;     /**< report by exception filter, NULL for none */
+    uint8_t channel;                  /**< sample channel */
+    uint8_t addr;                     /**< device address pin */
+} rt_context_t;
+
+/**
+ * @brief cli option structure definition
+ */
+typedef struct cli_option_s
+{
+    uint32_t times;                                  /**< running times */
+    ads1115_address_t addr;                          /**< addr pin */
+    ads1115_channel_t channel;                       /**< adc channel */
+    ads1115_compare_t compare;                       /**< compare mode */
+    float high_threshold;                            /**< high threshold in V */
+    float low_threshold;                             /**< low threshold in V */
+    ads1115_rate_t rate;                             /**< sample rate */
+    int priority;                                    /**< SCHED_FIFO priority */
+    int cpu;                                         /**< acquisition cpu, -1 for none */
+    char shm[SHM_RING_NAME_MAX];                     /**< shm ring name */
+    char output[256];                                /**< record output */
+    uint8_t capture;                                 /**< capture format flag */
+    uint8_t packed;                                  /**< packed record flag */
+    int32_t deadband;                                /**< deadband in counts, -1 for none */
+    uint32_t heartbeat;                              /**< heartbeat in ms */
+    ads1115_monitor_rearm_t rearm;                   /**< monitor rearm policy */
+    float band;                                      /**< monitor band in V */
+    float hysteresis;                                /**< hysteresis in V */
+    uint32_t burst;                                  /**< conversions per burst */
+    ads1115_comparator_queue_t queue;                /**< alarm comparator queue */
+    uint32_t period;                                 /**< duty or schedule period in ms */
+    float noise;                                     /**< duty noise target in lsb */
+    uint8_t trigger;                                 /**< record trigger flag */
+    ads1115_trigger_type_t trigger_type;             /**< record trigger type */
+    ads1115_trigger_edge_t edge;                     /**< record trigger edge */
+    float slope;                                     /**< slope trigger in V per sample */
+    uint32_t pre;                                    /**< pre trigger samples */
+    uint32_t post;                                   /**< post trigger samples */
+    uint32_t cycles;                                 /**< mains cycles per rms window */
+    ads1115_channel_t current_channel;               /**< power current channel */
+    float shunt;                                     /**< power shunt in ohm */
+    float divider;                                   /**< power divider ratio */
+    uint8_t channels;                                /**< scanned or async channels */
+    ads1115_align_method_t method;                   /**< scan align method */
+    uint8_t devices;                                 /**< async or scheduled devices */
+    ads1115_scheduler_policy_t policy;               /**< schedule policy */
+} cli_option_t;
+
+/**
+ * @brief channel name table definition
+ */
+static const char *const gs_channel_name[8] =
+{
+    "AIN0_AIN1", "AIN0_AIN3", "AIN1_AIN3", "AIN2_AIN3",
+    "AIN0_GND", "AIN1_GND", "AIN2_GND", "AIN3_GND",
+};
+
+/**
+ * @brief     set the default options
+ * @param[in] *opt points to a cli option structure
+ * @note      none
+ */
+static void a_option_init(cli_option_t *opt)
+{
+    memset(opt, 0, sizeof(cli_option_t));
+    opt->times = 3;
+    opt->addr = ADS1115_ADDR_GND;
+    opt->channel = ADS1115_CHANNEL_AIN0_GND;
+    opt->compare = ADS1115_COMPARE_THRESHOLD;
+    opt->high_threshold = 0.0f;
+    opt->low_threshold = 0.0f;
+    opt->rate = ADS1115_STREAM_DEFAULT_RATE;
+    opt->priority = 80;
+    opt->cpu = -1;
+    snprintf(opt->output, 256, "-");
+    opt->capture = 0;
+    opt->packed = 0;
+    opt->deadband = -1;
+    opt->heartbeat = 0;
+    opt->rearm = ADS1115_MONITOR_REARM_TRACK;
+    opt->band = 0.01f;
+    opt->hysteresis = 0.0f;
+    opt->burst = 4;
+    opt->queue = ADS1115_COMPARATOR_QUEUE_2_CONV;
+    opt->period = 1000;
+    opt->noise = 1.0f;
+    opt->trigger = 0;
+    opt->trigger_type = ADS1115_TRIGGER_TYPE_LEVEL;
+    opt->edge = ADS1115_TRIGGER_EDGE_RISING;
+    opt->slope = 0.01f;
+    opt->pre = 256;
+    opt->post = 768;
+    opt->cycles = 10;
+    opt->current_channel = ADS1115_CHANNEL_AIN1_GND;
+    opt->shunt = 0.1f;
+    opt->divider = 1.0f;
+    opt->channels = 4;
+    opt->method = ADS1115_ALIGN_METHOD_LINEAR;
+    opt->devices = 1;
+    opt->policy = ADS1115_SCHEDULER_POLICY_EDF;
+}
+
+/**
+ * @brief     rt example cycle
+ * @param[in] *arg points to an rt context structure
+ * @param[in] timestamp_ns is the wake timestamp
+ * @return    1 to stop else 0
+ * @note      runs on the acquisition thread, no allocation and no print
+ */
+static uint8_t a_rt_step(void *arg, uint64_t timestamp_ns)
+{
+    rt_context_t *ctx = (rt_context_t *)arg;
+    shm_ring_sample_t sample;
+    ads1115_bool_t fresh;
+    ads1115_bool_t publish = ADS1115_BOOL_TRUE;
+    
+    if (ads1115_stream_read_sequence(&ctx->raw, &ctx->s, &sample.seq, &fresh) != 0)
+    {
+        ctx->errors++;
+    }
+    else if ((ctx->ring != NULL) && (fresh == ADS1115_BOOL_TRUE))
+    {
+        /* raw counts are compared before anything leaves the thread */
+        if (ctx->deadband != NULL)
+        {
+            (void)ads1115_deadband_update(ctx->deadband, ctx->raw, timestamp_ns / 1000ULL, &publish);
+        }
+        if (publish == ADS1115_BOOL_TRUE)
+        {
+            sample.timestamp_ns = timestamp_ns;
+            sample.raw = ctx->raw;
+            sample.channel = ctx->channel;
+            sample.addr = ctx->addr;
+            sample.v = ctx->s;
+            sample.reserved = 0;
+            (void)shm_ring_publish(ctx->ring, &sample, 1);
+        }
+    }
+    ctx->count++;
+    
+    return (ctx->count >= ctx->times) ? 1 : 0;
+}
+
+/**
+ * @brief     async example completion
+ * @param[in] *request points to an async request structure
+ * @note      runs on the async worker, the slot reads again until it has its times
+ */
+static void a_async_done(async_request_t *request)
+{
+    async_slot_t *slot = (async_slot_t *)request->arg;
+    async_context_t *ctx = slot->ctx;
+    
+    slot->count++;
+    if (request->op.status != 0)
+    {
+        ctx->errors++;
+    }
+    if ((slot->count < ctx->times) &&
+        (async_submit(&gs_bus, request, request->op.handle, request->op.channel, a_async_done, slot) == 0))
+    {
+        return;
+    }
+    pthread_mutex_lock(&ctx->mutex);
+    ctx->active--;
+    pthread_cond_signal(&ctx->cond);
+    pthread_mutex_unlock(&ctx->mutex);
+}
+
+/**
+ * @brief     async example rate config
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *arg points to the rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 config failed
+ * @note      runs on the async worker between the reads of the device
+ */
+static uint8_t a_async_rate(ads1115_handle_t *handle, void *arg)
+{
+    return ads1115_set_rate(handle, *(ads1115_rate_t *)arg);
+}
+
+/**
+ * @brief     init a single shot device of the multi device examples
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] addr is the addr pin
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the alert pin is disabled
+ */
+static uint8_t a_device_init(ads1115_handle_t *handle, ads1115_address_t addr, ads1115_rate_t rate)
+{
+    /* link interface function */
+    DRIVER_ADS1115_LINK_INIT(handle, ads1115_handle_t);
+    DRIVER_ADS1115_LINK_IIC_INIT(handle, ads1115_interface_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(handle, ads1115_interface_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(handle, ads1115_interface_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(handle, ads1115_interface_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(handle, ads1115_interface_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(handle, ads1115_interface_unlock);
+    
+    if (ads1115_set_addr_pin(handle, addr) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_init(handle) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_set_config_word(handle, ADS1115_CONFIG_WORD(ADS1115_CHANNEL_AIN0_GND, ADS1115_RANGE_6P144V, rate,
+                                                            ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                            ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                            ADS1115_COMPARATOR_QUEUE_NONE_CONV)) != 0)
+    {
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     deinit the devices of the multi device examples
+ * @param[in] devices is the device number
+ * @note      none
+ */
+static void a_device_deinit(uint8_t devices)
+{
+    uint8_t d;
+    
+    for (d = 0; d < devices; d++)
+    {
+        (void)ads1115_deinit(&gs_device[d]);
+    }
+}
+
+/**
+ * @brief     convert a voltage to raw counts of the stream range
+ * @param[in] v is the voltage
+ * @return    raw counts
+ * @note      the result is clamped to the code range
+ */
+static int16_t a_volt_to_counts(float v)
+{
+    float counts = v * 32768.0f / ads1115_range_to_full_scale_v(ADS1115_STREAM_DEFAULT_RANGE);
+    
+    if (counts > 32767.0f)
+    {
+        return 32767;
+    }
+    if (counts < -32768.0f)
+    {
+        return -32768;
+    }
+    
+    return (int16_t)counts;
+}
+
+/**
+ * @brief      parse a channel name
+ * @param[in]  *name points to a channel name
+ * @param[out] *channel points to a channel buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 unknown name
+ * @note       none
+ */
+static uint8_t a_parse_channel(const char *name, ads1115_channel_t *channel)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 8; i++)
+    {
+        if (strcmp(gs_channel_name[i], name) == 0)
+        {
+            *channel = (ads1115_channel_t)i;
+            
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     persist a triggered window
+ * @param[in] *record points to a record handle, NULL for the capture writer
+ * @param[in] *chunk points to a capture chunk template
+ * @param[in] *window points to a trigger window
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the slices are read in place, only the file write copies them
+ */
+static uint8_t a_trigger_write(record_t *record, const capture_chunk_header_t *chunk,
+                               const ads1115_trigger_window_t *window)
+{
+    uint8_t s;
+    uint32_t i;
+    uint32_t n;
+    uint32_t count;
+    const ads1115_trigger_sample_t *slice;
+    record_sample_t block[RECORD_BLOCK];
+    
+    for (s = 0; s < 2; s++)
+    {
+        slice = (s == 0) ? window->first : window->second;
+        count = (s == 0) ? window->first_count : window->second_count;
+        for (i = 0; i < count; )
+        {
+            if (record == NULL)
+            {
+                if (capture_writer_append(&gs_capture, chunk, slice[i].timestamp_us * 1000ULL,
+                                          slice[i].seq, slice[i].raw) != 0)
+                {
+                    return 1;
+                }
+                i++;
+                
+                continue;
+            }
+            for (n = 0; (n < RECORD_BLOCK) && (i < count); n++, i++)
+            {
+                block[n].timestamp_ns = slice[i].timestamp_us * 1000ULL;
+                block[n].seq = slice[i].seq;
+                block[n].raw = slice[i].raw;
+                block[n].stream = 0;
+                block[n].flags = 0;
+            }
+            if (record_write(record, block, n) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the record example
+ * @param[in] *opt points to a cli option structure
  * @return    status code
  *            - 0 success
  *            - 1 run failed
  *            - 5 param is invalid
- * @note      none
+ * @note      the samples go to stdout when the output is -
  */
-uint8_t ads1115(uint8_t argc, char **argv)
+static uint8_t a_example_record(const cli_option_t *opt)
 {
-    int c;
-    int longindex = 0;
-    const char short_options[] = "hipe:t:";
-    const struct option long_options[] =
+    uint8_t res;
+    uint32_t i;
+    uint32_t n;
+    uint32_t count;
+    uint32_t last = 0;
+    uint32_t samples;
+    uint32_t duplicates;
+    uint32_t drops;
+    float period = 0.0f;
+    int16_t raw[RECORD_BLOCK];
+    uint64_t ts[RECORD_BLOCK];
+    uint32_t seq[RECORD_BLOCK];
+    record_sample_t block[RECORD_BLOCK];
+    record_stream_t stream;
+    record_t record;
+    capture_chunk_header_t chunk;
+    ads1115_trigger_config_t trigger_config;
+    ads1115_trigger_t trig;
+    ads1115_trigger_window_t window;
+    ads1115_bool_t ready;
+    uint32_t triggers;
+    uint32_t trigger_drops;
+    
+    /* the capture index is rewritten in place */
+    if ((opt->capture != 0) && (strcmp(opt->output, "-") == 0))
     {
-        {"help", no_argument, NULL, 'h'},
-        {"information", no_argument, NULL, 'i'},
-        {"port", no_argument, NULL, 'p'},
-        {"example", required_argument, NULL, 'e'},
-        {"test", required_argument, NULL, 't'},
-        {"addr", required_argument, NULL, 1},
-        {"channel", required_argument, NULL, 2},
-        {"high-threshold", required_argument, NULL, 3},
-        {"low-threshold", required_argument, NULL, 4},
-        {"mode", required_argument, NULL, 5},
-        {"times", required_argument, NULL, 6},
-        {NULL, 0, NULL, 0},
-    };
-    char type[33] = "unknown";
-    uint32_t times = 3;
-    ads1115_address_t addr = ADS1115_ADDR_GND;
-    ads1115_channel_t channel = ADS1115_CHANNEL_AIN0_GND;
-    ads1115_compare_t compare = ADS1115_COMPARE_THRESHOLD;
-    float high_threshold = 0.0f;
-    float low_threshold = 0.0f;
+        ads1115_interface_debug_print("ads1115: capture format needs an output file.\n");
+        
+        return 5;
+    }
     
-    /* if no params */
-    if (argc == 1)
+    /* only the triggered windows are persisted */
+    if (opt->trigger != 0)
     {
-        /* goto the help */
-        goto help;
+        memset(&trigger_config, 0, sizeof(ads1115_trigger_config_t));
+        trigger_config.type = opt->trigger_type;
+        trigger_config.edge = opt->edge;
+        trigger_config.level = a_volt_to_counts(opt->high_threshold);
+        trigger_config.low = a_volt_to_counts(opt->low_threshold);
+        trigger_config.high = a_volt_to_counts(opt->high_threshold);
+        trigger_config.slope = (opt->slope > 0.0f) ? (uint16_t)a_volt_to_counts(opt->slope) : 0;
+        trigger_config.pre = opt->pre;
+        trigger_config.post = opt->post;
+        trigger_config.holdoff = 0;
+        res = ads1115_trigger_init(&trig, &trigger_config, gs_trigger_ring, RECORD_TRIGGER_RING);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: trigger config is invalid.\n");
+            
+            return 5;
+        }
     }
     
-    /* init 0 */
-    optind = 0;
+    /* stream init */
+    res = ads1115_stream_init(opt->addr, opt->channel, opt->rate);
+    if (res != 0)
+    {
+        return 1;
+    }
     
-    /* parse */
-    do
+    /* write the header */
+    stream.addr = (uint8_t)opt->addr;
+    stream.channel = (uint8_t)opt->channel;
+    stream.range = (uint8_t)ADS1115_STREAM_DEFAULT_RANGE;
+    stream.rate = (uint8_t)opt->rate;
+    stream.lsb_v = ads1115_range_to_full_scale_v(ADS1115_STREAM_DEFAULT_RANGE) / 32768.0f;
+    if (opt->capture != 0)
     {
-        /* parse the args */
-        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        memset(&chunk, 0, sizeof(capture_chunk_header_t));
+        chunk.addr = stream.addr;
+        chunk.channel = stream.channel;
+        chunk.range = stream.range;
+        chunk.rate = stream.rate;
+        chunk.lsb_v = stream.lsb_v;
+        res = capture_writer_open(&gs_capture, opt->output);
+    }
+    else
+    {
+        res = record_open(&record, opt->output, &stream, 1, (opt->packed != 0) ? RECORD_HEADER_PACKED : 0);
+    }
+    if (res != 0)
+    {
+        (void)ads1115_stream_deinit();
         
-        /* judge the result */
-        switch (c)
+        return 1;
+    }
+    
+    /* stream blocks at the conversion rate */
+    for (count = 0; count < opt->times; count += n)
+    {
+        n = ((opt->times - count) < RECORD_BLOCK) ? (opt->times - count) : RECORD_BLOCK;
+        res = ads1115_stream_read_block(raw, ts, seq, n);
+        if (res != 0)
         {
-            /* help */
-            case 'h' :
+            (void)((opt->capture != 0) ? capture_writer_close(&gs_capture) : record_close(&record));
+            (void)ads1115_stream_deinit();
+            
+            return 1;
+        }
+        if (opt->trigger != 0)
+        {
+            for (i = 0; i < n; i++)
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "h");
+                /* a duplicate only repeats the previous sample */
+                if ((count + i != 0) && (seq[i] == last))
+                {
+                    continue;
+                }
+                last = seq[i];
+                (void)ads1115_trigger_push(&trig, raw[i], seq[i], ts[i], &ready);
+                if ((ready == ADS1115_BOOL_TRUE) && (ads1115_trigger_get_window(&trig, &window) == 0))
+                {
+                    res = a_trigger_write((opt->capture != 0) ? NULL : &record, &chunk, &window);
+                    if (res != 0)
+                    {
+                        (void)((opt->capture != 0) ? capture_writer_close(&gs_capture) : record_close(&record));
+                        (void)ads1115_stream_deinit();
+                        
+                        return 1;
+                    }
+                    (void)ads1115_trigger_release(&trig);
+                }
+            }
+            
+            continue;
+        }
+        if (opt->capture != 0)
+        {
+            for (i = 0; i < n; i++)
+            {
+                /* a duplicate only repeats the previous sample */
+                if ((count + i != 0) && (seq[i] == last))
+                {
+                    continue;
+                }
+                last = seq[i];
+                res = capture_writer_append(&gs_capture, &chunk, ts[i] * 1000ULL, seq[i], raw[i]);
+                if (res != 0)
+                {
+                    (void)capture_writer_close(&gs_capture);
+                    (void)ads1115_stream_deinit();
+                    
+                    return 1;
+                }
+            }
+            
+            continue;
+        }
+        for (i = 0; i < n; i++)
+        {
+            block[i].timestamp_ns = ts[i] * 1000ULL;
+            block[i].seq = seq[i];
+            block[i].raw = raw[i];
+            block[i].stream = 0;
+            block[i].flags = (seq[i] == last) ? RECORD_FLAG_DUPLICATE : 0;
+            last = seq[i];
+        }
+        res = record_write(&record, block, n);
+        if (res != 0)
+        {
+            (void)record_close(&record);
+            (void)ads1115_stream_deinit();
+            
+            return 1;
+        }
+    }
+    (void)ads1115_stream_get_counters(&samples, &duplicates, &drops);
+    (void)ads1115_stream_get_period(&period);
+    res = (opt->capture != 0) ? capture_writer_close(&gs_capture) : record_close(&record);
+    (void)ads1115_stream_deinit();
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* stdout carries the samples */
+    if (strcmp(opt->output, "-") != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %u samples recorded to %s.\n", count, opt->output);
+        ads1115_interface_debug_print("ads1115: %u fresh, %u duplicated, %u dropped.\n", samples, duplicates, drops);
+        ads1115_interface_debug_print("ads1115: conversion period %0.1fus.\n", period);
+        if (opt->trigger != 0)
+        {
+            (void)ads1115_trigger_get_counters(&trig, &triggers, &trigger_drops);
+            ads1115_interface_debug_print("ads1115: %u windows of %u samples recorded.\n", triggers, opt->pre + opt->post);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the real-time example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the read loop runs on the rt thread, the statistics are printed after the join
+ */
+static uint8_t a_example_rt(const cli_option_t *opt)
+{
+    uint8_t res;
+    rt_config_t config;
+    rt_context_t ctx;
+    rt_statistics_t stat;
+    ads1115_deadband_t filter;
+    uint32_t samples;
+    uint32_t duplicates;
+    uint32_t drops;
+    uint32_t published;
+    uint32_t suppressed;
+    float period = 0.0f;
+    
+    /* stream init */
+    res = ads1115_stream_init(opt->addr, opt->channel, opt->rate);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* pace one read per conversion period */
+    memset(&ctx, 0, sizeof(rt_context_t));
+    ctx.times = opt->times;
+    ctx.channel = (uint8_t)opt->channel;
+    ctx.addr = (uint8_t)opt->addr;
+    
+    /* publish to the shm ring */
+    if (opt->shm[0] != 0)
+    {
+        res = shm_ring_publisher_init(&gs_ring, opt->shm, RT_SHM_RING_CAPACITY);
+        if (res != 0)
+        {
+            (void)ads1115_stream_deinit();
+            
+            return 1;
+        }
+        ctx.ring = &gs_ring;
+    }
+    
+    /* report by exception */
+    if ((opt->deadband >= 0) || (opt->heartbeat != 0))
+    {
+        (void)ads1115_deadband_init(&filter, (uint16_t)((opt->deadband >= 0) ? opt->deadband : 0), opt->heartbeat);
+        ctx.deadband = &filter;
+    }
+    
+    /* mlockall needs CAP_IPC_LOCK, so only a SCHED_FIFO run locks the memory */
+    config.priority = opt->priority;
+    config.cpu = opt->cpu;
+    config.lock_memory = (opt->priority != 0) ? 1 : 0;
+    config.period_ns = 1000000000UL / ads1115_rate_to_sps(opt->rate);
+    res = rt_init(&gs_rt, &config, a_rt_step, &ctx);
+    if (res != 0)
+    {
+        if (ctx.ring != NULL)
+        {
+            (void)shm_ring_publisher_deinit(&gs_ring);
+        }
+        (void)ads1115_stream_deinit();
+        
+        return 1;
+    }
+    res = rt_start(&gs_rt);
+    if (res != 0)
+    {
+        if (ctx.ring != NULL)
+        {
+            (void)shm_ring_publisher_deinit(&gs_ring);
+        }
+        (void)ads1115_stream_deinit();
+        
+        return 1;
+    }
+    (void)rt_join(&gs_rt);
+    if (ctx.ring != NULL)
+    {
+        (void)shm_ring_publisher_deinit(&gs_ring);
+    }
+    (void)ads1115_stream_get_counters(&samples, &duplicates, &drops);
+    (void)ads1115_stream_get_period(&period);
+    (void)ads1115_stream_deinit();
+    
+    /* print the jitter statistics */
+    (void)rt_get_statistics(&gs_rt, &stat);
+    ads1115_interface_debug_print("ads1115: %u samples, %u read errors.\n", ctx.count, ctx.errors);
+    ads1115_interface_debug_print("ads1115: %u fresh, %u duplicated, %u dropped.\n", samples, duplicates, drops);
+    ads1115_interface_debug_print("ads1115: conversion period %0.1fus.\n", period);
+    if ((ctx.ring != NULL) && (ctx.deadband != NULL))
+    {
+        (void)ads1115_deadband_get_counters(ctx.deadband, &published, &suppressed);
+        ads1115_interface_debug_print("ads1115: %u published, %u suppressed.\n", published, suppressed);
+    }
+    ads1115_interface_debug_print("ads1115: last adc is %0.4fV.\n", ctx.s);
+    ads1115_interface_debug_print("ads1115: wake latency min %0.1fus, mean %0.1fus, max %0.1fus.\n",
+                                  (double)stat.min_ns / 1000.0,
+                                  (stat.count != 0) ? (double)stat.sum_ns / (double)stat.count / 1000.0 : 0.0,
+                                  (double)stat.max_ns / 1000.0);
+    ads1115_interface_debug_print("ads1115: %u periods overrun.\n", (uint32_t)stat.overruns);
+    
+    return 0;
+}
+
+/**
+ * @brief     run the async example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      every channel of every device stays in flight until it has its reads
+ */
+static uint8_t a_example_async(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint8_t d;
+    uint8_t c;
+    uint32_t i;
+    uint32_t n;
+    uint64_t start;
+    uint64_t elapsed;
+    ads1115_rate_t rate;
+    async_context_t ctx;
+    async_slot_t slot[16];
+    async_request_t config[4];
+    
+    /* the devices follow the addr pin */
+    if ((uint32_t)opt->addr + opt->devices > 4)
+    {
+        return 5;
+    }
+    for (d = 0; d < opt->devices; d++)
+    {
+        res = a_device_init(&gs_device[d], (ads1115_address_t)(opt->addr + d), opt->rate);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: device %d init failed.\n", opt->addr + d);
+            a_device_deinit(d);
+            
+            return 1;
+        }
+    }
+    
+    /* one worker serves every added bus */
+    res = async_init(&gs_async);
+    if (res != 0)
+    {
+        a_device_deinit(opt->devices);
+        
+        return 1;
+    }
+    res = async_add_bus(&gs_async, &gs_bus);
+    if (res != 0)
+    {
+        (void)async_deinit(&gs_async);
+        a_device_deinit(opt->devices);
+        
+        return 1;
+    }
+    
+    /* the rate is applied by a config request queued ahead of the reads of each device */
+    rate = opt->rate;
+    for (d = 0; d < opt->devices; d++)
+    {
+        memset(&config[d], 0, sizeof(async_request_t));
+        config[d].op.status = 1;
+        (void)async_submit_config(&gs_bus, &config[d], &gs_device[d], a_async_rate, NULL, &rate);
+    }
+    (void)pthread_mutex_init(&ctx.mutex, NULL);
+    (void)pthread_cond_init(&ctx.cond, NULL);
+    ctx.times = opt->times;
+    ctx.errors = 0;
+    n = (uint32_t)opt->devices * opt->channels;
+    ctx.active = n;
+    
+    /* every channel of every device is in flight, conversions of different devices overlap */
+    start = ads1115_interface_timestamp_us();
+    for (i = 0; i < n; i++)
+    {
+        d = (uint8_t)(i / opt->channels);
+        c = (uint8_t)(i % opt->channels);
+        memset(&slot[i], 0, sizeof(async_slot_t));
+        slot[i].ctx = &ctx;
+        if (async_submit(&gs_bus, &slot[i].request, &gs_device[d],
+                         (ads1115_channel_t)(ADS1115_CHANNEL_AIN0_GND + c), a_async_done, &slot[i]) != 0)
+        {
+            pthread_mutex_lock(&ctx.mutex);
+            ctx.active--;
+            ctx.errors++;
+            pthread_mutex_unlock(&ctx.mutex);
+        }
+    }
+    pthread_mutex_lock(&ctx.mutex);
+    while (ctx.active != 0)
+    {
+        pthread_cond_wait(&ctx.cond, &ctx.mutex);
+    }
+    pthread_mutex_unlock(&ctx.mutex);
+    elapsed = ads1115_interface_timestamp_us() - start;
+    (void)async_deinit(&gs_async);
+    (void)pthread_cond_destroy(&ctx.cond);
+    (void)pthread_mutex_destroy(&ctx.mutex);
+    a_device_deinit(opt->devices);
+    
+    /* print the last reads */
+    for (i = 0; i < n; i++)
+    {
+        ads1115_interface_debug_print("ads1115: device %u AIN%u is %0.4fV after %u reads.\n",
+                                      opt->addr + i / opt->channels, i % opt->channels, slot[i].request.op.v, slot[i].count);
+    }
+    for (d = 0; d < opt->devices; d++)
+    {
+        if (config[d].op.status != 0)
+        {
+            ads1115_interface_debug_print("ads1115: device %u rate config failed.\n", opt->addr + d);
+        }
+    }
+    ads1115_interface_debug_print("ads1115: %u reads in %0.3fms, %u read errors.\n",
+                                  n * opt->times, (double)elapsed / 1000.0, ctx.errors);
+    
+    return 0;
+}
+
+/**
+ * @brief     run the schedule example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the slowest channel completes the running times of jobs
+ */
+static uint8_t a_example_schedule(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t tasks;
+    uint32_t misses;
+    float device_load;
+    float bus_load;
+    ads1115_schedule_info_t info;
+    
+    /* schedule init */
+    res = ads1115_schedule_init(opt->addr, opt->devices, opt->rate, opt->period * 1000, opt->policy);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* the bound is only a prediction, the run measures the misses */
+    res = ads1115_schedule_check(&device_load, &bus_load);
+    ads1115_interface_debug_print("ads1115: %s, device load %0.3f, bus load %0.3f, %s.\n",
+                                  (opt->policy == ADS1115_SCHEDULER_POLICY_EDF) ? "edf" : "rm",
+                                  device_load, bus_load, (res == 0) ? "schedulable" : "not schedulable");
+    
+    /* the slowest channel completes times jobs */
+    res = ads1115_schedule_run(opt->times * (opt->period << 3));
+    if (res != 0)
+    {
+        (void)ads1115_schedule_deinit();
+        
+        return 1;
+    }
+    
+    /* print the statistics */
+    (void)ads1115_schedule_get_statistics(&misses, &bus_load, &tasks);
+    for (i = 0; i < tasks; i++)
+    {
+        (void)ads1115_schedule_get_task(i, &info);
+        ads1115_interface_debug_print("ads1115: device %d AIN%d every %0.1fms, %u jobs, %u misses, worst latency %uus, last %0.4fV.\n",
+                                      info.addr, info.channel, (double)info.period_us / 1000.0, info.jobs,
+                                      info.misses, info.max_latency_us, info.v);
+    }
+    ads1115_interface_debug_print("ads1115: %u deadline misses, measured bus load %0.3f.\n", misses, bus_load);
+    (void)ads1115_schedule_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     run the monitor example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      no bus activity between the arm and the alert edge
+ */
+static uint8_t a_example_monitor(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint32_t i;
+    uint16_t len;
+    ads1115_monitor_config_t config;
+    ads1115_monitor_event_t event;
+    static const char *const state[3] = {"inside", "above", "below"};
+    
+    /* gpio init */
+    res = gpio_interrupt_init(&gs_gpio, GPIO_DEVICE_LINE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* monitor init */
+    config.rearm = opt->rearm;
+    config.band = opt->band;
+    config.high_limit = opt->high_threshold;
+    config.low_limit = opt->low_threshold;
+    config.hysteresis = opt->hysteresis;
+    config.burst = (uint8_t)opt->burst;
+    res = ads1115_monitor_init(opt->addr, opt->channel, opt->rate, &config, &event);
+    if (res != 0)
+    {
+        (void)gpio_interrupt_deinit(&gs_gpio);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: start at %0.4fV, %s, window %d..%d.\n",
+                                  event.v, state[event.state], event.low_threshold, event.high_threshold);
+    
+    for (i = 0; i < opt->times; i++)
+    {
+        /* edges raised before the arm are stale */
+        len = 0;
+        res = gpio_interrupt_read(&gs_gpio, NULL, &len);
+        if (res == 0)
+        {
+            res = ads1115_monitor_arm();
+        }
+        if (res != 0)
+        {
+            (void)ads1115_monitor_deinit();
+            (void)gpio_interrupt_deinit(&gs_gpio);
+            
+            return 1;
+        }
+        
+        /* no bus activity until the alert pin fires */
+        res = gpio_interrupt_wait(&gs_gpio, -1);
+        if (res == 0)
+        {
+            res = ads1115_monitor_service(&event);
+        }
+        if (res != 0)
+        {
+            (void)ads1115_monitor_deinit();
+            (void)gpio_interrupt_deinit(&gs_gpio);
+            
+            return 1;
+        }
+        ads1115_interface_debug_print("ads1115: %u/%u.\n", i + 1, opt->times);
+        ads1115_interface_debug_print("ads1115: event %0.4fV, %s, window %d..%d.\n",
+                                      event.v, state[event.state], event.low_threshold, event.high_threshold);
+    }
+    (void)ads1115_monitor_deinit();
+    (void)gpio_interrupt_deinit(&gs_gpio);
+    
+    return 0;
+}
+
+/**
+ * @brief     run the alarm example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      one settled visit per channel and dwell
+ */
+static uint8_t a_example_alarm(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint8_t j;
+    uint32_t i;
+    uint16_t len;
+    uint32_t dwell;
+    uint32_t latency;
+    uint32_t steps;
+    uint32_t reads;
+    uint32_t latched;
+    uint64_t deadline;
+    ads1115_bool_t valid;
+    ads1115_alarm_channel_t channels[4];
+    ads1115_alarm_event_t event;
+    static const char *const kind[3] = {"cleared", "high", "low"};
+    
+    /* the same limits on the four single ended inputs */
+    for (j = 0; j < 4; j++)
+    {
+        channels[j].channel = (ads1115_channel_t)(ADS1115_CHANNEL_AIN0_GND + j);
+        channels[j].high_threshold = opt->high_threshold;
+        channels[j].low_threshold = opt->low_threshold;
+    }
+    
+    /* gpio init */
+    res = gpio_interrupt_init(&gs_gpio, GPIO_DEVICE_LINE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* alarm init */
+    res = ads1115_alarm_init(opt->addr, opt->rate, opt->queue, channels, 4);
+    if (res != 0)
+    {
+        (void)gpio_interrupt_deinit(&gs_gpio);
+        
+        return 1;
+    }
+    (void)ads1115_alarm_get_timing(&dwell, &latency);
+    ads1115_interface_debug_print("ads1115: dwell %uus, worst case latency %uus.\n", dwell, latency);
+    
+    /* drop the edges raised before the first arm */
+    len = 0;
+    (void)gpio_interrupt_read(&gs_gpio, NULL, &len);
+    deadline = ads1115_interface_timestamp_us();
+    for (i = 0; i < opt->times; )
+    {
+        /* one settled visit per channel */
+        deadline += dwell;
+        ads1115_interface_delay_until_us(deadline);
+        len = 0;
+        res = gpio_interrupt_read(&gs_gpio, NULL, &len);
+        if (res == 0)
+        {
+            res = ads1115_alarm_step((len != 0) ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE, &event, &valid);
+        }
+        if (res != 0)
+        {
+            (void)ads1115_alarm_deinit();
+            (void)gpio_interrupt_deinit(&gs_gpio);
+            
+            return 1;
+        }
+        if (valid == ADS1115_BOOL_TRUE)
+        {
+            i++;
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", i, opt->times);
+            ads1115_interface_debug_print("ads1115: channel %d %s %0.4fV.\n", event.index, kind[event.type], event.v);
+        }
+    }
+    (void)ads1115_alarm_get_counters(&steps, &reads, &latched);
+    ads1115_interface_debug_print("ads1115: %u steps, %u reads, %u latched alerts read back in range.\n", steps, reads, latched);
+    (void)ads1115_alarm_deinit();
+    (void)gpio_interrupt_deinit(&gs_gpio);
+    
+    return 0;
+}
+
+/**
+ * @brief     run the duty example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the chip and the bus sleep between the bursts
+ */
+static uint8_t a_example_duty(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t bursts;
+    uint32_t skipped;
+    uint64_t timestamp;
+    int16_t raw[ADS1115_DUTY_BURST_MAX];
+    float s;
+    ads1115_duty_config_t config;
+    ads1115_duty_estimate_t estimate;
+    
+    /* duty init */
+    config.channel = opt->channel;
+    config.period_ms = opt->period;
+    config.burst = (uint8_t)opt->burst;
+    config.noise_lsb = opt->noise;
+    res = ads1115_duty_init(opt->addr, &config, &estimate);
+    if (res != 0)
+    {
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: rate %uSPS, %uus active and %uus idle per burst.\n",
+                                  ads1115_rate_to_sps(estimate.rate), estimate.active_us, estimate.idle_us);
+    ads1115_interface_debug_print("ads1115: %0.2fnC per sample, %0.3fuA average, %u wakeups and %u transactions per burst.\n",
+                                  estimate.charge_nc, estimate.average_ua, estimate.wakeups, estimate.transactions);
+    for (i = 0; i < opt->times; i++)
+    {
+        /* sleep to the burst and read it */
+        res = ads1115_duty_read(raw, &s, &timestamp);
+        if (res != 0)
+        {
+            (void)ads1115_duty_deinit();
+            
+            return 1;
+        }
+        ads1115_interface_debug_print("ads1115: %u/%u.\n", i + 1, opt->times);
+        ads1115_interface_debug_print("ads1115: adc is %0.4fV.\n", s);
+    }
+    (void)ads1115_duty_get_counters(&bursts, &skipped);
+    ads1115_interface_debug_print("ads1115: %u bursts, %u skipped.\n", bursts, skipped);
+    (void)ads1115_duty_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     run the rms example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      a duplicate read only repeats the previous sample and is skipped
+ */
+static uint8_t a_example_rms(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t count;
+    uint32_t last = 0;
+    uint32_t windows;
+    uint32_t resyncs;
+    int16_t raw[RECORD_BLOCK];
+    uint64_t ts[RECORD_BLOCK];
+    uint32_t seq[RECORD_BLOCK];
+    float lsb = ads1115_range_to_full_scale_v(ADS1115_STREAM_DEFAULT_RANGE) / 32768.0f;
+    float period;
+    ads1115_bool_t ready;
+    ads1115_rms_t rms;
+    ads1115_rms_result_t result;
+    
+    /* a signal slower than 10 Hz closes its windows unlocked */
+    res = ads1115_rms_init(&rms, (uint16_t)opt->cycles, (uint16_t)a_volt_to_counts(opt->hysteresis),
+                           ads1115_rate_to_sps(opt->rate) * opt->cycles / 10);
+    if (res != 0)
+    {
+        return 5;
+    }
+    
+    /* stream init */
+    res = ads1115_stream_init(opt->addr, opt->channel, opt->rate);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    for (count = 0; count < opt->times; )
+    {
+        res = ads1115_stream_read_block(raw, ts, seq, RECORD_BLOCK);
+        if (res != 0)
+        {
+            (void)ads1115_stream_deinit();
+            
+            return 1;
+        }
+        for (i = 0; (i < RECORD_BLOCK) && (count < opt->times); i++)
+        {
+            /* a duplicate only repeats the previous sample */
+            if (seq[i] == last)
+            {
+                continue;
+            }
+            last = seq[i];
+            
+            /* the read times carry the jitter, the stream period does not */
+            if (ads1115_stream_get_period(&period) == 0)
+            {
+                (void)ads1115_rms_set_period(&rms, period);
+            }
+            (void)ads1115_rms_update(&rms, raw[i], seq[i], &ready);
+            if ((ready == ADS1115_BOOL_TRUE) && (ads1115_rms_get_result(&rms, &result) == 0))
+            {
+                count++;
+                ads1115_interface_debug_print("ads1115: %u/%u.\n", count, opt->times);
+                ads1115_interface_debug_print("ads1115: %d cycles at %0.3fHz, rms %0.4fV, ac %0.4fV, mean %0.4fV, crest %0.3f.\n",
+                                              result.cycles, result.frequency_hz, result.rms * lsb, result.ac_rms * lsb,
+                                              result.mean * lsb, result.crest);
+            }
+        }
+    }
+    (void)ads1115_rms_get_counters(&rms, &windows, &resyncs);
+    ads1115_interface_debug_print("ads1115: %u windows, %u resyncs.\n", windows, resyncs);
+    (void)ads1115_stream_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     run the power example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      one average per second of voltage and current pairs
+ */
+static uint8_t a_example_power(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint32_t count;
+    uint32_t pairs;
+    uint32_t skipped;
+    float energy = 0.0f;
+    ads1115_bool_t valid;
+    ads1115_power_sample_t sample;
+    ads1115_power_average_t average;
+    
+    /* two conversions per pair, one average per second */
+    res = ads1115_pair_init(opt->addr, opt->channel, opt->current_channel, opt->rate, opt->divider, 1.0f / opt->shunt,
+                            (ads1115_rate_to_sps(opt->rate) / 2 > 0) ? ads1115_rate_to_sps(opt->rate) / 2 : 1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    for (count = 0; count < opt->times; )
+    {
+        res = ads1115_pair_read(&sample, &valid);
+        if (res != 0)
+        {
+            (void)ads1115_pair_deinit();
+            
+            return 1;
+        }
+        if (ads1115_pair_get_average(&average) == 0)
+        {
+            count++;
+            energy += average.energy;
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", count, opt->times);
+            ads1115_interface_debug_print("ads1115: %u pairs, %0.4fV, %0.4fA, %0.4fW, %0.4fVA, pf %0.3f.\n",
+                                          average.pairs, average.v_rms, average.i_rms, average.p,
+                                          average.s, average.pf);
+        }
+    }
+    (void)ads1115_pair_get_counters(&pairs, &skipped);
+    ads1115_interface_debug_print("ads1115: %u pairs, %u skipped, %0.6fWh.\n", pairs, skipped, energy / 3600.0f);
+    (void)ads1115_pair_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     run the scan example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the frames are placed on the measured scan period
+ */
+static uint8_t a_example_scan(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint8_t c;
+    uint32_t count;
+    uint32_t scans;
+    uint32_t frames;
+    uint32_t skipped;
+    uint32_t period;
+    int16_t raw[4];
+    uint64_t ts[4];
+    uint64_t first = 0;
+    float lsb = ads1115_range_to_full_scale_v(ADS1115_SCAN_DEFAULT_RANGE) / 32768.0f;
+    ads1115_channel_t list[4];
+    ads1115_align_t align;
+    ads1115_align_frame_t frame;
+    
+    /* the nominal scan period places the grid until the measured one is known */
+    period = opt->channels * (1000000 / ads1115_rate_to_sps(opt->rate));
+    res = ads1115_align_init(&align, opt->channels, opt->method, period, period * 4);
+    if (res != 0)
+    {
+        return 5;
+    }
+    
+    /* scan init */
+    for (c = 0; c < opt->channels; c++)
+    {
+        list[c] = (ads1115_channel_t)(ADS1115_CHANNEL_AIN0_GND + c);
+    }
+    res = ads1115_scan_init(opt->addr, list, opt->channels, opt->rate);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    for (count = 0, scans = 0; count < opt->times; )
+    {
+        res = ads1115_scan_read(raw, ts);
+        if (res != 0)
+        {
+            (void)ads1115_scan_deinit();
+            
+            return 1;
+        }
+        
+        /* one frame per measured scan period */
+        if (scans == 0)
+        {
+            first = ts[0];
+        }
+        else
+        {
+            (void)ads1115_align_set_period(&align, (uint32_t)((ts[0] - first) / scans));
+        }
+        scans++;
+        for (c = 0; c < opt->channels; c++)
+        {
+            (void)ads1115_align_push(&align, c, raw[c], ts[c]);
+        }
+        while ((count < opt->times) && (ads1115_align_get_frame(&align, &frame) == 0))
+        {
+            count++;
+            ads1115_interface_debug_print("ads1115: %u/%u at %0.3fms.\n", count, opt->times,
+                                          (double)frame.timestamp_us / 1000.0);
+            for (c = 0; c < opt->channels; c++)
+            {
+                ads1115_interface_debug_print("ads1115: AIN%d is %0.4fV.\n", c, frame.value[c] * lsb);
+            }
+        }
+    }
+    (void)ads1115_align_get_counters(&align, &frames, &skipped);
+    ads1115_interface_debug_print("ads1115: %u scans, %u frames, %u skipped.\n", scans, frames, skipped);
+    (void)ads1115_scan_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     run the ready example
+ * @param[in] *opt points to a cli option structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the conversion ready edges count the samples and fit the conversion period
+ */
+static uint8_t a_example_ready(const cli_option_t *opt)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t len;
+    uint32_t count;
+    uint32_t seq;
+    uint32_t edges;
+    uint32_t missed;
+    uint32_t rejected;
+    uint32_t samples;
+    uint32_t duplicates;
+    uint32_t drops;
+    int16_t raw;
+    float s;
+    float period;
+    uint64_t ts[16];
+    ads1115_bool_t fresh;
+    
+    /* gpio init */
+    res = gpio_interrupt_init(&gs_gpio, GPIO_DEVICE_LINE);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* stream init with the alert pin as conversion ready */
+    res = ads1115_stream_init(opt->addr, opt->channel, opt->rate);
+    if (res != 0)
+    {
+        (void)gpio_interrupt_deinit(&gs_gpio);
+        
+        return 1;
+    }
+    res = ads1115_stream_enable_ready();
+    if (res != 0)
+    {
+        (void)ads1115_stream_deinit();
+        (void)gpio_interrupt_deinit(&gs_gpio);
+        
+        return 1;
+    }
+    
+    /* drop the edges raised before the ready pin was set */
+    len = 0;
+    (void)gpio_interrupt_read(&gs_gpio, NULL, &len);
+    for (count = 0; count < opt->times; )
+    {
+        /* two periods without an edge mean the pin is not wired */
+        res = gpio_interrupt_wait(&gs_gpio, (int32_t)(ads1115_rate_to_period_us(opt->rate) / 500 + 10));
+        if (res == 0)
+        {
+            len = 16;
+            res = gpio_interrupt_read(&gs_gpio, ts, &len);
+        }
+        if (res == 0)
+        {
+            /* edges beyond the buffer lost their time, the clock counts them from the next gap */
+            for (i = 0; (i < len) && (i < 16); i++)
+            {
+                (void)ads1115_stream_edge(ts[i] / 1000);
+            }
+            res = ads1115_stream_read_sequence(&raw, &s, &seq, &fresh);
+        }
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: no conversion ready edge.\n");
+            (void)ads1115_stream_deinit();
+            (void)gpio_interrupt_deinit(&gs_gpio);
+            
+            return 1;
+        }
+        if (fresh == ADS1115_BOOL_TRUE)
+        {
+            count++;
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", count, opt->times);
+            ads1115_interface_debug_print("ads1115: sample %u is %0.4fV.\n", seq, s);
+        }
+    }
+    (void)ads1115_stream_get_edges(&edges, &missed, &rejected);
+    (void)ads1115_stream_get_period(&period);
+    (void)ads1115_stream_get_counters(&samples, &duplicates, &drops);
+    (void)ads1115_stream_deinit();
+    (void)gpio_interrupt_deinit(&gs_gpio);
+    ads1115_interface_debug_print("ads1115: %u edges, %u missed, %u rejected.\n", edges, missed, rejected);
+    ads1115_interface_debug_print("ads1115: conversion period %0.1fus, datasheet %uus.\n",
+                                  period, ads1115_rate_to_period_us(opt->rate));
+    ads1115_interface_debug_print("ads1115: %u fresh, %u duplicated, %u dropped.\n", samples, duplicates, drops);
+    
+    return 0;
+}
+
+/**
+ * @brief      parse the cli arguments
+ * @param[in]  argc is arg numbers
+ * @param[in]  **argv is the arg address
+ * @param[out] *type points to a 33 byte run type buffer
+ * @param[out] *opt points to a cli option structure
+ * @return     status code
+ *             - 0 success
+ *             - 5 param is invalid
+ * @note       the options keep their defaults unless given
+ */
+static uint8_t a_option_parse(uint8_t argc, char **argv, char *type, cli_option_t *opt)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hipe:t:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"information", no_argument, NULL, 'i'},
+        {"port", no_argument, NULL, 'p'},
+        {"example", required_argument, NULL, 'e'},
+        {"test", required_argument, NULL, 't'},
+        {"addr", required_argument, NULL, 1},
+        {"channel", required_argument, NULL, 2},
+        {"high-threshold", required_argument, NULL, 3},
+        {"low-threshold", required_argument, NULL, 4},
+        {"mode", required_argument, NULL, 5},
+        {"times", required_argument, NULL, 6},
+        {"rate", required_argument, NULL, 7},
+        {"priority", required_argument, NULL, 8},
+        {"cpu", required_argument, NULL, 9},
+        {"shm", required_argument, NULL, 10},
+        {"output", required_argument, NULL, 11},
+        {"format", required_argument, NULL, 12},
+        {"deadband", required_argument, NULL, 13},
+        {"heartbeat", required_argument, NULL, 14},
+        {"rearm", required_argument, NULL, 15},
+        {"band", required_argument, NULL, 16},
+        {"hysteresis", required_argument, NULL, 17},
+        {"burst", required_argument, NULL, 18},
+        {"queue", required_argument, NULL, 19},
+        {"period", required_argument, NULL, 20},
+        {"noise", required_argument, NULL, 21},
+        {"trigger", required_argument, NULL, 22},
+        {"edge", required_argument, NULL, 23},
+        {"slope", required_argument, NULL, 24},
+        {"pre", required_argument, NULL, 25},
+        {"post", required_argument, NULL, 26},
+        {"cycles", required_argument, NULL, 27},
+        {"current-channel", required_argument, NULL, 28},
+        {"shunt", required_argument, NULL, 29},
+        {"divider", required_argument, NULL, 30},
+        {"channels", required_argument, NULL, 31},
+        {"method", required_argument, NULL, 32},
+        {"devices", required_argument, NULL, 33},
+        {"policy", required_argument, NULL, 34},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+                
+                break;
+            }
+            
+            /* port */
+            case 'p' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* addr */
+            case 1 :
+            {
+                /* set the addr pin */
+                if (strcmp("GND", optarg) == 0)
+                {
+                    opt->addr = ADS1115_ADDR_GND;
+                }
+                else if (strcmp("VCC", optarg) == 0)
+                {
+                    opt->addr = ADS1115_ADDR_VCC;
+                }
+                else if (strcmp("SDA", optarg) == 0)
+                {
+                    opt->addr = ADS1115_ADDR_SDA;
+                }
+                else if (strcmp("SCL", optarg) == 0)
+                {
+                    opt->addr = ADS1115_ADDR_SCL;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* channel */
+            case 2 :
+            {
+                /* set the channel */
+                if (a_parse_channel(optarg, &opt->channel) != 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* high threshold */
+            case 3 :
+            {
+                opt->high_threshold = atof(optarg);
+                
+                break;
+            }
+             
+            /* low threshold */
+            case 4 :
+            {
+                opt->low_threshold = atof(optarg);
+                
+                break;
+            }
+            
+            /* mode */
+            case 5 :
+            {
+                /* set the mode */
+                if (strcmp("WINDOW", optarg) == 0)
+                {
+                    opt->compare = ADS1115_COMPARE_WINDOW;
+                }
+                else if (strcmp("THRESHOLD", optarg) == 0)
+                {
+                    opt->compare = ADS1115_COMPARE_THRESHOLD;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* running times */
+            case 6 :
+            {
+                /* set the times */
+                opt->times = atol(optarg);
+                
+                break;
+            } 
+            
+            /* rate */
+            case 7 :
+            {
+                uint8_t i;
+                
+                /* set the rate */
+                for (i = 0; i < 8; i++)
+                {
+                    if (ads1115_rate_to_sps((ads1115_rate_t)i) == (uint32_t)atol(optarg))
+                    {
+                        opt->rate = (ads1115_rate_t)i;
+                        
+                        break;
+                    }
+                }
+                if (i == 8)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* priority */
+            case 8 :
+            {
+                /* set the priority */
+                opt->priority = atoi(optarg);
+                if ((opt->priority < 0) || (opt->priority > 99))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* cpu */
+            case 9 :
+            {
+                /* set the cpu */
+                opt->cpu = atoi(optarg);
+                
+                break;
+            }
+            
+            /* shm */
+            case 10 :
+            {
+                /* set the shm ring name */
+                memset(opt->shm, 0, sizeof(char) * SHM_RING_NAME_MAX);
+                snprintf(opt->shm, SHM_RING_NAME_MAX, "%s", optarg);
+                
+                break;
+            }
+            
+            /* output */
+            case 11 :
+            {
+                /* set the record output */
+                memset(opt->output, 0, sizeof(char) * 256);
+                snprintf(opt->output, 256, "%s", optarg);
+                
+                break;
+            }
+            
+            /* format */
+            case 12 :
+            {
+                /* set the record format */
+                if (strcmp("record", optarg) == 0)
+                {
+                    opt->capture = 0;
+                    opt->packed = 0;
+                }
+                else if (strcmp("packed", optarg) == 0)
+                {
+                    opt->capture = 0;
+                    opt->packed = 1;
+                }
+                else if (strcmp("capture", optarg) == 0)
+                {
+                    opt->capture = 1;
+                    opt->packed = 0;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* deadband */
+            case 13 :
+            {
+                /* set the deadband in raw counts */
+                opt->deadband = atoi(optarg);
+                if ((opt->deadband < 0) || (opt->deadband > 65535))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* heartbeat */
+            case 14 :
+            {
+                /* set the heartbeat in ms */
+                opt->heartbeat = atol(optarg);
+                
+                break;
+            }
+            
+            /* rearm */
+            case 15 :
+            {
+                /* set the rearm policy */
+                if (strcmp("TRACK", optarg) == 0)
+                {
+                    opt->rearm = ADS1115_MONITOR_REARM_TRACK;
+                }
+                else if (strcmp("LIMIT", optarg) == 0)
+                {
+                    opt->rearm = ADS1115_MONITOR_REARM_LIMIT;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* band */
+            case 16 :
+            {
+                opt->band = atof(optarg);
+                
+                break;
+            }
+            
+            /* hysteresis */
+            case 17 :
+            {
+                opt->hysteresis = atof(optarg);
+                
+                break;
+            }
+            
+            /* burst */
+            case 18 :
+            {
+                /* set the conversions per event */
+                opt->burst = atol(optarg);
+                if ((opt->burst == 0) || (opt->burst > ADS1115_MONITOR_BURST_MAX))
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* queue */
+            case 19 :
+            {
+                /* set the comparator queue */
+                if (strcmp("1", optarg) == 0)
+                {
+                    opt->queue = ADS1115_COMPARATOR_QUEUE_1_CONV;
+                }
+                else if (strcmp("2", optarg) == 0)
+                {
+                    opt->queue = ADS1115_COMPARATOR_QUEUE_2_CONV;
+                }
+                else if (strcmp("4", optarg) == 0)
+                {
+                    opt->queue = ADS1115_COMPARATOR_QUEUE_4_CONV;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* period */
+            case 20 :
+            {
+                /* set the burst period in ms */
+                opt->period = atol(optarg);
+                if (opt->period == 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* noise */
+            case 21 :
+            {
+                opt->noise = atof(optarg);
+                
+                break;
+            }
+            
+            /* trigger */
+            case 22 :
+            {
+                /* set the trigger type */
+                opt->trigger = 1;
+                if (strcmp("NONE", optarg) == 0)
+                {
+                    opt->trigger = 0;
+                }
+                else if (strcmp("LEVEL", optarg) == 0)
+                {
+                    opt->trigger_type = ADS1115_TRIGGER_TYPE_LEVEL;
+                }
+                else if (strcmp("EDGE", optarg) == 0)
+                {
+                    opt->trigger_type = ADS1115_TRIGGER_TYPE_EDGE;
+                }
+                else if (strcmp("WINDOW", optarg) == 0)
+                {
+                    opt->trigger_type = ADS1115_TRIGGER_TYPE_WINDOW;
+                }
+                else if (strcmp("SLOPE", optarg) == 0)
+                {
+                    opt->trigger_type = ADS1115_TRIGGER_TYPE_SLOPE;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* edge */
+            case 23 :
+            {
+                /* set the trigger direction */
+                if (strcmp("RISING", optarg) == 0)
+                {
+                    opt->edge = ADS1115_TRIGGER_EDGE_RISING;
+                }
+                else if (strcmp("FALLING", optarg) == 0)
+                {
+                    opt->edge = ADS1115_TRIGGER_EDGE_FALLING;
+                }
+                else if (strcmp("BOTH", optarg) == 0)
+                {
+                    opt->edge = ADS1115_TRIGGER_EDGE_BOTH;
+                }
+                else
+                {
+                    return 5;
+                }
                 
                 break;
             }
             
-            /* information */
-            case 'i' :
+            /* slope */
+            case 24 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "i");
+                opt->slope = atof(optarg);
                 
                 break;
             }
             
-            /* port */
-            case 'p' :
+            /* pre */
+            case 25 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "p");
+                /* set the pre trigger samples */
+                opt->pre = atol(optarg);
                 
                 break;
             }
             
-            /* example */
-            case 'e' :
+            /* post */
+            case 26 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "e_%s", optarg);
+                /* set the post trigger samples */
+                opt->post = atol(optarg);
                 
                 break;
             }
             
-            /* test */
-            case 't' :
+            /* cycles */
+            case 27 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "t_%s", optarg);
+                /* set the cycles per rms window */
+                opt->cycles = atol(optarg);
+                if ((opt->cycles == 0) || (opt->cycles > 0xFFFF))
+                {
+                    return 5;
+                }
                 
                 break;
             }
             
-            /* addr */
-            case 1 :
+            /* current channel */
+            case 28 :
             {
-                /* set the addr pin */
-                if (strcmp("GND", optarg) == 0)
-                {
-                    addr = ADS1115_ADDR_GND;
-                }
-                else if (strcmp("VCC", optarg) == 0)
-                {
-                    addr = ADS1115_ADDR_VCC;
-                }
-                else if (strcmp("SDA", optarg) == 0)
-                {
-                    addr = ADS1115_ADDR_SDA;
-                }
-                else if (strcmp("SCL", optarg) == 0)
-                {
-                    addr = ADS1115_ADDR_SCL;
-                }
-                else
+                /* set the power current channel */
+                if (a_parse_channel(optarg, &opt->current_channel) != 0)
                 {
                     return 5;
                 }
@@ -185,41 +2040,56 @@ uint8_t ads1115(uint8_t argc, char **argv)
                 break;
             }
             
-            /* channel */
-            case 2 :
+            /* shunt */
+            case 29 :
             {
-                /* set the channel */
-                if (strcmp("AIN0_AIN1", optarg) == 0)
-                {
-                    channel = ADS1115_CHANNEL_AIN0_AIN1;
-                }
-                else if (strcmp("AIN0_AIN3", optarg) == 0)
-                {
-                    channel = ADS1115_CHANNEL_AIN0_AIN3;
-                }
-                else if (strcmp("AIN1_AIN3", optarg) == 0)
+                /* set the current shunt in ohm */
+                opt->shunt = atof(optarg);
+                if (opt->shunt <= 0.0f)
                 {
-                    channel = ADS1115_CHANNEL_AIN1_AIN3;
-                }
-                else if (strcmp("AIN2_AIN3", optarg) == 0)
-                {
-                    channel = ADS1115_CHANNEL_AIN2_AIN3;
+                    return 5;
                 }
-                else if (strcmp("AIN0_GND", optarg) == 0)
+                
+                break;
+            }
+            
+            /* divider */
+            case 30 :
+            {
+                /* set the voltage divider ratio */
+                opt->divider = atof(optarg);
+                if (opt->divider <= 0.0f)
                 {
-                    channel = ADS1115_CHANNEL_AIN0_GND;
+                    return 5;
                 }
-                else if (strcmp("AIN1_GND", optarg) == 0)
+                
+                break;
+            }
+            
+            /* channels */
+            case 31 :
+            {
+                /* set the scanned channels from AIN0_GND on */
+                opt->channels = (uint8_t)atoi(optarg);
+                if ((opt->channels == 0) || (opt->channels > 4))
                 {
-                    channel = ADS1115_CHANNEL_AIN1_GND;
+                    return 5;
                 }
-                else if (strcmp("AIN2_GND", optarg) == 0)
+                
+                break;
+            }
+            
+            /* method */
+            case 32 :
+            {
+                /* set the align method */
+                if (strcmp("LINEAR", optarg) == 0)
                 {
-                    channel = ADS1115_CHANNEL_AIN2_GND;
+                    opt->method = ADS1115_ALIGN_METHOD_LINEAR;
                 }
-                else if (strcmp("AIN3_GND", optarg) == 0)
+                else if (strcmp("CUBIC", optarg) == 0)
                 {
-                    channel = ADS1115_CHANNEL_AIN3_GND;
+                    opt->method = ADS1115_ALIGN_METHOD_CUBIC;
                 }
                 else
                 {
@@ -229,33 +2099,30 @@ uint8_t ads1115(uint8_t argc, char **argv)
                 break;
             }
             
-            /* high threshold */
-            case 3 :
-            {
-                high_threshold = atof(optarg);
-                
-                break;
-            }
-             
-            /* low threshold */
-            case 4 :
+            /* devices */
+            case 33 :
             {
-                low_threshold = atof(optarg);
+                /* set the device number from the addr pin on */
+                opt->devices = (uint8_t)atoi(optarg);
+                if ((opt->devices == 0) || (opt->devices > 4))
+                {
+                    return 5;
+                }
                 
                 break;
             }
             
-            /* mode */
-            case 5 :
+            /* policy */
+            case 34 :
             {
-                /* set the mode */
-                if (strcmp("WINDOW", optarg) == 0)
+                /* set the scheduling policy */
+                if (strcmp("EDF", optarg) == 0)
                 {
-                    compare = ADS1115_COMPARE_WINDOW;
+                    opt->policy = ADS1115_SCHEDULER_POLICY_EDF;
                 }
-                else if (strcmp("THRESHOLD", optarg) == 0)
+                else if (strcmp("RM", optarg) == 0)
                 {
-                    compare = ADS1115_COMPARE_THRESHOLD;
+                    opt->policy = ADS1115_SCHEDULER_POLICY_RM;
                 }
                 else
                 {
@@ -265,15 +2132,6 @@ uint8_t ads1115(uint8_t argc, char **argv)
                 break;
             }
             
-            /* running times */
-            case 6 :
-            {
-                /* set the times */
-                times = atol(optarg);
-                
-                break;
-            } 
-            
             /* the end */
             case -1 :
             {
@@ -287,12 +2145,46 @@ uint8_t ads1115(uint8_t argc, char **argv)
             }
         }
     } while (c != -1);
+    
+    return 0;
+}
+
+/**
+ * @brief     ads1115 full function
+ * @param[in] argc is arg numbers
+ * @param[in] **argv is the arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t ads1115(uint8_t argc, char **argv)
+{
+    char type[33] = "unknown";
+    cli_option_t option;
+    
+    /* set the default options */
+    a_option_init(&option);
+    
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+    
+    /* parse the args */
+    if (a_option_parse(argc, argv, type, &option) != 0)
+    {
+        return 5;
+    }
 
     /* run the function */
     if (strcmp("t_reg", type) == 0)
     {
         /* run the reg test */
-        if (ads1115_register_test(addr) != 0)
+        if (ads1115_register_test(option.addr) != 0)
         {
             return 1;
         }
@@ -304,7 +2196,7 @@ uint8_t ads1115(uint8_t argc, char **argv)
     else if (strcmp("t_read", type) == 0)
     {
         /* run the read test */
-        if (ads1115_read_test(addr, times) != 0)
+        if (ads1115_read_test(option.addr, option.times) != 0)
         {
             return 1;
         }
@@ -316,7 +2208,127 @@ uint8_t ads1115(uint8_t argc, char **argv)
     else if (strcmp("t_muti", type) == 0)
     {
         /* run the multichannel test */
-        if (ads1115_multichannel_test(addr, channel, times) != 0)
+        if (ads1115_multichannel_test(option.addr, option.channel, option.times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_codec", type) == 0)
+    {
+        /* run the codec test */
+        if (ads1115_codec_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_clock", type) == 0)
+    {
+        /* run the clock test */
+        if (ads1115_clock_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_executor", type) == 0)
+    {
+        /* run the executor test */
+        if (ads1115_executor_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_scheduler", type) == 0)
+    {
+        /* run the scheduler test */
+        if (ads1115_scheduler_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sequence", type) == 0)
+    {
+        /* run the sequence test */
+        if (ads1115_sequence_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_deadband", type) == 0)
+    {
+        /* run the deadband test */
+        if (ads1115_deadband_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_trigger", type) == 0)
+    {
+        /* run the trigger test */
+        if (ads1115_trigger_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_rms", type) == 0)
+    {
+        /* run the rms test */
+        if (ads1115_rms_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_power", type) == 0)
+    {
+        /* run the power test */
+        if (ads1115_power_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_align", type) == 0)
+    {
+        /* run the align test */
+        if (ads1115_align_test() != 0)
         {
             return 1;
         }
@@ -330,21 +2342,21 @@ uint8_t ads1115(uint8_t argc, char **argv)
         uint8_t res;
         
         /* gpio init */
-        res = gpio_interrupt_init();
+        res = gpio_interrupt_init(&gs_gpio, GPIO_DEVICE_LINE);
         if (res != 0)
         {
             return 1;
         }
         
         /* run the compare interrupt test */
-        res = ads1115_compare_test(addr, channel, compare, high_threshold, low_threshold, times);
+        res = ads1115_compare_test(option.addr, option.channel, option.compare, option.high_threshold, option.low_threshold, option.times);
         if (res != 0)
         {
-            (void)gpio_interrupt_deinit();
+            (void)gpio_interrupt_deinit(&gs_gpio);
             
             return 1;
         }
-        (void)gpio_interrupt_deinit();
+        (void)gpio_interrupt_deinit(&gs_gpio);
         
         return 0;
     }
@@ -352,17 +2364,19 @@ uint8_t ads1115(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        uint64_t next;
         float s;
         
         /* basic init */
-        res = ads1115_basic_init(addr, channel);
+        res = ads1115_basic_init(option.addr, option.channel);
         if (res != 0)
         {
             ads1115_interface_debug_print("ads1115: basic init failed.\n");
             
             return 1;
         }
-        for (i = 0; i < times; i++)
+        next = ads1115_interface_timestamp_us();
+        for (i = 0; i < option.times; i++)
         {
             /* read the data */
             res = ads1115_basic_read((float *)&s);
@@ -373,9 +2387,10 @@ uint8_t ads1115(uint8_t argc, char **argv)
                 
                 return 1;
             }
-            ads1115_interface_debug_print("ads1115: %d/%d.\n", i + 1, times);
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", i + 1, option.times);
             ads1115_interface_debug_print("ads1115: adc is %0.4fV.\n", s);
-            ads1115_interface_delay_ms(1000);
+            next += 1000000;
+            ads1115_interface_delay_until_us(next);
         }
         (void)ads1115_basic_deinit();
         
@@ -385,17 +2400,19 @@ uint8_t ads1115(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
+        uint64_t next;
         float s;
         
         /* shot init */
-        res = ads1115_shot_init(addr, channel);
+        res = ads1115_shot_init(option.addr, option.channel);
         if (res != 0)
         {
             ads1115_interface_debug_print("ads1115: basic init failed.\n");
             
             return 1;
         }
-        for (i = 0; i < times; i++)
+        next = ads1115_interface_timestamp_us();
+        for (i = 0; i < option.times; i++)
         {
             /* read the data */
             res = ads1115_shot_read((float *)&s);
@@ -406,14 +2423,19 @@ uint8_t ads1115(uint8_t argc, char **argv)
                 
                 return 1;
             }
-            ads1115_interface_debug_print("ads1115: %d/%d.\n", i + 1, times);
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", i + 1, option.times);
             ads1115_interface_debug_print("ads1115: adc is %0.4fV.\n", s);
-            ads1115_interface_delay_ms(1000);
+            next += 1000000;
+            ads1115_interface_delay_until_us(next);
         }
         (void)ads1115_shot_deinit();
         
         return 0;
     }
+    else if (strcmp("e_duty", type) == 0)
+    {
+        return a_example_duty(&option);
+    }
     else if (strcmp("e_int", type) == 0)
     {
         uint8_t res;
@@ -421,14 +2443,14 @@ uint8_t ads1115(uint8_t argc, char **argv)
         float s;
         
         /* interrupt init */
-        res = ads1115_interrupt_init(addr, channel, compare, high_threshold, low_threshold);
+        res = ads1115_interrupt_init(option.addr, option.channel, option.compare, option.high_threshold, option.low_threshold);
         if (res != 0)
         {
             return 1;
         }
         
         /* gpio init */
-        res = gpio_interrupt_init();
+        res = gpio_interrupt_init(&gs_gpio, GPIO_DEVICE_LINE);
         if (res != 0)
         {
             (void)ads1115_interrupt_deinit();
@@ -436,36 +2458,95 @@ uint8_t ads1115(uint8_t argc, char **argv)
             return 1;
         }
         
-        g_flag = 0;
-        for (i = 0; i < times; i++)
+        for (i = 0; i < option.times; i++)
         {
+            uint16_t len;
+            uint64_t timestamp;
+            
+            /* wait for the alert pin at most 1s */
+            res = gpio_interrupt_wait(&gs_gpio, 1000);
+            if (res == 1)
+            {
+                (void)ads1115_interrupt_deinit();
+                (void)gpio_interrupt_deinit(&gs_gpio);
+                
+                return 1;
+            }
+            
             /* read data */
-            ads1115_interface_delay_ms(1000);
             res = ads1115_interrupt_read((float *)&s);
             if (res != 0)
             {
                 (void)ads1115_interrupt_deinit();
-                (void)gpio_interrupt_deinit();
+                (void)gpio_interrupt_deinit(&gs_gpio);
                 
                 return 1;
             }
-            ads1115_interface_debug_print("ads1115: %d/%d.\n", i + 1, times);
+            ads1115_interface_debug_print("ads1115: %u/%u.\n", i + 1, option.times);
             ads1115_interface_debug_print("ads1115: read is %0.4fV.\n", s);
             
             /* check interrupt */
-            if (g_flag != 0)
+            len = 1;
+            res = gpio_interrupt_read(&gs_gpio, &timestamp, &len);
+            if (res != 0)
+            {
+                (void)ads1115_interrupt_deinit();
+                (void)gpio_interrupt_deinit(&gs_gpio);
+                
+                return 1;
+            }
+            if (len != 0)
             {
                 ads1115_interface_debug_print("ads1115: find interrupt.\n");
                 
                 break;
             }
-            
         }
         (void)ads1115_interrupt_deinit();
-        (void)gpio_interrupt_deinit();
+        (void)gpio_interrupt_deinit(&gs_gpio);
         
         return 0;
     }
+    else if (strcmp("e_monitor", type) == 0)
+    {
+        return a_example_monitor(&option);
+    }
+    else if (strcmp("e_alarm", type) == 0)
+    {
+        return a_example_alarm(&option);
+    }
+    else if (strcmp("e_rt", type) == 0)
+    {
+        return a_example_rt(&option);
+    }
+    else if (strcmp("e_rms", type) == 0)
+    {
+        return a_example_rms(&option);
+    }
+    else if (strcmp("e_power", type) == 0)
+    {
+        return a_example_power(&option);
+    }
+    else if (strcmp("e_scan", type) == 0)
+    {
+        return a_example_scan(&option);
+    }
+    else if (strcmp("e_async", type) == 0)
+    {
+        return a_example_async(&option);
+    }
+    else if (strcmp("e_schedule", type) == 0)
+    {
+        return a_example_schedule(&option);
+    }
+    else if (strcmp("e_record", type) == 0)
+    {
+        return a_example_record(&option);
+    }
+    else if (strcmp("e_ready", type) == 0)
+    {
+        return a_example_ready(&option);
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -480,29 +2561,106 @@ uint8_t ads1115(uint8_t argc, char **argv)
         ads1115_interface_debug_print("  ads1115 (-t int | --test=int) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
         ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
         ads1115_interface_debug_print("          [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        ads1115_interface_debug_print("  ads1115 (-t codec | --test=codec)\n");
+        ads1115_interface_debug_print("  ads1115 (-t clock | --test=clock)\n");
+        ads1115_interface_debug_print("  ads1115 (-t executor | --test=executor)\n");
+        ads1115_interface_debug_print("  ads1115 (-t scheduler | --test=scheduler)\n");
+        ads1115_interface_debug_print("  ads1115 (-t sequence | --test=sequence)\n");
+        ads1115_interface_debug_print("  ads1115 (-t deadband | --test=deadband)\n");
+        ads1115_interface_debug_print("  ads1115 (-t trigger | --test=trigger)\n");
+        ads1115_interface_debug_print("  ads1115 (-t rms | --test=rms)\n");
+        ads1115_interface_debug_print("  ads1115 (-t power | --test=power)\n");
+        ads1115_interface_debug_print("  ads1115 (-t align | --test=align)\n");
         ads1115_interface_debug_print("  ads1115 (-e read | --example=read) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
         ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
         ads1115_interface_debug_print("  ads1115 (-e shot | --example=shot) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
         ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e duty | --example=duty) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--period=<ms>] [--burst=<n>] [--noise=<lsb>]\n");
         ads1115_interface_debug_print("  ads1115 (-e int | --example=int) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
         ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
         ads1115_interface_debug_print("          [--mode=<THRESHOLD | WINDOW>] [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e monitor | --example=monitor) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--rearm=<TRACK | LIMIT>] [--band=<v>] \n");
+        ads1115_interface_debug_print("          [--low-threshold=<low>] [--high-threshold=<high>] [--hysteresis=<v>] [--burst=<n>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e alarm | --example=alarm) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--queue=<1 | 2 | 4>] \n");
+        ads1115_interface_debug_print("          [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e rt | --example=rt) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--priority=<prio>] [--cpu=<cpu>] [--shm=<name>]\n");
+        ads1115_interface_debug_print("          [--deadband=<counts>] [--heartbeat=<ms>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e rms | --example=rms) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--cycles=<n>] [--hysteresis=<v>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e power | --example=power) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--current-channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--shunt=<ohm>] [--divider=<ratio>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e scan | --example=scan) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--channels=<1 | 2 | 3 | 4>] [--method=<LINEAR | CUBIC>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e async | --example=async) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--devices=<1 | 2 | 3 | 4>] [--channels=<1 | 2 | 3 | 4>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e schedule | --example=schedule) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--devices=<1 | 2 | 3 | 4>] [--period=<ms>] [--policy=<EDF | RM>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e record | --example=record) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>] [--output=<path | ->] [--format=<record | packed | capture>]\n");
+        ads1115_interface_debug_print("          [--trigger=<NONE | LEVEL | EDGE | WINDOW | SLOPE>] [--edge=<RISING | FALLING | BOTH>] [--slope=<v>]\n");
+        ads1115_interface_debug_print("          [--pre=<n>] [--post=<n>] [--low-threshold=<low>] [--high-threshold=<high>]\n");
+        ads1115_interface_debug_print("  ads1115 (-e ready | --example=ready) [--times=<num>] [--addr=<VCC | GND | SCL | SDA>] \n");
+        ads1115_interface_debug_print("          [--channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>] \n");
+        ads1115_interface_debug_print("          [--rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>]\n");
         ads1115_interface_debug_print("\n");
         ads1115_interface_debug_print("Options:\n");
         ads1115_interface_debug_print("      --addr==<VCC | GND | SCL | SDA>    Set the connection of the addr pin.([default: GND])\n");
+        ads1115_interface_debug_print("      --band=<v>                         Set the monitor window half width in V.([default: 0.01])\n");
+        ads1115_interface_debug_print("      --burst=<n>                        Set the conversions averaged per monitor event or duty burst, at most 16.([default: 4])\n");
         ads1115_interface_debug_print("      --channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>\n");
-        ads1115_interface_debug_print("                                         Set the ADC channel.([default: AIN0_GND])\n");
-        ads1115_interface_debug_print("  -e <read | shot | int>, --example=<read | shot | int>\n");
+        ads1115_interface_debug_print("                                         Set the ADC channel, the voltage channel of power.([default: AIN0_GND])\n");
+        ads1115_interface_debug_print("      --channels=<1 | 2 | 3 | 4>         Set the scanned or async channels from AIN0_GND on.([default: 4])\n");
+        ads1115_interface_debug_print("      --cpu=<cpu>                        Pin the acquisition thread to a cpu.([default: none])\n");
+        ads1115_interface_debug_print("      --current-channel=<AIN0_AIN1 | AIN0_AIN3 | AIN1_AIN3 | AIN2_AIN3 | AIN0_GND | AIN1_GND | AIN2_GND | AIN3_GND>\n");
+        ads1115_interface_debug_print("                                         Set the power current shunt channel, converted at 0.256V range.([default: AIN1_GND])\n");
+        ads1115_interface_debug_print("      --cycles=<n>                       Set the mains cycles per rms window.([default: 10])\n");
+        ads1115_interface_debug_print("      --deadband=<counts>                Publish a sample only when it moves by more than counts.([default: none])\n");
+        ads1115_interface_debug_print("      --devices=<1 | 2 | 3 | 4>          Set the async or scheduled devices from the addr pin on in GND, VCC, SDA, SCL order.([default: 1])\n");
+        ads1115_interface_debug_print("      --divider=<ratio>                  Set the power voltage divider ratio, converted at 2.048V range.([default: 1.0])\n");
+        ads1115_interface_debug_print("      --edge=<RISING | FALLING | BOTH>   Set the record trigger direction, BOTH is not for LEVEL.([default: RISING])\n");
+        ads1115_interface_debug_print("  -e <read | shot | duty | int | monitor | alarm | rt | rms | power | scan | async | schedule | record | ready>, --example=<read | shot | duty | int | monitor | alarm | rt | rms | power | scan | async | schedule | record | ready>\n");
         ads1115_interface_debug_print("                                         Run the driver example.\n");
+        ads1115_interface_debug_print("      --format=<record | packed | capture>\n");
+        ads1115_interface_debug_print("                                         Set the record file format, capture needs a file.([default: record])\n");
         ads1115_interface_debug_print("  -h, --help                             Show the help.\n");
+        ads1115_interface_debug_print("      --heartbeat=<ms>                   Publish a sample at least every ms with a deadband.([default: none])\n");
         ads1115_interface_debug_print("      --high-threshold=<high>            Set the ADC interrupt high threshold.([default: 0.0f])\n");
+        ads1115_interface_debug_print("      --hysteresis=<v>                   Set the V a crossed monitor limit or an rms zero crossing must be recrossed by.([default: 0.0])\n");
         ads1115_interface_debug_print("  -i, --information                      Show the chip information.\n");
         ads1115_interface_debug_print("      --low-threshold=<low>              Set the ADC interrupt low threshold.([default: 0.0f])\n");
+        ads1115_interface_debug_print("      --method=<LINEAR | CUBIC>          Set the scan align interpolation, CUBIC lags one more scan.([default: LINEAR])\n");
         ads1115_interface_debug_print("      --mode=<THRESHOLD | WINDOW>        Set the ADC interrupt mode.([default: THRESHOLD])\n");
+        ads1115_interface_debug_print("      --noise=<lsb>                      Set the peak to peak noise target of a duty burst mean in LSB.([default: 1.0])\n");
+        ads1115_interface_debug_print("      --output=<path | ->                Set the record file, - means stdout.([default: -])\n");
+        ads1115_interface_debug_print("      --period=<ms>                      Set the time between duty bursts or the AIN0_GND schedule period in ms.([default: 1000])\n");
+        ads1115_interface_debug_print("      --policy=<EDF | RM>                Set the schedule policy, earliest deadline first or rate monotonic.([default: EDF])\n");
         ads1115_interface_debug_print("  -p, --port                             Display the pin connections of the current board.\n");
-        ads1115_interface_debug_print("  -t <reg | read | muti | int>, --test=<reg | read | muti | int>.\n");
+        ads1115_interface_debug_print("      --post=<n>                         Set the record trigger samples from the trigger sample on.([default: 768])\n");
+        ads1115_interface_debug_print("      --pre=<n>                          Set the record trigger samples kept before the trigger.([default: 256])\n");
+        ads1115_interface_debug_print("      --priority=<prio>                  Set the SCHED_FIFO priority with locked memory, 0 means normal and unlocked.([default: 80])\n");
+        ads1115_interface_debug_print("      --queue=<1 | 2 | 4>                Set the alarm comparator queue in conversions.([default: 2])\n");
+        ads1115_interface_debug_print("      --rate=<8 | 16 | 32 | 64 | 128 | 250 | 475 | 860>\n");
+        ads1115_interface_debug_print("                                         Set the sample rate in SPS.([default: 860])\n");
+        ads1115_interface_debug_print("      --rearm=<TRACK | LIMIT>            Set the monitor rearm policy, follow every change or watch the thresholds.([default: TRACK])\n");
+        ads1115_interface_debug_print("      --shm=<name>                       Publish the samples to a shared memory ring such as /ads1115.([default: none])\n");
+        ads1115_interface_debug_print("      --shunt=<ohm>                      Set the power current shunt in ohm.([default: 0.1])\n");
+        ads1115_interface_debug_print("      --slope=<v>                        Set the V change per sample of a SLOPE trigger.([default: 0.01])\n");
+        ads1115_interface_debug_print("  -t <reg | read | muti | int | codec | clock | executor | scheduler | sequence | deadband | trigger | rms | power | align>, --test=<reg | read | muti | int | codec | clock | executor | scheduler | sequence | deadband | trigger | rms | power | align>.\n");
         ads1115_interface_debug_print("                                         Run the driver test.\n");
         ads1115_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
+        ads1115_interface_debug_print("      --trigger=<NONE | LEVEL | EDGE | WINDOW | SLOPE>\n");
+        ads1115_interface_debug_print("                                         Record only the windows around a trigger, LEVEL and EDGE use the high threshold.([default: NONE])\n");
         
         return 0;
     }
@@ -41,6 +41,12 @@
 #include "uart.h"
 #include <stdarg.h>
 
+/**
+ * @brief timestamp extension definition
+ */
+static volatile uint32_t gs_tick_last = 0;         /**< last HAL tick seen */
+static volatile uint32_t gs_tick_wraps = 0;        /**< HAL tick wraps, the high word of the ms count */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -107,6 +113,69 @@ void ads1115_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return monotonic time in us
+ * @note   HAL tick plus the SysTick count, HCLK is 168MHz,
+ *         the 32 bit ms tick wraps after 49.7 days and is extended to 64 bits by a wrap counter,
+ *         which needs one call per wrap period
+ */
+uint64_t ads1115_interface_timestamp_us(void)
+{
+    uint32_t tick;
+    uint32_t val;
+    uint32_t high;
+    uint32_t primask;
+    
+    /* read the tick again when it moved while the counter was read */
+    do
+    {
+        tick = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (tick != HAL_GetTick());
+    
+    /* extend the tick, a reading older than the last one keeps the high word it was taken in */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if ((int32_t)(tick - gs_tick_last) >= 0)
+    {
+        if (tick < gs_tick_last)
+        {
+            gs_tick_wraps++;
+        }
+        gs_tick_last = tick;
+        high = gs_tick_wraps;
+    }
+    else
+    {
+        high = (tick > gs_tick_last) ? (gs_tick_wraps - 1) : gs_tick_wraps;
+    }
+    __set_PRIMASK(primask);
+    
+    return (((uint64_t)high << 32) | tick) * 1000ULL + (uint64_t)((SysTick->LOAD - val) / 168);
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us is the monotonic wake time in us
+ * @note      returns at once when the deadline has passed
+ */
+void ads1115_interface_delay_until_us(uint64_t deadline_us)
+{
+    uint64_t now;
+    
+    now = ads1115_interface_timestamp_us();
+    if (deadline_us > now + 2000)
+    {
+        /* sleep the whole ms first */
+        delay_ms((uint32_t)((deadline_us - now) / 1000) - 1);
+    }
+    while (ads1115_interface_timestamp_us() < deadline_us)
+    {
+        
+    }
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt is the format data
@@ -126,3 +195,23 @@ void ads1115_interface_debug_print(const char *const fmt, ...)
     len = strlen((char *)str);
     (void)uart_write((uint8_t *)str, len);
 }
+
+/**
+ * @brief     interface bus lock
+ * @param[in] *bus points to the bus lock argument
+ * @note      single thread, nothing to lock
+ */
+void ads1115_interface_lock(void *bus)
+{
+    (void)bus;
+}
+
+/**
+ * @brief     interface bus unlock
+ * @param[in] *bus points to the bus lock argument
+ * @note      single thread, nothing to unlock
+ */
+void ads1115_interface_unlock(void *bus)
+{
+    (void)bus;
+}
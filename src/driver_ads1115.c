@@ -57,6 +57,11 @@
 #define ADS1115_REG_LOWRESH         0x02        /**< interrupt low threshold register */
 #define ADS1115_REG_HIGHRESH        0x03        /**< interrupt high threshold register */
 
+/**
+ * @brief shadow config word definition
+ */
+#define ADS1115_SHADOW_VALID        (1UL << 16)        /**< shadow valid bit above the 16 config bits */
+
 /**
  * @brief iic address definition
  */
@@ -66,16 +71,192 @@
 #define ADS1115_ADDRESS4        (0x4B << 1)        /**< iic address 4 */
 
 /**
- * @brief      read multiple bytes
+ * @brief conversion period table definition
+ */
+static const uint32_t gs_conversion_period_us[8] =
+{
+    125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163,
+};
+
+/**
+ * @brief nominal sample rate table definition
+ */
+static const uint32_t gs_rate_sps[8] =
+{
+    8, 16, 32, 64, 128, 250, 475, 860,
+};
+
+/**
+ * @brief full scale range table definition
+ */
+static const float gs_full_scale_v[6] =
+{
+    6.144f, 4.096f, 2.048f, 1.024f, 0.512f, 0.256f,
+};
+
+/**
+ * @brief      convert a raw adc value with the range of the config register
+ * @param[in]  conf is the config register value
+ * @param[in]  raw is the raw adc value
+ * @param[out] *v points to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 range is invalid
+ * @note       none
+ */
+static uint8_t a_ads1115_raw_to_voltage(uint16_t conf, int16_t raw, float *v)
+{
+    uint8_t range;
+    
+    range = (uint8_t)((conf >> 9) & 0x07);                           /* get range conf */
+    if (range > ADS1115_RANGE_0P256V)                                /* check range */
+    {
+        return 1;                                                    /* return error */
+    }
+    *v = (float)(raw) * gs_full_scale_v[range] / 32768.0f;           /* get convert adc */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     get the measured conversion period of a rate
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] rate is the data rate field
+ * @return    period in us, 0 when no period has been measured
+ * @note      the oscillator scale holds for every rate
+ */
+static uint32_t a_ads1115_measured_period_us(ads1115_handle_t *handle, uint8_t rate)
+{
+    return (uint32_t)(((uint64_t)gs_conversion_period_us[rate & 0x07] * handle->oscillator_scale + 0x8000) >> 16);
+}
+
+/**
+ * @brief     get the conversion wait time
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] conf is the config register value
+ * @return    wait time in us
+ * @note      the datasheet period is extended by the 10% oscillator tolerance
+ *            when no measured period has been set, a measured period keeps a 2% margin
+ *            so a slightly wrong scale does not read the conversion before it completes
+ */
+static uint32_t a_ads1115_conversion_wait_us(ads1115_handle_t *handle, uint16_t conf)
+{
+    uint32_t us;
+    uint8_t rate;
+    
+    rate = (uint8_t)((conf >> 5) & 0x07);                            /* get rate conf */
+    if (handle->oscillator_scale != 0)                               /* check measured scale */
+    {
+        us = a_ads1115_measured_period_us(handle, rate);             /* use measured period */
+        us += us / 50;                                               /* add measurement margin */
+    }
+    else
+    {
+        us = gs_conversion_period_us[rate];                          /* get datasheet period */
+        us += us / 10;                                               /* add oscillator tolerance */
+    }
+    
+    return us;                                                       /* return wait time */
+}
+
+/**
+ * @brief     wait a number of us
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] us is the wait time
+ * @note      sleeps to an absolute deadline when the us links exist, else rounds up to whole ms
+ */
+static void a_ads1115_wait_us(ads1115_handle_t *handle, uint32_t us)
+{
+    if ((handle->timestamp_us != NULL) && (handle->delay_until_us != NULL))        /* check us links */
+    {
+        handle->delay_until_us(handle->timestamp_us() + us);                       /* wait to the deadline */
+    }
+    else
+    {
+        handle->delay_ms((us + 999) / 1000);                                       /* wait whole ms */
+    }
+}
+
+/**
+ * @brief     publish the shadow config
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] shadow is the config word or'ed with ADS1115_SHADOW_VALID, 0 invalidates it
+ * @note      the valid bit and the config share one aligned 32 bit word stored in a single
+ *            access, so a reader without the bus lock never pairs a valid flag with a torn config
+ */
+static void a_ads1115_shadow_store(ads1115_handle_t *handle, uint32_t shadow)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(&handle->shadow, shadow, __ATOMIC_RELEASE);        /* store shadow */
+#else
+    *(volatile uint32_t *)&handle->shadow = shadow;                     /* store shadow */
+#endif
+}
+
+/**
+ * @brief      read the shadow config
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 shadow is not valid
+ * @note       takes no bus lock, see a_ads1115_shadow_store
+ */
+static uint8_t a_ads1115_shadow_load(ads1115_handle_t *handle, uint16_t *conf)
+{
+    uint32_t shadow;
+    
+#if defined(__GNUC__)
+    shadow = __atomic_load_n(&handle->shadow, __ATOMIC_ACQUIRE);        /* load shadow */
+#else
+    shadow = *(volatile uint32_t *)&handle->shadow;                     /* load shadow */
+#endif
+    if ((shadow & ADS1115_SHADOW_VALID) == 0)                           /* check valid */
+    {
+        return 1;                                                       /* return error */
+    }
+    *conf = (uint16_t)(shadow & 0xFFFFU);                               /* get config */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     take the bus lock
+ * @param[in] *handle points to an ads1115 handle structure
+ * @note      no operation when no lock is linked
+ */
+static void a_ads1115_lock(ads1115_handle_t *handle)
+{
+    if (handle->lock != NULL)                    /* check lock */
+    {
+        handle->lock(handle->bus);               /* lock the bus */
+    }
+}
+
+/**
+ * @brief     release the bus lock
+ * @param[in] *handle points to an ads1115 handle structure
+ * @note      no operation when no lock is linked
+ */
+static void a_ads1115_unlock(ads1115_handle_t *handle)
+{
+    if (handle->unlock != NULL)                  /* check unlock */
+    {
+        handle->unlock(handle->bus);             /* unlock the bus */
+    }
+}
+
+/**
+ * @brief      read multiple bytes with the bus lock held
  * @param[in]  *handle points to an ads1115 handle structure
  * @param[in]  reg is the iic register address
  * @param[out] *data points to a data buffer
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       the caller holds the bus lock
  */
-static uint8_t a_ads1115_iic_multiple_read(ads1115_handle_t *handle, uint8_t reg, int16_t *data)
+static uint8_t a_ads1115_iic_bus_read(ads1115_handle_t *handle, uint8_t reg, int16_t *data)
 {
     uint8_t buf[2];
     
@@ -93,16 +274,16 @@ static uint8_t a_ads1115_iic_multiple_read(ads1115_handle_t *handle, uint8_t reg
 }
 
 /**
- * @brief     write multiple bytes
+ * @brief     write multiple bytes with the bus lock held
  * @param[in] *handle points to an ads1115 handle structure
  * @param[in] reg is the iic register address
  * @param[in] data is the sent data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the caller holds the bus lock
  */
-static uint8_t a_ads1115_iic_multiple_write(ads1115_handle_t *handle, uint8_t reg, uint16_t data)
+static uint8_t a_ads1115_iic_bus_write(ads1115_handle_t *handle, uint8_t reg, uint16_t data)
 {
     uint8_t buf[2];
   
@@ -118,6 +299,118 @@ static uint8_t a_ads1115_iic_multiple_write(ads1115_handle_t *handle, uint8_t re
     }
 }
 
+/**
+ * @brief      read multiple bytes
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[in]  reg is the iic register address
+ * @param[out] *data points to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the bus lock is held for this transaction only
+ */
+static uint8_t a_ads1115_iic_multiple_read(ads1115_handle_t *handle, uint8_t reg, int16_t *data)
+{
+    uint8_t res;
+    
+    a_ads1115_lock(handle);                                  /* lock the bus */
+    res = a_ads1115_iic_bus_read(handle, reg, data);         /* read data */
+    a_ads1115_unlock(handle);                                /* unlock the bus */
+    
+    return res;                                              /* return the result */
+}
+
+/**
+ * @brief     write multiple bytes
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] reg is the iic register address
+ * @param[in] data is the sent data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the bus lock is held for this transaction only
+ */
+static uint8_t a_ads1115_iic_multiple_write(ads1115_handle_t *handle, uint8_t reg, uint16_t data)
+{
+    uint8_t res;
+    
+    a_ads1115_lock(handle);                                  /* lock the bus */
+    res = a_ads1115_iic_bus_write(handle, reg, data);        /* write data */
+    a_ads1115_unlock(handle);                                /* unlock the bus */
+    
+    return res;                                              /* return the result */
+}
+
+/**
+ * @brief      begin a config read-modify-write
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config buffer
+ * @return     status code
+ *             - 0 success, the bus lock is held until a_ads1115_config_end
+ *             - 1 read failed, the bus lock is released
+ * @note       none
+ */
+static uint8_t a_ads1115_config_begin(ads1115_handle_t *handle, uint16_t *conf)
+{
+    a_ads1115_lock(handle);                                                 /* lock the bus */
+    if (a_ads1115_iic_bus_read(handle, ADS1115_REG_CONFIG,
+                               (int16_t *)conf) != 0)                       /* read config */
+    {
+        a_ads1115_unlock(handle);                                           /* unlock the bus */
+        
+        return 1;                                                           /* return error */
+    }
+    a_ads1115_shadow_store(handle,
+                           ADS1115_SHADOW_VALID | (*conf & 0x7FFF));        /* refresh shadow */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     end a config read-modify-write
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] conf is the config to write
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the bus lock is always released
+ */
+static uint8_t a_ads1115_config_end(ads1115_handle_t *handle, uint16_t conf)
+{
+    uint8_t res;
+    
+    res = a_ads1115_iic_bus_write(handle, ADS1115_REG_CONFIG, conf);        /* write config */
+    if (res == 0)                                                           /* check result */
+    {
+        a_ads1115_shadow_store(handle,
+                               ADS1115_SHADOW_VALID | (conf & 0x7FFF));     /* update shadow */
+    }
+    a_ads1115_unlock(handle);                                               /* unlock the bus */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief      read the config from the shadow or the bus
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       takes no bus lock while the shadow is valid, the shadow only follows the
+ *             writes of this handle, so a config written by another handle or process
+ *             is seen after ads1115_get_config_word resyncs it
+ */
+static uint8_t a_ads1115_config_read(ads1115_handle_t *handle, uint16_t *conf)
+{
+    if (a_ads1115_shadow_load(handle, conf) == 0)                                         /* use shadow config */
+    {
+        return 0;                                                                         /* success return 0 */
+    }
+    
+    return a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)conf);      /* read config */
+}
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle points to an ads1115 handle structure
@@ -175,6 +468,7 @@ uint8_t ads1115_init(ads1115_handle_t *handle)
         
         return 1;                                                    /* return error */
     }
+    a_ads1115_shadow_store(handle, 0);                               /* shadow not valid */
     handle->inited = 1;                                              /* flag inited */
     
     return 0;                                                        /* success return 0 */
@@ -205,7 +499,7 @@ uint8_t ads1115_deinit(ads1115_handle_t *handle)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -214,7 +508,7 @@ uint8_t ads1115_deinit(ads1115_handle_t *handle)
     }
     conf &= ~(0x01 << 8);                                                                  /* clear bit */
     conf |= 1 << 8;                                                                        /* set stop continues read */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -258,7 +552,7 @@ uint8_t ads1115_set_channel(ads1115_handle_t *handle, ads1115_channel_t channel)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -267,7 +561,7 @@ uint8_t ads1115_set_channel(ads1115_handle_t *handle, ads1115_channel_t channel)
     }
     conf &= ~(0x07 << 12);                                                                 /* clear channel */
     conf |= (channel & 0x07) << 12;                                                        /* set channel */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -287,7 +581,7 @@ uint8_t ads1115_set_channel(ads1115_handle_t *handle, ads1115_channel_t channel)
  *             - 1 get channel failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_channel(ads1115_handle_t *handle, ads1115_channel_t *channel)
 {
@@ -303,7 +597,7 @@ uint8_t ads1115_get_channel(ads1115_handle_t *handle, ads1115_channel_t *channel
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -340,7 +634,7 @@ uint8_t ads1115_set_range(ads1115_handle_t *handle, ads1115_range_t range)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -349,7 +643,7 @@ uint8_t ads1115_set_range(ads1115_handle_t *handle, ads1115_range_t range)
     }
     conf &= ~(0x07 << 9);                                                                  /* clear range */
     conf |= (range & 0x07) << 9;                                                           /* set range */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -369,7 +663,7 @@ uint8_t ads1115_set_range(ads1115_handle_t *handle, ads1115_range_t range)
  *             - 1 get range failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_range(ads1115_handle_t *handle, ads1115_range_t *range)
 {
@@ -385,7 +679,7 @@ uint8_t ads1115_get_range(ads1115_handle_t *handle, ads1115_range_t *range)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -422,7 +716,7 @@ uint8_t ads1115_set_alert_pin(ads1115_handle_t *handle, ads1115_pin_t pin)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -431,7 +725,7 @@ uint8_t ads1115_set_alert_pin(ads1115_handle_t *handle, ads1115_pin_t pin)
     }
     conf &= ~(1 << 3);                                                                     /* clear alert pin */
     conf |= (pin & 0x01) << 3;                                                             /* set alert pin */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -451,7 +745,7 @@ uint8_t ads1115_set_alert_pin(ads1115_handle_t *handle, ads1115_pin_t pin)
  *             - 1 get alert pin failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_alert_pin(ads1115_handle_t *handle, ads1115_pin_t *pin)
 {
@@ -467,7 +761,7 @@ uint8_t ads1115_get_alert_pin(ads1115_handle_t *handle, ads1115_pin_t *pin)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -504,7 +798,7 @@ uint8_t ads1115_set_compare_mode(ads1115_handle_t *handle, ads1115_compare_t com
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -513,7 +807,7 @@ uint8_t ads1115_set_compare_mode(ads1115_handle_t *handle, ads1115_compare_t com
     }
     conf &= ~(1 << 4);                                                                     /* clear compare mode */
     conf |= (compare & 0x01) << 4;                                                         /* set compare mode */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -533,7 +827,7 @@ uint8_t ads1115_set_compare_mode(ads1115_handle_t *handle, ads1115_compare_t com
  *             - 1 get compare mode failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_compare_mode(ads1115_handle_t *handle, ads1115_compare_t *compare)
 {
@@ -549,7 +843,7 @@ uint8_t ads1115_get_compare_mode(ads1115_handle_t *handle, ads1115_compare_t *co
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -586,7 +880,7 @@ uint8_t ads1115_set_rate(ads1115_handle_t *handle, ads1115_rate_t rate)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -595,7 +889,7 @@ uint8_t ads1115_set_rate(ads1115_handle_t *handle, ads1115_rate_t rate)
     }
     conf &= ~(0x07 << 5);                                                                  /* clear rate */
     conf |= (rate & 0x07) << 5;                                                            /* set rate */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -615,7 +909,7 @@ uint8_t ads1115_set_rate(ads1115_handle_t *handle, ads1115_rate_t rate)
  *             - 1 get rate failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_rate(ads1115_handle_t *handle, ads1115_rate_t *rate)
 {
@@ -631,7 +925,7 @@ uint8_t ads1115_get_rate(ads1115_handle_t *handle, ads1115_rate_t *rate)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -644,62 +938,115 @@ uint8_t ads1115_get_rate(ads1115_handle_t *handle, ads1115_rate_t *rate)
 }
 
 /**
- * @brief     set the interrupt comparator queue
+ * @brief     set the measured conversion period
  * @param[in] *handle points to an ads1115 handle structure
- * @param[in] comparator_queue is the interrupt comparator queue
+ * @param[in] rate is the sample rate the period was measured at
+ * @param[in] us is the conversion period in microseconds
  * @return    status code
  *            - 0 success
- *            - 1 set comparator queue failed
  *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @note      kept as the oscillator scale against the datasheet period, so it follows later rate changes,
+ *            the waits use it plus a 2% margin, 0 means the datasheet period of the current rate
+ *            plus the 10% oscillator tolerance
  */
-uint8_t ads1115_set_comparator_queue(ads1115_handle_t *handle, ads1115_comparator_queue_t comparator_queue)
+uint8_t ads1115_set_conversion_period(ads1115_handle_t *handle, ads1115_rate_t rate, uint32_t us)
 {
-    uint8_t res;
-    uint16_t conf;
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
     
+    handle->oscillator_scale = (uint32_t)((((uint64_t)us << 16) +
+                                          gs_conversion_period_us[rate & 0x07] / 2) /
+                                          gs_conversion_period_us[rate & 0x07]);          /* set scale */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the measured conversion period
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[in]  rate is the sample rate to get the period of
+ * @param[out] *us points to a conversion period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       0 when no period has been measured
+ */
+uint8_t ads1115_get_conversion_period(ads1115_handle_t *handle, ads1115_rate_t rate, uint32_t *us)
+{
     if (handle == NULL)                                                                    /* check handle */
     {
         return 2;                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                               /* check handle initialization */
+    
+    *us = a_ads1115_measured_period_us(handle, (uint8_t)rate);                             /* get period */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     get the datasheet conversion period of a rate
+ * @param[in] rate is the sample rate
+ * @return    period in us, 0 for an invalid rate
+ * @note      the oscillator runs within 10% of it
+ */
+uint32_t ads1115_rate_to_period_us(ads1115_rate_t rate)
+{
+    if ((uint32_t)rate > (uint32_t)ADS1115_RATE_860SPS)          /* check rate */
     {
-        return 3;                                                                          /* return error */
+        return 0;                                                /* invalid */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
-    if (res != 0)                                                                          /* check error */
+    return gs_conversion_period_us[rate];                        /* return period */
+}
+
+/**
+ * @brief     get the nominal samples per second of a rate
+ * @param[in] rate is the sample rate
+ * @return    samples per second, 0 for an invalid rate
+ * @note      none
+ */
+uint32_t ads1115_rate_to_sps(ads1115_rate_t rate)
+{
+    if ((uint32_t)rate > (uint32_t)ADS1115_RATE_860SPS)          /* check rate */
     {
-        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
-        
-        return 1;                                                                          /* return error */
+        return 0;                                                /* invalid */
     }
-    conf &= ~(0x03 << 0);                                                                  /* clear comparator queue */
-    conf |= (comparator_queue & 0x03) << 0;                                                /* set comparator queue */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
-    if (res != 0)                                                                          /* check error */
+    
+    return gs_rate_sps[rate];                                    /* return sps */
+}
+
+/**
+ * @brief     get the full scale voltage of a range
+ * @param[in] range is the adc range
+ * @return    full scale in volts, 0 for an invalid range
+ * @note      one count is the full scale divided by 32768
+ */
+float ads1115_range_to_full_scale_v(ads1115_range_t range)
+{
+    if ((uint32_t)range > (uint32_t)ADS1115_RANGE_0P256V)        /* check range */
     {
-        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
-        
-        return 1;                                                                          /* return error */
+        return 0.0f;                                             /* invalid */
     }
     
-    return 0;                                                                              /* success return 0 */
+    return gs_full_scale_v[range];                               /* return full scale */
 }
 
 /**
- * @brief      get the interrupt comparator queue
+ * @brief      get the conversion wait time of the current rate
  * @param[in]  *handle points to an ads1115 handle structure
- * @param[out] *comparator_queue points to an interrupt comparator queue
+ * @param[out] *us points to a wait time buffer
  * @return     status code
  *             - 0 success
- *             - 1 get comparator queue failed
+ *             - 1 get conversion time failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the measured period plus 2% when set, else the datasheet period plus the 10% oscillator tolerance,
+ *             the rate comes from the shadow of this handle, which is stale after another handle
+ *             or process writes the config until ads1115_get_config_word resyncs it
  */
-uint8_t ads1115_get_comparator_queue(ads1115_handle_t *handle, ads1115_comparator_queue_t *comparator_queue)
+uint8_t ads1115_get_conversion_time(ads1115_handle_t *handle, uint32_t *us)
 {
     uint8_t res;
     uint16_t conf;
@@ -713,27 +1060,343 @@ uint8_t ads1115_get_comparator_queue(ads1115_handle_t *handle, ads1115_comparato
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
         
         return 1;                                                                          /* return error */
     }
-    *comparator_queue = (ads1115_comparator_queue_t)((conf >> 0) & 0x03);                  /* get comparator queue */
+    *us = a_ads1115_conversion_wait_us(handle, conf);                                      /* get wait time */
     
     return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     set the iic address pin
+ * @brief     set the whole config register in one write
  * @param[in] *handle points to an ads1115 handle structure
- * @param[in] addr_pin is the chip iic address pin
+ * @param[in] conf is the config register word
  * @return    status code
  *            - 0 success
- *            - 1 set addr pin failed
+ *            - 1 set config word failed
  *            - 2 handle is NULL
- * @note      none
+ *            - 3 handle is not initialized
+ * @note      the os bit is ignored, build conf with ADS1115_CONFIG_WORD
+ */
+uint8_t ads1115_set_config_word(ads1115_handle_t *handle, uint16_t conf)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    conf &= ~(1 << 15);                                                                    /* never start a conversion */
+    a_ads1115_lock(handle);                                                                /* lock the bus */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the config register and the compare thresholds in one transaction
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] conf is the config register word
+ * @param[in] high_threshold is the interrupt high threshold
+ * @param[in] low_threshold is the interrupt low threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set compare config word failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the bus lock is held for all writes, the new mux goes in first with the comparator
+ *            disabled, then the thresholds, then conf, so no conversion of the old channel is
+ *            compared against the new thresholds, the os bit is ignored
+ */
+uint8_t ads1115_set_compare_config_word(ads1115_handle_t *handle, uint16_t conf,
+                                        int16_t high_threshold, int16_t low_threshold)
+{
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    conf &= ~(1 << 15);                                                                    /* never start a conversion */
+    a_ads1115_lock(handle);                                                                /* lock the bus */
+    if (a_ads1115_iic_bus_write(handle, ADS1115_REG_CONFIG, conf | 0x03) != 0)             /* new mux, comparator disabled */
+    {
+        a_ads1115_unlock(handle);                                                          /* unlock the bus */
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    a_ads1115_shadow_store(handle,
+                           ADS1115_SHADOW_VALID | ((conf | 0x03) & 0x7FFF));               /* update shadow */
+    if (a_ads1115_iic_bus_write(handle, ADS1115_REG_HIGHRESH, high_threshold) != 0)        /* write high threshold */
+    {
+        a_ads1115_unlock(handle);                                                          /* unlock the bus */
+        handle->debug_print("ads1115: write high threshold failed.\n");                    /* write high threshold failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    if (a_ads1115_iic_bus_write(handle, ADS1115_REG_LOWRESH, low_threshold) != 0)          /* write low threshold */
+    {
+        a_ads1115_unlock(handle);                                                          /* unlock the bus */
+        handle->debug_print("ads1115: write low threshold failed.\n");                     /* write low threshold failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    if (a_ads1115_config_end(handle, conf) != 0)                                           /* write config and unlock */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the whole config register
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config register word buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config word failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the os bit is masked out, the read goes to the bus and resyncs the shadow
+ */
+uint8_t ads1115_get_config_word(ads1115_handle_t *handle, uint16_t *conf)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    res = a_ads1115_config_begin(handle, conf);                                            /* read config and resync shadow */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    a_ads1115_unlock(handle);                                                              /* unlock the bus */
+    *conf &= ~(1 << 15);                                                                   /* mask os bit */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the shadow config without a bus transaction
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config register word buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 shadow config is not valid
+ *             - 2 handle is NULL
+ * @note       the shadow is the last config this handle read for an update or wrote,
+ *             it takes no bus lock and is published as one word so it never reads torn
+ */
+uint8_t ads1115_get_shadow_config(ads1115_handle_t *handle, uint16_t *conf)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    return a_ads1115_shadow_load(handle, conf);  /* get shadow */
+}
+
+/**
+ * @brief      read the conversion register only
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read raw failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one iic transaction with no config read back,
+ *             the caller converts raw with the range it configured
+ */
+uint8_t ads1115_read_raw(ads1115_handle_t *handle, int16_t *raw)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONVERT, raw);                   /* read data */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read raw failed.\n");                                /* read raw failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      start a single conversion with a whole config word
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[in]  conf is the config register word
+ * @param[out] *wait_us points to a conversion wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start single read word failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one iic transaction that switches the mux, range and rate and starts,
+ *             the mode and os bits are set here, build conf with ADS1115_CONFIG_WORD
+ */
+uint8_t ads1115_start_single_read_word(ads1115_handle_t *handle, uint16_t conf, uint32_t *wait_us)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    conf |= 1 << 8;                                                                        /* set single read */
+    conf |= 1 << 15;                                                                       /* start single read */
+    a_ads1115_lock(handle);                                                                /* lock the bus */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    *wait_us = a_ads1115_conversion_wait_us(handle, conf);                                 /* get wait time */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the interrupt comparator queue
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] comparator_queue is the interrupt comparator queue
+ * @return    status code
+ *            - 0 success
+ *            - 1 set comparator queue failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ads1115_set_comparator_queue(ads1115_handle_t *handle, ads1115_comparator_queue_t comparator_queue)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    conf &= ~(0x03 << 0);                                                                  /* clear comparator queue */
+    conf |= (comparator_queue & 0x03) << 0;                                                /* set comparator queue */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the interrupt comparator queue
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *comparator_queue points to an interrupt comparator queue
+ * @return     status code
+ *             - 0 success
+ *             - 1 get comparator queue failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config comes from the shadow without a bus transaction once it is valid
+ */
+uint8_t ads1115_get_comparator_queue(ads1115_handle_t *handle, ads1115_comparator_queue_t *comparator_queue)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    *comparator_queue = (ads1115_comparator_queue_t)((conf >> 0) & 0x03);                  /* get comparator queue */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the iic address pin
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] addr_pin is the chip iic address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 set addr pin failed
+ *            - 2 handle is NULL
+ * @note      none
  */
 uint8_t ads1115_set_addr_pin(ads1115_handle_t *handle, ads1115_address_t addr_pin)
 {
@@ -839,7 +1502,7 @@ uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
         return 3;                                                                              /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);           /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                               /* read config */
     if (res != 0)                                                                              /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                                 /* read config failed */
@@ -850,16 +1513,16 @@ uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
     conf &= ~(1 << 8);                                                                         /* clear bit */
     conf |= 1 << 8;                                                                            /* set single read */
     conf |= 1 << 15;                                                                           /* start single read */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                      /* write config */
+    res = a_ads1115_config_end(handle, conf);                                                  /* write config */
     if (res != 0)                                                                              /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                                /* write config failed */
         
         return 1;                                                                              /* return error */
     }
+    a_ads1115_wait_us(handle, a_ads1115_conversion_wait_us(handle, conf));                     /* wait one conversion */
     while (timeout != 0)                                                                       /* check timeout */
     {
-        handle->delay_ms(8);                                                                   /* wait 8 ms */
         res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
         if (res != 0)                                                                          /* check error */
         {
@@ -871,6 +1534,7 @@ uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
         {
             break;                                                                             /* break */
         }
+        handle->delay_ms(1);                                                                   /* wait 1 ms */
         timeout--;                                                                             /* timeout-- */
     }
     if (timeout == 0)                                                                          /* check timeout */
@@ -882,42 +1546,175 @@ uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
     res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONVERT, raw);                       /* read data */
     if (res != 0)                                                                              /* check the result */
     {
-        handle->debug_print("ads1115: continues read failed.\n");                              /* continues read failed */
-        
-        return 1;                                                                              /* return error */
+        handle->debug_print("ads1115: continues read failed.\n");                              /* continues read failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if (range == ADS1115_RANGE_6P144V)                                                         /* if 6.144V */
+    {
+        *v = (float)(*raw) * 6.144f / 32768.0f;                                                /* get convert adc */
+    }
+    else if (range == ADS1115_RANGE_4P096V)                                                    /* if 4.096V */
+    {
+        *v = (float)(*raw) * 4.096f / 32768.0f;                                                /* get convert adc */
+    }
+    else if (range == ADS1115_RANGE_2P048V)                                                    /* if 2.048V */
+    {
+        *v = (float)(*raw) * 2.048f / 32768.0f;                                                /* get convert adc */
+    }
+    else if (range == ADS1115_RANGE_1P024V)                                                    /* if 1.024V */
+    {
+        *v = (float)(*raw) * 1.024f / 32768.0f;                                                /* get convert adc */
+    }
+    else if (range == ADS1115_RANGE_0P512V)                                                    /* if 0.512V */
+    {
+        *v = (float)(*raw) * 0.512f / 32768.0f;                                                /* get convert adc */
+    }
+    else if (range == ADS1115_RANGE_0P256V)                                                    /* if 0.256V */
+    {
+        *v = (float)(*raw) * 0.256f / 32768.0f;                                                /* get convert adc */
+    }
+    else
+    {
+        handle->debug_print("ads1115: range is invalid.\n");                                   /* range is invalid */
+        
+        return 1;                                                                              /* return error */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      start a single conversion without waiting
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *wait_us points to a conversion wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the result is ready after wait_us and can be checked by ads1115_get_single_read_status
+ */
+uint8_t ads1115_start_single_read(ads1115_handle_t *handle, uint32_t *wait_us)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    conf |= 1 << 8;                                                                        /* set single read */
+    conf |= 1 << 15;                                                                       /* start single read */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    *wait_us = a_ads1115_conversion_wait_us(handle, conf);                                 /* get wait time */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the single conversion status
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *finished points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get single read status failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1115_get_single_read_status(ads1115_handle_t *handle, ads1115_bool_t *finished)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
     }
-    if (range == ADS1115_RANGE_6P144V)                                                         /* if 6.144V */
+    if (handle->inited != 1)                                                               /* check handle initialization */
     {
-        *v = (float)(*raw) * 6.144f / 32768.0f;                                                /* get convert adc */
+        return 3;                                                                          /* return error */
     }
-    else if (range == ADS1115_RANGE_4P096V)                                                    /* if 4.096V */
+    
+    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    if (res != 0)                                                                          /* check error */
     {
-        *v = (float)(*raw) * 4.096f / 32768.0f;                                                /* get convert adc */
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
     }
-    else if (range == ADS1115_RANGE_2P048V)                                                    /* if 2.048V */
+    *finished = (ads1115_bool_t)((conf >> 15) & 0x01);                                     /* get finished */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      read the result of a finished single conversion
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *v points to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config comes from the shadow without a bus transaction once it is valid
+ */
+uint8_t ads1115_get_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
     {
-        *v = (float)(*raw) * 2.048f / 32768.0f;                                                /* get convert adc */
+        return 2;                                                                          /* return error */
     }
-    else if (range == ADS1115_RANGE_1P024V)                                                    /* if 1.024V */
+    if (handle->inited != 1)                                                               /* check handle initialization */
     {
-        *v = (float)(*raw) * 1.024f / 32768.0f;                                                /* get convert adc */
+        return 3;                                                                          /* return error */
     }
-    else if (range == ADS1115_RANGE_0P512V)                                                    /* if 0.512V */
+    
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
+    if (res != 0)                                                                          /* check error */
     {
-        *v = (float)(*raw) * 0.512f / 32768.0f;                                                /* get convert adc */
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
     }
-    else if (range == ADS1115_RANGE_0P256V)                                                    /* if 0.256V */
+    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONVERT, raw);                   /* read data */
+    if (res != 0)                                                                          /* check the result */
     {
-        *v = (float)(*raw) * 0.256f / 32768.0f;                                                /* get convert adc */
+        handle->debug_print("ads1115: single read failed.\n");                             /* single read failed */
+        
+        return 1;                                                                          /* return error */
     }
-    else
+    if (a_ads1115_raw_to_voltage(conf, *raw, v) != 0)                                      /* convert */
     {
-        handle->debug_print("ads1115: range is invalid.\n");                                   /* range is invalid */
+        handle->debug_print("ads1115: range is invalid.\n");                               /* range is invalid */
         
-        return 1;                                                                              /* return error */
+        return 1;                                                                          /* return error */
     }
     
-    return 0;                                                                                  /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
@@ -931,7 +1728,9 @@ uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v)
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       this function can be used only after run ads1115_start_continuous_read
- *             and can be stopped by ads1115_stop_continuous_read
+ *             and can be stopped by ads1115_stop_continuous_read,
+ *             the range comes from the shadow of this handle, which is stale after another handle
+ *             or process writes the config until ads1115_get_config_word resyncs it
  */
 uint8_t ads1115_continuous_read(ads1115_handle_t *handle,int16_t *raw, float *v)
 {
@@ -948,7 +1747,7 @@ uint8_t ads1115_continuous_read(ads1115_handle_t *handle,int16_t *raw, float *v)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -997,6 +1796,151 @@ uint8_t ads1115_continuous_read(ads1115_handle_t *handle,int16_t *raw, float *v)
     return 0;                                                                              /* success return 0 */
 }
 
+/**
+ * @brief      read a block of samples in continuous mode
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *v points to a converted adc buffer, NULL for raw only
+ * @param[out] *timestamp_us points to a timestamp buffer, NULL for none
+ * @param[out] *fresh points to a fresh sample flag buffer, NULL for none
+ * @param[in]  n is the number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 1 read n failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 chip is not in continuous mode
+ * @note       the config is fetched once, each sample is one iic transaction,
+ *             the samples follow the ready edges when ready_wait is linked and the conversion ready pin is enabled,
+ *             else they are paced by the measured conversion period or the datasheet period plus the 10% oscillator tolerance,
+ *             a timer paced read that wakes late can leave the next read less than one conversion apart and return
+ *             the same conversion twice, such a sample is flagged ADS1115_BOOL_FALSE in fresh,
+ *             ready edge and whole ms paced samples are always fresh
+ */
+uint8_t ads1115_read_n(ads1115_handle_t *handle, int16_t *raw, float *v, uint64_t *timestamp_us,
+                       ads1115_bool_t *fresh, uint32_t n)
+{
+    uint8_t res;
+    uint8_t range;
+    uint8_t ready;
+    uint16_t conf;
+    int16_t high;
+    int16_t low;
+    uint32_t i;
+    uint32_t period;
+    uint32_t shortest;
+    uint64_t next = 0;
+    uint64_t ts = 0;
+    uint64_t last = 0;
+    float scale;
+    
+    if (handle == NULL)                                                                        /* check handle */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                   /* check handle initialization */
+    {
+        return 3;                                                                              /* return error */
+    }
+    
+    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);           /* read config once */
+    if (res != 0)                                                                              /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                                 /* read config failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if ((conf & (1 << 8)) != 0)                                                                /* check mode */
+    {
+        handle->debug_print("ads1115: not in continuous mode.\n");                             /* not in continuous mode */
+        
+        return 4;                                                                              /* return error */
+    }
+    range = (uint8_t)((conf >> 9) & 0x07);                                                     /* get range conf */
+    if (range > ADS1115_RANGE_0P256V)                                                          /* check range */
+    {
+        handle->debug_print("ads1115: range is invalid.\n");                                   /* range is invalid */
+        
+        return 1;                                                                              /* return error */
+    }
+    scale = gs_full_scale_v[range] / 32768.0f;                                                 /* volts per lsb */
+    period = a_ads1115_measured_period_us(handle, (uint8_t)(conf >> 5));                       /* pace at the measured period */
+    shortest = period;                                                                         /* measured period */
+    if (shortest == 0)                                                                         /* check measured */
+    {
+        period = a_ads1115_conversion_wait_us(handle, conf);                                   /* pacing period */
+        shortest = gs_conversion_period_us[(conf >> 5) & 0x07];                                /* datasheet period */
+        shortest -= shortest / 10;                                                             /* fastest oscillator */
+    }
+    
+    ready = 0;                                                                                 /* timer paced */
+    if ((handle->ready_wait != NULL) && ((conf & 0x03) != ADS1115_COMPARATOR_QUEUE_NONE_CONV)) /* check ready link */
+    {
+        res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_HIGHRESH, &high);                /* read high threshold */
+        if (res == 0)                                                                          /* check result */
+        {
+            res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_LOWRESH, &low);              /* read low threshold */
+        }
+        if (res != 0)                                                                          /* check error */
+        {
+            handle->debug_print("ads1115: read threshold failed.\n");                          /* read threshold failed */
+            
+            return 1;                                                                          /* return error */
+        }
+        ready = (((uint16_t)high & 0x8000) != 0) && (((uint16_t)low & 0x8000) == 0);           /* ready pin mode */
+    }
+    if ((ready == 0) && (handle->timestamp_us != NULL) && (handle->delay_until_us != NULL))    /* check timer links */
+    {
+        next = handle->timestamp_us();                                                         /* first deadline base */
+    }
+    
+    for (i = 0; i < n; i++)                                                                    /* read n samples */
+    {
+        if (ready != 0)                                                                        /* ready edge */
+        {
+            if (handle->ready_wait(period / 500 + 10, &ts) != 0)                               /* wait two periods */
+            {
+                handle->debug_print("ads1115: ready wait timeout.\n");                         /* ready wait timeout */
+                
+                return 1;                                                                      /* return error */
+            }
+        }
+        else if (next != 0)                                                                    /* absolute deadline */
+        {
+            next += period;                                                                    /* next deadline */
+            handle->delay_until_us(next);                                                      /* wait */
+            ts = handle->timestamp_us();                                                       /* sample time */
+        }
+        else
+        {
+            handle->delay_ms((period + 999) / 1000);                                           /* wait whole ms */
+        }
+        res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONVERT, &raw[i]);               /* read data */
+        if (res != 0)                                                                          /* check error */
+        {
+            handle->debug_print("ads1115: continuous read failed.\n");                         /* continuous read failed */
+            
+            return 1;                                                                          /* return error */
+        }
+        if (v != NULL)                                                                         /* check float output */
+        {
+            v[i] = (float)raw[i] * scale;                                                      /* convert */
+        }
+        if (timestamp_us != NULL)                                                              /* check timestamp output */
+        {
+            timestamp_us[i] = ts;                                                              /* set timestamp */
+        }
+        if (fresh != NULL)                                                                     /* check fresh output */
+        {
+            fresh[i] = ((next == 0) || (i == 0) || (ts - last >= shortest))
+                       ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE;                               /* a conversion completed */
+        }
+        last = ts;                                                                             /* save sample time */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
 /**
  * @brief     start the chip reading
  * @param[in] *handle points to an ads1115 handle structure
@@ -1021,7 +1965,7 @@ uint8_t ads1115_start_continuous_read(ads1115_handle_t *handle)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1029,7 +1973,7 @@ uint8_t ads1115_start_continuous_read(ads1115_handle_t *handle)
         return 1;                                                                          /* return error */
     }
     conf &= ~(0x01 << 8);                                                                  /* set start continuous read */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -1064,7 +2008,7 @@ uint8_t ads1115_stop_continuous_read(ads1115_handle_t *handle)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1073,7 +2017,7 @@ uint8_t ads1115_stop_continuous_read(ads1115_handle_t *handle)
     }
     conf &= ~(0x01 << 8);                                                                  /* clear bit */
     conf |= 1 << 8;                                                                        /* set stop continues read */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -1109,7 +2053,7 @@ uint8_t ads1115_set_compare(ads1115_handle_t *handle, ads1115_bool_t enable)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1118,7 +2062,7 @@ uint8_t ads1115_set_compare(ads1115_handle_t *handle, ads1115_bool_t enable)
     }
     conf &= ~(0x01 << 2);                                                                  /* clear compare */
     conf |= enable << 2;                                                                   /* set compare */
-    res = a_ads1115_iic_multiple_write(handle, ADS1115_REG_CONFIG, conf);                  /* write config */
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
@@ -1138,7 +2082,7 @@ uint8_t ads1115_set_compare(ads1115_handle_t *handle, ads1115_bool_t enable)
  *             - 1 get compare failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_compare(ads1115_handle_t *handle, ads1115_bool_t *enable)
 {
@@ -1154,7 +2098,7 @@ uint8_t ads1115_get_compare(ads1115_handle_t *handle, ads1115_bool_t *enable)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1244,6 +2188,134 @@ uint8_t ads1115_get_compare_threshold(ads1115_handle_t *handle, int16_t *high_th
     return 0;                                                                            /* success return 0 */
 }
 
+/**
+ * @brief     enable or disable the conversion ready function of the alert pin
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] enable is a bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set conversion ready pin failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enable overwrites the compare threshold and disable sets the comparator queue to none
+ */
+uint8_t ads1115_set_conversion_ready_pin(ads1115_handle_t *handle, ads1115_bool_t enable)
+{
+    uint8_t res;
+    uint16_t conf;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    if (enable == ADS1115_BOOL_TRUE)                                                       /* enable */
+    {
+        if (a_ads1115_iic_multiple_write(handle, ADS1115_REG_HIGHRESH, 0x8000) != 0)       /* set high threshold msb */
+        {
+            handle->debug_print("ads1115: write high threshold failed.\n");                /* write high threshold failed */
+            
+            return 1;                                                                      /* return error */
+        }
+        if (a_ads1115_iic_multiple_write(handle, ADS1115_REG_LOWRESH, 0x0000) != 0)        /* clear low threshold msb */
+        {
+            handle->debug_print("ads1115: write low threshold failed.\n");                 /* write low threshold failed */
+            
+            return 1;                                                                      /* return error */
+        }
+    }
+    res = a_ads1115_config_begin(handle, &conf);                                           /* read config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    conf &= ~(0x03 << 0);                                                                  /* clear comparator queue */
+    if (enable == ADS1115_BOOL_TRUE)                                                       /* enable */
+    {
+        conf |= ADS1115_COMPARATOR_QUEUE_1_CONV << 0;                                      /* assert after one conversion */
+    }
+    else
+    {
+        conf |= ADS1115_COMPARATOR_QUEUE_NONE_CONV << 0;                                   /* disable the alert pin */
+    }
+    res = a_ads1115_config_end(handle, conf);                                              /* write config */
+    if (res != 0)                                                                          /* check error */
+    {
+        handle->debug_print("ads1115: write config failed.\n");                            /* write config failed */
+        
+        return 1;                                                                          /* return error */
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the conversion ready function status of the alert pin
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *enable points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion ready pin failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config comes from the shadow without a bus transaction once it is valid
+ */
+uint8_t ads1115_get_conversion_ready_pin(ads1115_handle_t *handle, ads1115_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t conf;
+    uint16_t high_threshold;
+    uint16_t low_threshold;
+    
+    if (handle == NULL)                                                                        /* check handle */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                   /* check handle initialization */
+    {
+        return 3;                                                                              /* return error */
+    }
+    
+    res = a_ads1115_config_read(handle, &conf);                                                /* read config */
+    if (res != 0)                                                                              /* check error */
+    {
+        handle->debug_print("ads1115: read config failed.\n");                                 /* read config failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if (a_ads1115_iic_multiple_read(handle, ADS1115_REG_HIGHRESH,
+                                    (int16_t *)&high_threshold) != 0)                          /* read high threshold */
+    {
+        handle->debug_print("ads1115: read high threshold failed.\n");                         /* read high threshold failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if (a_ads1115_iic_multiple_read(handle, ADS1115_REG_LOWRESH,
+                                    (int16_t *)&low_threshold) != 0)                           /* read low threshold */
+    {
+        handle->debug_print("ads1115: read low threshold failed.\n");                          /* read low threshold failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if (((conf & 0x03) != ADS1115_COMPARATOR_QUEUE_NONE_CONV) &&
+        ((high_threshold & 0x8000) != 0) && ((low_threshold & 0x8000) == 0))                   /* check ready mode */
+    {
+        *enable = ADS1115_BOOL_TRUE;                                                           /* enabled */
+    }
+    else
+    {
+        *enable = ADS1115_BOOL_FALSE;                                                          /* disabled */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
 /**
  * @brief      convert a adc value to a register raw data
  * @param[in]  *handle points to an ads1115 handle structure
@@ -1254,7 +2326,7 @@ uint8_t ads1115_get_compare_threshold(ads1115_handle_t *handle, int16_t *high_th
  *             - 1 convert to register failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_convert_to_register(ads1115_handle_t *handle, float s, int16_t *reg)
 {  
@@ -1271,7 +2343,7 @@ uint8_t ads1115_convert_to_register(ads1115_handle_t *handle, float s, int16_t *
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1323,7 +2395,7 @@ uint8_t ads1115_convert_to_register(ads1115_handle_t *handle, float s, int16_t *
  *             - 1 convert to data failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_convert_to_data(ads1115_handle_t *handle, int16_t reg, float *s)
 {
@@ -1340,7 +2412,7 @@ uint8_t ads1115_convert_to_data(ads1115_handle_t *handle, int16_t reg, float *s)
         return 3;                                                                          /* return error */
     }
     
-    res = a_ads1115_iic_multiple_read(handle, ADS1115_REG_CONFIG, (int16_t *)&conf);       /* read config */
+    res = a_ads1115_config_read(handle, &conf);                                            /* read config */
     if (res != 0)                                                                          /* check error */
     {
         handle->debug_print("ads1115: read config failed.\n");                             /* read config failed */
@@ -1405,6 +2477,13 @@ uint8_t ads1115_set_reg(ads1115_handle_t *handle, uint8_t reg, int16_t value)
         return 3;                                                  /* return error */
     }
     
+    if (reg == ADS1115_REG_CONFIG)                                 /* check config */
+    {
+        a_ads1115_lock(handle);                                    /* lock the bus */
+        
+        return a_ads1115_config_end(handle, (uint16_t)value);      /* write config and shadow */
+    }
+    
     return a_ads1115_iic_multiple_write(handle, reg, value);       /* write reg */
 }
 
@@ -179,6 +179,14 @@ typedef struct ads1115_handle_s
     uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
+    uint64_t (*timestamp_us)(void);                                                     /**< point to a timestamp_us function address */
+    void (*delay_until_us)(uint64_t deadline_us);                                       /**< point to a delay_until_us function address */
+    uint8_t (*ready_wait)(uint32_t timeout_ms, uint64_t *timestamp_us);                 /**< point to a ready_wait function address */
+    void (*lock)(void *bus);                                                            /**< point to a bus lock function address */
+    void (*unlock)(void *bus);                                                          /**< point to a bus unlock function address */
+    void *bus;                                                                          /**< bus lock argument shared by the handles of one bus */
+    uint32_t oscillator_scale;                                                          /**< measured over datasheet conversion period in 1/65536, 0 means not measured */
+    uint32_t shadow;                                                                    /**< shadow config in bits 15:0 and valid flag in bit 16, stored and loaded atomically */
     uint8_t inited;                                                                     /**< inited flag */
 } ads1115_handle_t;
 
@@ -198,6 +206,28 @@ typedef struct ads1115_info_s
     uint32_t driver_version;           /**< driver version */
 } ads1115_info_t;
 
+/**
+ * @brief     build a config register word at compile time
+ * @param[in] CHANNEL is the adc channel
+ * @param[in] RANGE is the adc range
+ * @param[in] RATE is the adc sample rate
+ * @param[in] SINGLE is a bool value, true means single shot mode
+ * @param[in] COMPARE is the interrupt compare mode
+ * @param[in] PIN is the alert active level
+ * @param[in] LATCH is a bool value, true means a latched alert
+ * @param[in] QUEUE is the interrupt comparator queue
+ * @note      every field is masked to its bit width, so any enumeration value gives a valid word
+ */
+#define ADS1115_CONFIG_WORD(CHANNEL, RANGE, RATE, SINGLE, COMPARE, PIN, LATCH, QUEUE)  \
+    ((uint16_t)((((uint16_t)(CHANNEL) & 0x07) << 12) |                                 \
+                (((uint16_t)(RANGE) & 0x07) << 9) |                                    \
+                (((uint16_t)(SINGLE) & 0x01) << 8) |                                   \
+                (((uint16_t)(RATE) & 0x07) << 5) |                                     \
+                (((uint16_t)(COMPARE) & 0x01) << 4) |                                  \
+                (((uint16_t)(PIN) & 0x01) << 3) |                                      \
+                (((uint16_t)(LATCH) & 0x01) << 2) |                                    \
+                ((uint16_t)(QUEUE) & 0x03)))
+
 /**
  * @}
  */
@@ -265,6 +295,54 @@ typedef struct ads1115_info_s
  */
 #define DRIVER_ADS1115_LINK_DEBUG_PRINT(HANDLE, FUC) (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] FUC points to a timestamp_us function address
+ * @note      optional, linked together with delay_until_us
+ */
+#define DRIVER_ADS1115_LINK_TIMESTAMP_US(HANDLE, FUC)   (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     link delay_until_us function
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] FUC points to a delay_until_us function address
+ * @note      optional, the conversion waits use whole ms without it
+ */
+#define DRIVER_ADS1115_LINK_DELAY_UNTIL_US(HANDLE, FUC) (HANDLE)->delay_until_us = FUC
+
+/**
+ * @brief     link ready_wait function
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] FUC points to a ready_wait function address
+ * @note      optional, waits for the next conversion ready edge and returns 0 with its timestamp
+ */
+#define DRIVER_ADS1115_LINK_READY_WAIT(HANDLE, FUC)     (HANDLE)->ready_wait = FUC
+
+/**
+ * @brief     link lock function
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] FUC points to a lock function address
+ * @note      optional, handles on one bus link the same lock
+ */
+#define DRIVER_ADS1115_LINK_LOCK(HANDLE, FUC)        (HANDLE)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] FUC points to an unlock function address
+ * @note      optional, handles on one bus link the same unlock
+ */
+#define DRIVER_ADS1115_LINK_UNLOCK(HANDLE, FUC)      (HANDLE)->unlock = FUC
+
+/**
+ * @brief     link the bus lock argument
+ * @param[in] HANDLE points to an ads1115 handle structure
+ * @param[in] BUS is the argument passed to lock and unlock
+ * @note      optional, handles on one bus link the same argument
+ */
+#define DRIVER_ADS1115_LINK_BUS(HANDLE, BUS)         (HANDLE)->bus = BUS
+
 /**
  * @}
  */
@@ -349,6 +427,46 @@ uint8_t ads1115_deinit(ads1115_handle_t *handle);
  */
 uint8_t ads1115_single_read(ads1115_handle_t *handle, int16_t *raw, float *v);
 
+/**
+ * @brief      start a single conversion without waiting
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *wait_us points to a conversion wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the result is ready after wait_us and can be checked by ads1115_get_single_read_status
+ */
+uint8_t ads1115_start_single_read(ads1115_handle_t *handle, uint32_t *wait_us);
+
+/**
+ * @brief      get the single conversion status
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *finished points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get single read status failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ads1115_get_single_read_status(ads1115_handle_t *handle, ads1115_bool_t *finished);
+
+/**
+ * @brief      read the result of a finished single conversion
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *v points to a converted adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config comes from the shadow without a bus transaction once it is valid
+ */
+uint8_t ads1115_get_single_read(ads1115_handle_t *handle, int16_t *raw, float *v);
+
 /**
  * @brief     start the chip reading
  * @param[in] *handle points to an ads1115 handle structure
@@ -384,10 +502,36 @@ uint8_t ads1115_stop_continuous_read(ads1115_handle_t *handle);
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       this function can be used only after run ads1115_start_continuous_read
- *             and can be stopped by ads1115_stop_continuous_read
+ *             and can be stopped by ads1115_stop_continuous_read,
+ *             the range comes from the shadow of this handle, which is stale after another handle
+ *             or process writes the config until ads1115_get_config_word resyncs it
  */
 uint8_t ads1115_continuous_read(ads1115_handle_t *handle,int16_t *raw, float *v);
 
+/**
+ * @brief      read a block of samples in continuous mode
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @param[out] *v points to a converted adc buffer, NULL for raw only
+ * @param[out] *timestamp_us points to a timestamp buffer, NULL for none
+ * @param[out] *fresh points to a fresh sample flag buffer, NULL for none
+ * @param[in]  n is the number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 1 read n failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 chip is not in continuous mode
+ * @note       the config is fetched once, each sample is one iic transaction,
+ *             the samples follow the ready edges when ready_wait is linked and the conversion ready pin is enabled,
+ *             else they are paced by the measured conversion period or the datasheet period plus the 10% oscillator tolerance,
+ *             a timer paced read that wakes late can leave the next read less than one conversion apart and return
+ *             the same conversion twice, such a sample is flagged ADS1115_BOOL_FALSE in fresh,
+ *             ready edge and whole ms paced samples are always fresh
+ */
+uint8_t ads1115_read_n(ads1115_handle_t *handle, int16_t *raw, float *v, uint64_t *timestamp_us,
+                       ads1115_bool_t *fresh, uint32_t n);
+
 /**
  * @brief     set the adc channel
  * @param[in] *handle points to an ads1115 handle structure
@@ -410,7 +554,7 @@ uint8_t ads1115_set_channel(ads1115_handle_t *handle, ads1115_channel_t channel)
  *             - 1 get channel failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_channel(ads1115_handle_t *handle, ads1115_channel_t *channel);
 
@@ -436,7 +580,7 @@ uint8_t ads1115_set_range(ads1115_handle_t *handle, ads1115_range_t range);
  *             - 1 get range failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_range(ads1115_handle_t *handle, ads1115_range_t *range);
 
@@ -462,10 +606,161 @@ uint8_t ads1115_set_rate(ads1115_handle_t *handle, ads1115_rate_t rate);
  *             - 1 get rate failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_rate(ads1115_handle_t *handle, ads1115_rate_t *rate);
 
+/**
+ * @brief     set the measured conversion period
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] rate is the sample rate the period was measured at
+ * @param[in] us is the conversion period in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      kept as the oscillator scale against the datasheet period, so it follows later rate changes,
+ *            the waits use it plus a 2% margin, 0 means the datasheet period of the current rate
+ *            plus the 10% oscillator tolerance
+ */
+uint8_t ads1115_set_conversion_period(ads1115_handle_t *handle, ads1115_rate_t rate, uint32_t us);
+
+/**
+ * @brief      get the measured conversion period
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[in]  rate is the sample rate to get the period of
+ * @param[out] *us points to a conversion period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       0 when no period has been measured
+ */
+uint8_t ads1115_get_conversion_period(ads1115_handle_t *handle, ads1115_rate_t rate, uint32_t *us);
+
+/**
+ * @brief     get the datasheet conversion period of a rate
+ * @param[in] rate is the sample rate
+ * @return    period in us, 0 for an invalid rate
+ * @note      the oscillator runs within 10% of it
+ */
+uint32_t ads1115_rate_to_period_us(ads1115_rate_t rate);
+
+/**
+ * @brief     get the nominal samples per second of a rate
+ * @param[in] rate is the sample rate
+ * @return    samples per second, 0 for an invalid rate
+ * @note      none
+ */
+uint32_t ads1115_rate_to_sps(ads1115_rate_t rate);
+
+/**
+ * @brief     get the full scale voltage of a range
+ * @param[in] range is the adc range
+ * @return    full scale in volts, 0 for an invalid range
+ * @note      one count is the full scale divided by 32768
+ */
+float ads1115_range_to_full_scale_v(ads1115_range_t range);
+
+/**
+ * @brief      get the conversion wait time of the current rate
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *us points to a wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the measured period plus 2% when set, else the datasheet period plus the 10% oscillator tolerance,
+ *             the rate comes from the shadow of this handle, which is stale after another handle
+ *             or process writes the config until ads1115_get_config_word resyncs it
+ */
+uint8_t ads1115_get_conversion_time(ads1115_handle_t *handle, uint32_t *us);
+
+/**
+ * @brief     set the whole config register in one write
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] conf is the config register word
+ * @return    status code
+ *            - 0 success
+ *            - 1 set config word failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the os bit is ignored, build conf with ADS1115_CONFIG_WORD
+ */
+uint8_t ads1115_set_config_word(ads1115_handle_t *handle, uint16_t conf);
+
+/**
+ * @brief     set the config register and the compare thresholds in one transaction
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] conf is the config register word
+ * @param[in] high_threshold is the interrupt high threshold
+ * @param[in] low_threshold is the interrupt low threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set compare config word failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the bus lock is held for all writes, the new mux goes in first with the comparator
+ *            disabled, then the thresholds, then conf, so no conversion of the old channel is
+ *            compared against the new thresholds, the os bit is ignored
+ */
+uint8_t ads1115_set_compare_config_word(ads1115_handle_t *handle, uint16_t conf,
+                                        int16_t high_threshold, int16_t low_threshold);
+
+/**
+ * @brief      get the whole config register
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config register word buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config word failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the os bit is masked out, the read goes to the bus and resyncs the shadow
+ */
+uint8_t ads1115_get_config_word(ads1115_handle_t *handle, uint16_t *conf);
+
+/**
+ * @brief      get the shadow config without a bus transaction
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *conf points to a config register word buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 shadow config is not valid
+ *             - 2 handle is NULL
+ * @note       the shadow is the last config this handle read for an update or wrote,
+ *             it takes no bus lock
+ */
+uint8_t ads1115_get_shadow_config(ads1115_handle_t *handle, uint16_t *conf);
+
+/**
+ * @brief      read the conversion register only
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *raw points to a raw adc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read raw failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one iic transaction with no config read back,
+ *             the caller converts raw with the range it configured
+ */
+uint8_t ads1115_read_raw(ads1115_handle_t *handle, int16_t *raw);
+
+/**
+ * @brief      start a single conversion with a whole config word
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[in]  conf is the config register word
+ * @param[out] *wait_us points to a conversion wait time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start single read word failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one iic transaction that switches the mux, range and rate and starts,
+ *             the mode and os bits are set here, build conf with ADS1115_CONFIG_WORD
+ */
+uint8_t ads1115_start_single_read_word(ads1115_handle_t *handle, uint16_t conf, uint32_t *wait_us);
+
 /**
  * @}
  */
@@ -499,7 +794,7 @@ uint8_t ads1115_set_alert_pin(ads1115_handle_t *handle, ads1115_pin_t pin);
  *             - 1 get alert pin failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note      none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_alert_pin(ads1115_handle_t *handle, ads1115_pin_t *pin);
 
@@ -525,7 +820,7 @@ uint8_t ads1115_set_compare_mode(ads1115_handle_t *handle, ads1115_compare_t com
  *             - 1 get compare mode failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_compare_mode(ads1115_handle_t *handle, ads1115_compare_t *compare);
 
@@ -551,7 +846,7 @@ uint8_t ads1115_set_comparator_queue(ads1115_handle_t *handle, ads1115_comparato
  *             - 1 get comparator queue failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_comparator_queue(ads1115_handle_t *handle, ads1115_comparator_queue_t *comparator_queue);
 
@@ -577,7 +872,7 @@ uint8_t ads1115_set_compare(ads1115_handle_t *handle, ads1115_bool_t enable);
  *             - 1 get compare failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_get_compare(ads1115_handle_t *handle, ads1115_bool_t *enable);
 
@@ -609,6 +904,32 @@ uint8_t ads1115_set_compare_threshold(ads1115_handle_t *handle, int16_t high_thr
  */
 uint8_t ads1115_get_compare_threshold(ads1115_handle_t *handle, int16_t *high_threshold, int16_t *low_threshold);
 
+/**
+ * @brief     enable or disable the conversion ready function of the alert pin
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] enable is a bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set conversion ready pin failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enable overwrites the compare threshold and disable sets the comparator queue to none
+ */
+uint8_t ads1115_set_conversion_ready_pin(ads1115_handle_t *handle, ads1115_bool_t enable);
+
+/**
+ * @brief      get the conversion ready function status of the alert pin
+ * @param[in]  *handle points to an ads1115 handle structure
+ * @param[out] *enable points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion ready pin failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the config comes from the shadow without a bus transaction once it is valid
+ */
+uint8_t ads1115_get_conversion_ready_pin(ads1115_handle_t *handle, ads1115_bool_t *enable);
+
 /**
  * @brief      convert a adc value to a register raw data
  * @param[in]  *handle points to an ads1115 handle structure
@@ -619,7 +940,7 @@ uint8_t ads1115_get_compare_threshold(ads1115_handle_t *handle, int16_t *high_th
  *             - 1 convert to register failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_convert_to_register(ads1115_handle_t *handle, float s, int16_t *reg);
 
@@ -633,7 +954,7 @@ uint8_t ads1115_convert_to_register(ads1115_handle_t *handle, float s, int16_t *
  *             - 1 convert to data failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the config comes from the shadow without a bus transaction once it is valid
  */
 uint8_t ads1115_convert_to_data(ads1115_handle_t *handle, int16_t reg, float *s);
 
@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_align.c
+ * @brief     driver ads1115 align source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_align.h"
+
+/**
+ * @brief align mask definition
+ */
+#define ADS1115_ALIGN_MASK (ADS1115_ALIGN_HISTORY - 1)        /**< history slot mask */
+
+/**
+ * @brief     initialize an align stage
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] channels is the number of channels per scan
+ * @param[in] method is the interpolation method
+ * @param[in] period_us is the grid period
+ * @param[in] max_gap_us is the longest gap between two samples of a channel that is interpolated
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 channels is 0 or above ADS1115_ALIGN_MAX_CHANNELS, method is invalid,
+ *              period_us is 0 or max_gap_us is 0
+ * @note      the grid starts at the first time every channel can be interpolated at
+ */
+uint8_t ads1115_align_init(ads1115_align_t *align, uint8_t channels, ads1115_align_method_t method,
+                           uint32_t period_us, uint32_t max_gap_us)
+{
+    uint8_t c;
+    
+    if (align == NULL)                                                              /* check align */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if ((channels == 0) || (channels > ADS1115_ALIGN_MAX_CHANNELS) ||
+        (method > ADS1115_ALIGN_METHOD_CUBIC) || (period_us == 0) ||
+        (max_gap_us == 0))                                                          /* check the config */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    for (c = 0; c < ADS1115_ALIGN_MAX_CHANNELS; c++)                                /* every channel */
+    {
+        align->count[c] = 0;                                                        /* no samples */
+    }
+    align->grid_us = 0;                                                             /* init 0 */
+    align->period_us = period_us;                                                   /* set the period */
+    align->max_gap_us = max_gap_us;                                                 /* set the gap */
+    align->channels = channels;                                                     /* set the channels */
+    align->method = (uint8_t)method;                                                /* set the method */
+    align->started = 0;                                                             /* no grid yet */
+    align->frames = 0;                                                              /* init 0 */
+    align->skipped = 0;                                                             /* init 0 */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     set the grid period
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] period_us is the grid period
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 period_us is 0
+ * @note      usually the measured scan period, so one frame leaves per scan
+ */
+uint8_t ads1115_align_set_period(ads1115_align_t *align, uint32_t period_us)
+{
+    if (align == NULL)                                           /* check align */
+    {
+        return 2;                                                /* return error */
+    }
+    if (period_us == 0)                                          /* check the period */
+    {
+        return 4;                                                /* return error */
+    }
+    
+    align->period_us = period_us;                                /* set the period */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     push one scanned sample
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] channel is the index of the sample in the scan
+ * @param[in] raw is the raw sample
+ * @param[in] timestamp_us is the time the sample was taken
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 channel is out of range or timestamp_us is not after the previous sample of the channel
+ * @note      the timestamp is the actual conversion time, not the scan start
+ */
+uint8_t ads1115_align_push(ads1115_align_t *align, uint8_t channel, int16_t raw, uint64_t timestamp_us)
+{
+    uint32_t n;
+    
+    if (align == NULL)                                                                      /* check align */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (channel >= align->channels)                                                         /* check the channel */
+    {
+        return 4;                                                                           /* return error */
+    }
+    n = align->count[channel];                                                              /* get the count */
+    if ((n != 0) && (timestamp_us <= align->t[(n - 1) & ADS1115_ALIGN_MASK][channel]))      /* check the time order */
+    {
+        return 4;                                                                           /* return error */
+    }
+    
+    align->t[n & ADS1115_ALIGN_MASK][channel] = timestamp_us;                               /* save the time */
+    align->raw[n & ADS1115_ALIGN_MASK][channel] = raw;                                      /* save the sample */
+    n++;                                                                                    /* count */
+    if (n >= 2 * ADS1115_ALIGN_HISTORY)                                                     /* fold the count */
+    {
+        n -= ADS1115_ALIGN_HISTORY;                                                         /* same slots, no wrap */
+    }
+    align->count[channel] = n;                                                              /* set the count */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the next aligned frame
+ * @param[in]  *align points to an ads1115 align structure
+ * @param[out] *frame points to an align frame buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no frame is ready
+ *             - 2 align or frame is NULL
+ * @note       call until it returns 1 after every scan, grid points whose neighbours already
+ *             left the history or span a gap are skipped and counted
+ */
+uint8_t ads1115_align_get_frame(ads1115_align_t *align, ads1115_align_frame_t *frame)
+{
+    uint8_t c;
+    uint8_t j;
+    uint8_t m;
+    uint8_t before;
+    uint8_t points;
+    uint8_t lost;
+    uint8_t ready;
+    uint32_t i;
+    uint32_t n;
+    uint32_t lo;
+    uint32_t steps;
+    uint32_t k;
+    uint32_t base[ADS1115_ALIGN_MAX_CHANNELS];
+    uint64_t earliest;
+    uint64_t g_min;
+    float a[4];
+    float w[4][ADS1115_ALIGN_MAX_CHANNELS];
+    float x[4][ADS1115_ALIGN_MAX_CHANNELS];
+    
+    if ((align == NULL) || (frame == NULL))                                                  /* check the buffers */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    before = (align->method == ADS1115_ALIGN_METHOD_CUBIC) ? 2 : 1;                          /* neighbours on each side */
+    points = before * 2;                                                                     /* interpolation points */
+    if (align->started == 0)                                                                 /* place the grid */
+    {
+        g_min = 0;                                                                           /* init 0 */
+        for (c = 0; c < align->channels; c++)                                                /* every channel */
+        {
+            n = align->count[c];                                                             /* get the count */
+            if (n < before)                                                                  /* check the history */
+            {
+                return 1;                                                                    /* not ready */
+            }
+            lo = (n > ADS1115_ALIGN_HISTORY) ? (n - ADS1115_ALIGN_HISTORY) : 0;              /* oldest sample */
+            earliest = align->t[(lo + before - 1) & ADS1115_ALIGN_MASK][c];                  /* earliest usable time */
+            if (earliest > g_min)                                                            /* latest of all */
+            {
+                g_min = earliest;                                                            /* save */
+            }
+        }
+        align->grid_us = g_min;                                                              /* first grid point */
+        align->started = 1;                                                                  /* placed */
+    }
+    
+    while (1)                                                                                /* find a usable grid point */
+    {
+        lost = 0;                                                                            /* init 0 */
+        ready = 1;                                                                           /* init 1 */
+        g_min = 0;                                                                           /* init 0 */
+        for (c = 0; c < align->channels; c++)                                                /* every channel */
+        {
+            n = align->count[c];                                                             /* get the count */
+            lo = (n > ADS1115_ALIGN_HISTORY) ? (n - ADS1115_ALIGN_HISTORY) : 0;              /* oldest sample */
+            earliest = align->t[(lo + before - 1) & ADS1115_ALIGN_MASK][c];                  /* earliest usable time */
+            if (earliest > align->grid_us)                                                   /* the neighbours left */
+            {
+                lost = 1;                                                                    /* set lost */
+                if (earliest > g_min)                                                        /* latest of all */
+                {
+                    g_min = earliest;                                                        /* save */
+                }
+                
+                continue;                                                                    /* next channel */
+            }
+            for (i = n - 1; align->t[i & ADS1115_ALIGN_MASK][c] > align->grid_us; i--)       /* last sample not after the grid */
+            {
+            }
+            if (i + before > n - 1)                                                          /* later neighbours missing */
+            {
+                ready = 0;                                                                   /* wait */
+                
+                continue;                                                                    /* next channel */
+            }
+            base[c] = i + 1 - before;                                                        /* first point */
+            for (k = base[c]; k < base[c] + points - 1; k++)                                 /* every neighbour interval */
+            {
+                if (align->t[(k + 1) & ADS1115_ALIGN_MASK][c] -
+                    align->t[k & ADS1115_ALIGN_MASK][c] > align->max_gap_us)                 /* a gap */
+                {
+                    break;                                                                   /* found */
+                }
+            }
+            if (k < base[c] + points - 1)                                                    /* the points span a gap */
+            {
+                if (k + before > n - 1)                                                      /* the restart is not known yet */
+                {
+                    ready = 0;                                                               /* wait */
+                    
+                    continue;                                                                /* next channel */
+                }
+                lost = 1;                                                                    /* set lost */
+                earliest = align->t[(k + before) & ADS1115_ALIGN_MASK][c];                   /* first point clear of the gap */
+                if (earliest > g_min)                                                        /* latest of all */
+                {
+                    g_min = earliest;                                                        /* save */
+                }
+            }
+        }
+        if (lost != 0)                                                                       /* skip the lost points */
+        {
+            steps = (uint32_t)((g_min - align->grid_us + align->period_us - 1) / align->period_us);
+            align->grid_us += (uint64_t)steps * align->period_us;                            /* jump */
+            align->skipped += steps;                                                         /* count */
+            
+            continue;                                                                        /* check again */
+        }
+        if (ready == 0)                                                                      /* check ready */
+        {
+            return 1;                                                                        /* not ready */
+        }
+        
+        break;                                                                               /* usable */
+    }
+    
+    /* lagrange weights on the actual times, each channel has its own skew */
+    for (c = 0; c < align->channels; c++)                                                    /* every channel */
+    {
+        for (j = 0; j < points; j++)                                                         /* gather the points */
+        {
+            i = (base[c] + j) & ADS1115_ALIGN_MASK;                                          /* slot */
+            a[j] = (float)(int64_t)(align->t[i][c] - align->grid_us);                        /* time to the grid */
+            x[j][c] = (float)align->raw[i][c];                                               /* sample */
+        }
+        for (j = 0; j < points; j++)                                                         /* every weight */
+        {
+            w[j][c] = 1.0f;                                                                  /* init 1 */
+            for (m = 0; m < points; m++)                                                     /* every other point */
+            {
+                if (m != j)                                                                  /* skip itself */
+                {
+                    w[j][c] *= a[m] / (a[m] - a[j]);                                         /* basis at the grid */
+                }
+            }
+        }
+    }
+    
+    /* one fixed length loop across the channels, laid out for the compiler to vectorize */
+    for (c = 0; c < ADS1115_ALIGN_MAX_CHANNELS; c++)                                         /* every value */
+    {
+        frame->value[c] = 0.0f;                                                              /* init 0 */
+    }
+    for (j = 0; j < points; j++)                                                             /* every point */
+    {
+        for (c = 0; c < align->channels; c++)                                                /* every channel */
+        {
+            frame->value[c] += w[j][c] * x[j][c];                                            /* weighted sum */
+        }
+    }
+    frame->timestamp_us = align->grid_us;                                                    /* set the time */
+    align->grid_us += align->period_us;                                                      /* next grid point */
+    align->frames++;                                                                         /* count */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the align counters
+ * @param[in]  *align points to an ads1115 align structure
+ * @param[out] *frames points to a frame counter buffer
+ * @param[out] *skipped points to a skipped grid point counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 align is NULL
+ * @note       none
+ */
+uint8_t ads1115_align_get_counters(ads1115_align_t *align, uint32_t *frames, uint32_t *skipped)
+{
+    if (align == NULL)                                           /* check align */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    if (frames != NULL)                                          /* check frames */
+    {
+        *frames = align->frames;                                 /* get the frame counter */
+    }
+    if (skipped != NULL)                                         /* check skipped */
+    {
+        *skipped = align->skipped;                               /* get the skipped counter */
+    }
+    
+    return 0;                                                    /* success return 0 */
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_align.h
+ * @brief     driver ads1115 align header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_ALIGN_H
+#define DRIVER_ADS1115_ALIGN_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_align_driver ads1115 align driver function
+ * @brief    ads1115 align driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 align definition
+ */
+#ifndef ADS1115_ALIGN_MAX_CHANNELS
+    #define ADS1115_ALIGN_MAX_CHANNELS 8        /**< channels per scan at most */
+#endif
+#define ADS1115_ALIGN_HISTORY          8        /**< samples kept per channel, a power of 2 */
+
+/**
+ * @brief ads1115 align method enumeration definition
+ */
+typedef enum
+{
+    ADS1115_ALIGN_METHOD_LINEAR = 0x00,        /**< two neighbours, one scan of delay */
+    ADS1115_ALIGN_METHOD_CUBIC  = 0x01,        /**< four neighbours, two scans of delay, may overshoot a step */
+} ads1115_align_method_t;
+
+/**
+ * @brief ads1115 align frame structure definition
+ */
+typedef struct ads1115_align_frame_s
+{
+    uint64_t timestamp_us;                              /**< grid time every value belongs to */
+    float value[ADS1115_ALIGN_MAX_CHANNELS];            /**< interpolated values in raw counts */
+} ads1115_align_frame_t;
+
+/**
+ * @brief ads1115 align structure definition
+ */
+typedef struct ads1115_align_s
+{
+    uint64_t t[ADS1115_ALIGN_HISTORY][ADS1115_ALIGN_MAX_CHANNELS];        /**< sample times, one row per history slot */
+    int16_t raw[ADS1115_ALIGN_HISTORY][ADS1115_ALIGN_MAX_CHANNELS];       /**< raw samples, one row per history slot */
+    uint32_t count[ADS1115_ALIGN_MAX_CHANNELS];                           /**< samples pushed per channel, folded below twice the history */
+    uint64_t grid_us;                                                     /**< next grid time */
+    uint32_t period_us;                                                   /**< grid period */
+    uint32_t max_gap_us;                                                  /**< longest gap between neighbours that is interpolated */
+    uint8_t channels;                                                     /**< channels per scan */
+    uint8_t method;                                                       /**< interpolation method */
+    uint8_t started;                                                      /**< 1 once the grid is placed */
+    uint32_t frames;                                                      /**< frame counter */
+    uint32_t skipped;                                                     /**< grid points whose neighbours were lost or too far apart */
+} ads1115_align_t;
+
+/**
+ * @brief     initialize an align stage
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] channels is the number of channels per scan
+ * @param[in] method is the interpolation method
+ * @param[in] period_us is the grid period
+ * @param[in] max_gap_us is the longest gap between two samples of a channel that is interpolated
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 channels is 0 or above ADS1115_ALIGN_MAX_CHANNELS, method is invalid,
+ *              period_us is 0 or max_gap_us is 0
+ * @note      the grid starts at the first time every channel can be interpolated at
+ */
+uint8_t ads1115_align_init(ads1115_align_t *align, uint8_t channels, ads1115_align_method_t method,
+                           uint32_t period_us, uint32_t max_gap_us);
+
+/**
+ * @brief     set the grid period
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] period_us is the grid period
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 period_us is 0
+ * @note      usually the measured scan period, so one frame leaves per scan
+ */
+uint8_t ads1115_align_set_period(ads1115_align_t *align, uint32_t period_us);
+
+/**
+ * @brief     push one scanned sample
+ * @param[in] *align points to an ads1115 align structure
+ * @param[in] channel is the index of the sample in the scan
+ * @param[in] raw is the raw sample
+ * @param[in] timestamp_us is the time the sample was taken
+ * @return    status code
+ *            - 0 success
+ *            - 2 align is NULL
+ *            - 4 channel is out of range or timestamp_us is not after the previous sample of the channel
+ * @note      the timestamp is the actual conversion time, not the scan start
+ */
+uint8_t ads1115_align_push(ads1115_align_t *align, uint8_t channel, int16_t raw, uint64_t timestamp_us);
+
+/**
+ * @brief      get the next aligned frame
+ * @param[in]  *align points to an ads1115 align structure
+ * @param[out] *frame points to an align frame buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no frame is ready
+ *             - 2 align or frame is NULL
+ * @note       call until it returns 1 after every scan, grid points whose neighbours already
+ *             left the history or span a gap are skipped and counted
+ */
+uint8_t ads1115_align_get_frame(ads1115_align_t *align, ads1115_align_frame_t *frame);
+
+/**
+ * @brief      get the align counters
+ * @param[in]  *align points to an ads1115 align structure
+ * @param[out] *frames points to a frame counter buffer
+ * @param[out] *skipped points to a skipped grid point counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 align is NULL
+ * @note       none
+ */
+uint8_t ads1115_align_get_counters(ads1115_align_t *align, uint32_t *frames, uint32_t *skipped);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
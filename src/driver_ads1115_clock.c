@@ -0,0 +1,314 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_clock.c
+ * @brief     driver ads1115 clock source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_clock.h"
+
+/**
+ * @brief     refit the period line over the edge window
+ * @param[in] *clock points to an ads1115 clock structure
+ * @note      the slope is only accepted inside 20% of the datasheet period
+ */
+static void a_ads1115_clock_fit(ads1115_clock_t *clock)
+{
+    uint8_t i;
+    uint8_t first;
+    uint8_t idx;
+    double n;
+    double x;
+    double y;
+    double sx = 0.0;
+    double sy = 0.0;
+    double sxx = 0.0;
+    double sxy = 0.0;
+    double den;
+    double slope;
+    
+    first = (uint8_t)((clock->pos + ADS1115_CLOCK_WINDOW - clock->len) % ADS1115_CLOCK_WINDOW);        /* oldest edge */
+    for (i = 0; i < clock->len; i++)                                                                 /* sum the window */
+    {
+        idx = (uint8_t)((first + i) % ADS1115_CLOCK_WINDOW);                                         /* ring index */
+        x = (double)(clock->sample[idx] - clock->sample[first]);                                     /* relative sample */
+        y = (double)(clock->timestamp_us[idx] - clock->timestamp_us[first]);                         /* relative time */
+        sx += x;                                                                                     /* sum x */
+        sy += y;                                                                                     /* sum y */
+        sxx += x * x;                                                                                /* sum xx */
+        sxy += x * y;                                                                                /* sum xy */
+    }
+    n = (double)clock->len;                                                                          /* window length */
+    den = n * sxx - sx * sx;                                                                         /* denominator */
+    if (den <= 0.0)                                                                                  /* check degenerate */
+    {
+        return;                                                                                      /* keep estimate */
+    }
+    slope = (n * sxy - sx * sy) / den;                                                               /* least squares slope */
+    if ((slope < (double)clock->nominal_period_us * 0.8) ||
+        (slope > (double)clock->nominal_period_us * 1.2))                                            /* check tolerance */
+    {
+        return;                                                                                      /* keep estimate */
+    }
+    clock->period_us = slope;                                                                        /* set period */
+    clock->base_us = clock->timestamp_us[first];                                                     /* set base */
+    clock->mean_us = sy / n;                                                                         /* set mean time */
+    clock->mean_sample = (double)clock->sample[first] + sx / n;                                      /* set mean sample */
+}
+
+/**
+ * @brief     initialize the clock recovery
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] rate is the configured sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 2 clock is NULL
+ *            - 4 rate is invalid
+ * @note      none
+ */
+uint8_t ads1115_clock_init(ads1115_clock_t *clock, ads1115_rate_t rate)
+{
+    if (clock == NULL)                                                  /* check clock */
+    {
+        return 2;                                                       /* return error */
+    }
+    if ((uint32_t)rate > (uint32_t)ADS1115_RATE_860SPS)                 /* check rate */
+    {
+        return 4;                                                       /* return error */
+    }
+    
+    memset(clock, 0, sizeof(ads1115_clock_t));                          /* clear the clock */
+    clock->nominal_period_us = ads1115_rate_to_period_us(rate);         /* set nominal period */
+    clock->rate = rate;                                                 /* save rate */
+    clock->period_us = (double)clock->nominal_period_us;                /* start from nominal */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     add a conversion ready edge timestamp
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] timestamp_us is the edge timestamp in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 edge is rejected
+ *            - 2 clock is NULL
+ * @note      gaps of several periods are counted as missed edges
+ */
+uint8_t ads1115_clock_update(ads1115_clock_t *clock, uint64_t timestamp_us)
+{
+    uint64_t prev;
+    uint64_t gap;
+    uint64_t period;
+    uint32_t steps;
+    
+    if (clock == NULL)                                                                            /* check clock */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    
+    if (clock->len != 0)                                                                          /* not the first edge */
+    {
+        prev = clock->timestamp_us[(clock->pos + ADS1115_CLOCK_WINDOW - 1) % ADS1115_CLOCK_WINDOW]; /* previous edge */
+        if (timestamp_us <= prev)                                                                 /* check order */
+        {
+            clock->rejected++;                                                                    /* rejected++ */
+            
+            return 1;                                                                             /* return error */
+        }
+        gap = timestamp_us - prev;                                                                /* edge gap */
+        period = (uint64_t)(clock->period_us + 0.5);                                              /* current period */
+        steps = (uint32_t)((gap + period / 2) / period);                                          /* elapsed periods */
+        if (steps == 0)                                                                           /* check glitch */
+        {
+            clock->rejected++;                                                                    /* rejected++ */
+            
+            return 1;                                                                             /* return error */
+        }
+        clock->missed += steps - 1;                                                               /* count missed edges */
+        clock->last_sample += steps;                                                              /* advance sample */
+    }
+    clock->timestamp_us[clock->pos] = timestamp_us;                                               /* save timestamp */
+    clock->sample[clock->pos] = clock->last_sample;                                               /* save sample */
+    clock->pos = (uint8_t)((clock->pos + 1) % ADS1115_CLOCK_WINDOW);                              /* next position */
+    if (clock->len < ADS1115_CLOCK_WINDOW)                                                        /* check length */
+    {
+        clock->len++;                                                                             /* length++ */
+    }
+    if (clock->len == 1)                                                                          /* first edge */
+    {
+        clock->base_us = timestamp_us;                                                            /* anchor the line */
+    }
+    else
+    {
+        a_ads1115_clock_fit(clock);                                                               /* refit */
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the estimated conversion period
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *period_us points to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_period(ads1115_clock_t *clock, float *period_us)
+{
+    if (clock == NULL)                              /* check clock */
+    {
+        return 2;                                   /* return error */
+    }
+    if (clock->len < 2)                             /* check edges */
+    {
+        return 1;                                   /* return error */
+    }
+    
+    *period_us = (float)clock->period_us;           /* get period */
+    
+    return 0;                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the corrected sample rate
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *sps points to a sample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_rate(ads1115_clock_t *clock, float *sps)
+{
+    if (clock == NULL)                                   /* check clock */
+    {
+        return 2;                                        /* return error */
+    }
+    if (clock->len < 2)                                  /* check edges */
+    {
+        return 1;                                        /* return error */
+    }
+    
+    *sps = (float)(1000000.0 / clock->period_us);        /* get rate */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the reconstructed time of a sample
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[in]  sample is the sample index counted from the first edge
+ * @param[out] *timestamp_us points to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_sample_time(ads1115_clock_t *clock, uint32_t sample, uint64_t *timestamp_us)
+{
+    double offset;
+    
+    if (clock == NULL)                                                                       /* check clock */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (clock->len < 2)                                                                      /* check edges */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    offset = clock->mean_us + clock->period_us * ((double)sample - clock->mean_sample);      /* offset from base */
+    if (offset < 0.0)                                                                        /* before base */
+    {
+        *timestamp_us = clock->base_us - (uint64_t)(-offset + 0.5);                          /* set timestamp */
+    }
+    else
+    {
+        *timestamp_us = clock->base_us + (uint64_t)(offset + 0.5);                           /* set timestamp */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the edge statistics
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *missed points to a missed edge counter buffer
+ * @param[out] *rejected points to a rejected edge counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_statistics(ads1115_clock_t *clock, uint32_t *missed, uint32_t *rejected)
+{
+    if (clock == NULL)                    /* check clock */
+    {
+        return 2;                         /* return error */
+    }
+    
+    *missed = clock->missed;              /* get missed */
+    *rejected = clock->rejected;          /* get rejected */
+    
+    return 0;                             /* success return 0 */
+}
+
+/**
+ * @brief     feed the estimated period back to the single shot wait as an oscillator scale
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 not enough edges
+ *            - 2 clock or handle is NULL
+ * @note      none
+ */
+uint8_t ads1115_clock_apply(ads1115_clock_t *clock, ads1115_handle_t *handle)
+{
+    if ((clock == NULL) || (handle == NULL))                                                      /* check clock and handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (clock->len < 2)                                                                           /* check edges */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    
+    return ads1115_set_conversion_period(handle, clock->rate,
+                                         (uint32_t)(clock->period_us + 0.5));                     /* set period */
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_clock.h
+ * @brief     driver ads1115 clock header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_CLOCK_H
+#define DRIVER_ADS1115_CLOCK_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_clock_driver ads1115 clock driver function
+ * @brief    ads1115 clock driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 clock window definition
+ */
+#ifndef ADS1115_CLOCK_WINDOW
+    #define ADS1115_CLOCK_WINDOW 32        /**< regression window length */
+#endif
+
+/**
+ * @brief ads1115 clock structure definition
+ */
+typedef struct ads1115_clock_s
+{
+    uint64_t timestamp_us[ADS1115_CLOCK_WINDOW];        /**< edge timestamp ring */
+    uint32_t sample[ADS1115_CLOCK_WINDOW];              /**< edge sample index ring */
+    uint64_t base_us;                                   /**< fitted line base timestamp */
+    double mean_us;                                     /**< fitted line mean time since base */
+    double mean_sample;                                 /**< fitted line mean sample index */
+    double period_us;                                   /**< estimated conversion period */
+    uint32_t nominal_period_us;                         /**< datasheet conversion period */
+    ads1115_rate_t rate;                                /**< conversion rate the edges belong to */
+    uint32_t last_sample;                               /**< last edge sample index */
+    uint32_t missed;                                    /**< missed edge counter */
+    uint32_t rejected;                                  /**< rejected edge counter */
+    uint8_t pos;                                        /**< ring write position */
+    uint8_t len;                                        /**< ring valid length */
+} ads1115_clock_t;
+
+/**
+ * @brief     initialize the clock recovery
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] rate is the configured sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 2 clock is NULL
+ *            - 4 rate is invalid
+ * @note      none
+ */
+uint8_t ads1115_clock_init(ads1115_clock_t *clock, ads1115_rate_t rate);
+
+/**
+ * @brief     add a conversion ready edge timestamp
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] timestamp_us is the edge timestamp in microseconds
+ * @return    status code
+ *            - 0 success
+ *            - 1 edge is rejected
+ *            - 2 clock is NULL
+ * @note      gaps of several periods are counted as missed edges
+ */
+uint8_t ads1115_clock_update(ads1115_clock_t *clock, uint64_t timestamp_us);
+
+/**
+ * @brief      get the estimated conversion period
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *period_us points to a period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_period(ads1115_clock_t *clock, float *period_us);
+
+/**
+ * @brief      get the corrected sample rate
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *sps points to a sample rate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_rate(ads1115_clock_t *clock, float *sps);
+
+/**
+ * @brief      get the reconstructed time of a sample
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[in]  sample is the sample index counted from the first edge
+ * @param[out] *timestamp_us points to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not enough edges
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_sample_time(ads1115_clock_t *clock, uint32_t sample, uint64_t *timestamp_us);
+
+/**
+ * @brief      get the edge statistics
+ * @param[in]  *clock points to an ads1115 clock structure
+ * @param[out] *missed points to a missed edge counter buffer
+ * @param[out] *rejected points to a rejected edge counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 clock is NULL
+ * @note       none
+ */
+uint8_t ads1115_clock_get_statistics(ads1115_clock_t *clock, uint32_t *missed, uint32_t *rejected);
+
+/**
+ * @brief     feed the estimated period back to the single shot wait as an oscillator scale
+ * @param[in] *clock points to an ads1115 clock structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 not enough edges
+ *            - 2 clock or handle is NULL
+ * @note      none
+ */
+uint8_t ads1115_clock_apply(ads1115_clock_t *clock, ads1115_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,516 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_codec.c
+ * @brief     driver ads1115 codec source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_codec.h"
+
+/**
+ * @brief codec rice definition
+ */
+#define CODEC_ESCAPE_Q        24        /**< unary length that escapes to a raw residual */
+#define CODEC_ESCAPE_BITS     18        /**< raw residual bits, a linear residual needs 18 */
+#define CODEC_K_MAX           17        /**< largest rice parameter */
+
+/**
+ * @brief codec bit writer structure definition
+ */
+typedef struct codec_writer_s
+{
+    uint8_t *p;            /**< next byte */
+    uint8_t *end;          /**< end of the buffer */
+    uint64_t acc;          /**< pending bits in the low end */
+    uint32_t bits;         /**< number of pending bits */
+} codec_writer_t;
+
+/**
+ * @brief codec bit reader structure definition
+ */
+typedef struct codec_reader_s
+{
+    const uint8_t *p;          /**< next byte */
+    const uint8_t *end;        /**< end of the payload */
+    uint64_t acc;              /**< buffered bits in the low end */
+    uint32_t bits;             /**< number of buffered bits */
+    uint32_t pad;              /**< zero bits buffered past the end */
+} codec_reader_t;
+
+/**
+ * @brief     append bits msb first
+ * @param[in] *w points to a codec writer structure
+ * @param[in] v is the value
+ * @param[in] n is the number of bits, at most 32
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ * @note      bytes leave in groups of four while there is room
+ */
+static inline uint8_t a_codec_put(codec_writer_t *w, uint32_t v, uint32_t n)
+{
+    uint32_t word;
+    
+    w->acc = (w->acc << n) | v;                          /* append */
+    w->bits += n;                                        /* add bits */
+    if (w->bits < 32)                                    /* less than a word */
+    {
+        return 0;                                        /* success return 0 */
+    }
+    if (w->end - w->p >= 4)                              /* room for a word */
+    {
+        w->bits -= 32;                                   /* sub bits */
+        word = (uint32_t)(w->acc >> w->bits);            /* get the word */
+        w->p[0] = (uint8_t)(word >> 24);                 /* emit */
+        w->p[1] = (uint8_t)(word >> 16);                 /* emit */
+        w->p[2] = (uint8_t)(word >> 8);                  /* emit */
+        w->p[3] = (uint8_t)(word);                       /* emit */
+        w->p += 4;                                       /* next */
+        
+        return 0;                                        /* success return 0 */
+    }
+    while (w->bits >= 8)                                 /* whole bytes */
+    {
+        if (w->p == w->end)                              /* check the room */
+        {
+            return 1;                                    /* return error */
+        }
+        w->bits -= 8;                                    /* sub bits */
+        *w->p++ = (uint8_t)(w->acc >> w->bits);          /* emit */
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     write the pending bits
+ * @param[in] *w points to a codec writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ * @note      the last byte is zero padded
+ */
+static uint8_t a_codec_flush(codec_writer_t *w)
+{
+    while (w->bits > 0)                                  /* pending bits */
+    {
+        if (w->p == w->end)                              /* check the room */
+        {
+            return 1;                                    /* return error */
+        }
+        if (w->bits >= 8)                                /* whole byte */
+        {
+            w->bits -= 8;                                /* sub bits */
+            *w->p++ = (uint8_t)(w->acc >> w->bits);      /* emit */
+        }
+        else
+        {
+            *w->p++ = (uint8_t)(w->acc << (8 - w->bits));/* emit padded */
+            w->bits = 0;                                 /* clear */
+        }
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     refill the bit reader
+ * @param[in] *r points to a codec reader structure
+ * @note      zero bits are fed past the end and counted in pad
+ */
+static inline void a_codec_fill(codec_reader_t *r)
+{
+    if (r->bits >= CODEC_ESCAPE_Q + CODEC_ESCAPE_BITS)   /* enough for any code */
+    {
+        return;
+    }
+    if ((r->bits <= 32) && (r->end - r->p >= 4))         /* load a word */
+    {
+        r->acc = (r->acc << 32) | ((uint64_t)r->p[0] << 24) | ((uint64_t)r->p[1] << 16) |
+                 ((uint64_t)r->p[2] << 8) | (uint64_t)r->p[3];
+        r->p += 4;                                       /* next */
+        r->bits += 32;                                   /* add bits */
+    }
+    while (r->bits <= 56)                                /* room for a byte */
+    {
+        r->acc <<= 8;                                    /* make room */
+        if (r->p < r->end)                               /* payload left */
+        {
+            r->acc |= *r->p++;                           /* load */
+        }
+        else
+        {
+            r->pad += 8;                                 /* past the end */
+        }
+        r->bits += 8;                                    /* add bits */
+    }
+}
+
+/**
+ * @brief     count the leading one bits of the reader
+ * @param[in] *r points to a filled codec reader structure
+ * @return    number of ones, at most CODEC_ESCAPE_Q
+ * @note      none
+ */
+static inline uint32_t a_codec_ones(const codec_reader_t *r)
+{
+    uint64_t top;
+    uint32_t q;
+    
+    top = ~(r->acc << (64 - r->bits));                   /* ones become leading zeros */
+#if defined(__GNUC__)
+    q = (top == 0) ? 64 : (uint32_t)__builtin_clzll(top);/* count */
+#else
+    q = 0;                                               /* init 0 */
+    while ((q < CODEC_ESCAPE_Q) && ((top & ((uint64_t)1 << 63)) == 0))
+    {
+        top <<= 1;                                       /* next bit */
+        q++;                                             /* count */
+    }
+#endif
+    
+    return (q > CODEC_ESCAPE_Q) ? CODEC_ESCAPE_Q : q;    /* clamp */
+}
+
+/**
+ * @brief     take bits from the reader
+ * @param[in] *r points to a filled codec reader structure
+ * @param[in] n is the number of bits, at most 32
+ * @return    value
+ * @note      none
+ */
+static inline uint32_t a_codec_take(codec_reader_t *r, uint32_t n)
+{
+    r->bits -= n;                                        /* sub bits */
+    
+    return (uint32_t)((r->acc >> r->bits) & (((uint64_t)1 << n) - 1));
+}
+
+/**
+ * @brief     zigzag map a residual
+ * @param[in] e is the residual
+ * @return    unsigned residual
+ * @note      none
+ */
+static inline uint32_t a_codec_zigzag(int32_t e)
+{
+    return (e < 0) ? ((~(uint32_t)e) << 1) | 1 : ((uint32_t)e << 1);
+}
+
+/**
+ * @brief     predict a sample
+ * @param[in] *raw points to the samples before i
+ * @param[in] i is the sample index
+ * @param[in] predictor is the predictor
+ * @return    prediction
+ * @note      none
+ */
+static inline int32_t a_codec_predict(const int16_t *raw, uint32_t i, uint8_t predictor)
+{
+    if (predictor == ADS1115_CODEC_PREDICTOR_LINEAR)
+    {
+        return 2 * (int32_t)raw[i - 1] - (int32_t)raw[i - 2];
+    }
+    
+    return raw[i - 1];
+}
+
+/**
+ * @brief     write a little endian uint16
+ * @param[in] *p points to the output
+ * @param[in] v is the value
+ * @note      none
+ */
+static inline void a_codec_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+/**
+ * @brief     read a little endian uint16
+ * @param[in] *p points to the input
+ * @return    value
+ * @note      none
+ */
+static inline uint16_t a_codec_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+/**
+ * @brief      encode a block of samples into one frame
+ * @param[in]  *raw points to a raw sample buffer
+ * @param[in]  n is the number of samples
+ * @param[out] *frame points to a frame buffer
+ * @param[in]  len is the frame buffer size
+ * @param[out] *used points to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame buffer is too small
+ *             - 2 raw, frame or used is NULL
+ *             - 4 n is invalid
+ * @note       lossless, the smaller residual of the delta and linear predictors is Rice coded,
+ *             a frame never exceeds ADS1115_CODEC_FRAME_MAX(n) bytes
+ */
+uint8_t ads1115_codec_encode(const int16_t *raw, uint32_t n, uint8_t *frame, uint32_t len, uint32_t *used)
+{
+    codec_writer_t w;
+    uint64_t sum1 = 0;
+    uint64_t sum2 = 0;
+    uint64_t sum;
+    uint32_t limit;
+    uint32_t cnt;
+    uint32_t i;
+    uint32_t u;
+    uint32_t q;
+    uint8_t predictor;
+    uint8_t k;
+    
+    if ((raw == NULL) || (frame == NULL) || (used == NULL))              /* check the buffers */
+    {
+        return 2;                                                        /* return error */
+    }
+    if ((n == 0) || (n > ADS1115_CODEC_BLOCK_MAX))                       /* check n */
+    {
+        return 4;                                                        /* return error */
+    }
+    if (len < ADS1115_CODEC_HEADER_SIZE)                                 /* check the room */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    /* pick the predictor with the smaller residual */
+    if (n > 1)
+    {
+        sum1 = a_codec_zigzag((int32_t)raw[1] - (int32_t)raw[0]);      /* first delta */
+    }
+    for (i = 2; i < n; i++)
+    {
+        sum1 += a_codec_zigzag((int32_t)raw[i] - (int32_t)raw[i - 1]);  /* delta */
+        sum2 += a_codec_zigzag((int32_t)raw[i] - a_codec_predict(raw, i, ADS1115_CODEC_PREDICTOR_LINEAR));
+    }
+    if ((n > 2) && (sum2 < sum1))                                        /* linear wins */
+    {
+        predictor = ADS1115_CODEC_PREDICTOR_LINEAR;                      /* set linear */
+        sum = sum2;                                                      /* set sum */
+    }
+    else
+    {
+        predictor = ADS1115_CODEC_PREDICTOR_DELTA;                       /* set delta */
+        sum = sum1;                                                      /* set sum */
+    }
+    cnt = n - predictor;                                                 /* coded residuals */
+    
+    /* rice parameter from the mean residual */
+    k = 0;                                                               /* init 0 */
+    while ((k < CODEC_K_MAX) && (((uint64_t)cnt << (k + 1)) <= sum))     /* largest k with cnt * 2^k <= sum */
+    {
+        k++;                                                             /* next k */
+    }
+    
+    /* warm up samples then residuals, never longer than verbatim */
+    limit = ((len - ADS1115_CODEC_HEADER_SIZE) < 2 * n) ? (len - ADS1115_CODEC_HEADER_SIZE) : (2 * n - 1);
+    w.p = frame + ADS1115_CODEC_HEADER_SIZE;                             /* set the start */
+    w.end = w.p + limit;                                                 /* set the end */
+    w.acc = 0;                                                           /* init 0 */
+    w.bits = 0;                                                          /* init 0 */
+    for (i = 0; i < predictor; i++)
+    {
+        if (a_codec_put(&w, (uint16_t)raw[i], 16) != 0)                  /* warm up sample */
+        {
+            break;                                                       /* too long */
+        }
+    }
+    for (i = predictor; (i < n) && (w.p != w.end); i++)
+    {
+        u = a_codec_zigzag((int32_t)raw[i] - a_codec_predict(raw, i, predictor));
+        q = u >> k;                                                      /* quotient */
+        if ((q < CODEC_ESCAPE_Q) && (q + 1 + k <= 32))                   /* a unary run of CODEC_ESCAPE_Q is the escape */
+        {
+            if (a_codec_put(&w, (((1U << q) - 1) << (k + 1)) | (u & ((1U << k) - 1)), q + 1 + k) != 0)
+            {
+                break;                                                   /* too long */
+            }
+        }
+        else if (q < CODEC_ESCAPE_Q)
+        {
+            if ((a_codec_put(&w, ((1U << q) - 1) << 1, q + 1) != 0) ||   /* unary part */
+                (a_codec_put(&w, u & ((1U << k) - 1), k) != 0))          /* binary part */
+            {
+                break;                                                   /* too long */
+            }
+        }
+        else
+        {
+            if ((a_codec_put(&w, (1U << CODEC_ESCAPE_Q) - 1, CODEC_ESCAPE_Q) != 0) ||
+                (a_codec_put(&w, u, CODEC_ESCAPE_BITS) != 0))            /* escape and raw residual */
+            {
+                break;                                                   /* too long */
+            }
+        }
+    }
+    if ((i < n) || (a_codec_flush(&w) != 0))                             /* did not fit */
+    {
+        if (len < ADS1115_CODEC_FRAME_MAX(n))                            /* check the room */
+        {
+            return 1;                                                    /* return error */
+        }
+        predictor = ADS1115_CODEC_PREDICTOR_VERBATIM;                    /* fall back */
+        k = 0;                                                           /* no rice */
+        w.p = frame + ADS1115_CODEC_HEADER_SIZE;                         /* rewind */
+        for (i = 0; i < n; i++)
+        {
+            a_codec_put16(w.p, (uint16_t)raw[i]);                        /* raw sample */
+            w.p += 2;                                                    /* next */
+        }
+    }
+    
+    /* header */
+    a_codec_put16(&frame[0], (uint16_t)n);                               /* count */
+    a_codec_put16(&frame[2], (uint16_t)(w.p - frame - ADS1115_CODEC_HEADER_SIZE));
+    frame[4] = predictor;                                                /* predictor */
+    frame[5] = k;                                                        /* rice parameter */
+    *used = (uint32_t)(w.p - frame);                                     /* set the length */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      decode one frame
+ * @param[in]  *frame points to a frame buffer
+ * @param[in]  len is the number of bytes available
+ * @param[out] *raw points to a raw sample buffer
+ * @param[in]  max is the raw sample buffer size
+ * @param[out] *n points to a sample number buffer
+ * @param[out] *used points to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated or corrupt
+ *             - 2 frame, raw, n or used is NULL
+ *             - 4 raw buffer is too small
+ * @note       used gives the offset of the next frame in a stream
+ */
+uint8_t ads1115_codec_decode(const uint8_t *frame, uint32_t len, int16_t *raw, uint32_t max,
+                             uint32_t *n, uint32_t *used)
+{
+    codec_reader_t r;
+    uint32_t count;
+    uint32_t bytes;
+    uint32_t i;
+    uint32_t q;
+    uint32_t u;
+    int32_t x;
+    uint8_t predictor;
+    uint8_t k;
+    
+    if ((frame == NULL) || (raw == NULL) || (n == NULL) || (used == NULL))         /* check the buffers */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (len < ADS1115_CODEC_HEADER_SIZE)                                           /* check the header */
+    {
+        return 1;                                                                  /* return error */
+    }
+    count = a_codec_get16(&frame[0]);                                              /* get the count */
+    bytes = a_codec_get16(&frame[2]);                                              /* get the payload */
+    predictor = frame[4];                                                          /* get the predictor */
+    k = frame[5];                                                                  /* get the rice parameter */
+    if ((count == 0) || (count > ADS1115_CODEC_BLOCK_MAX) || (k > CODEC_K_MAX) ||
+        (predictor > ADS1115_CODEC_PREDICTOR_LINEAR) || (count < predictor) ||
+        (len - ADS1115_CODEC_HEADER_SIZE < bytes))                                 /* check the frame */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (count > max)                                                               /* check the room */
+    {
+        return 4;                                                                  /* return error */
+    }
+    
+    /* verbatim */
+    if (predictor == ADS1115_CODEC_PREDICTOR_VERBATIM)
+    {
+        if (bytes != 2 * count)                                                    /* check the payload */
+        {
+            return 1;                                                              /* return error */
+        }
+        for (i = 0; i < count; i++)
+        {
+            raw[i] = (int16_t)a_codec_get16(&frame[ADS1115_CODEC_HEADER_SIZE + 2 * i]);
+        }
+        *n = count;                                                                /* set the count */
+        *used = ADS1115_CODEC_HEADER_SIZE + bytes;                                 /* set the length */
+        
+        return 0;                                                                  /* success return 0 */
+    }
+    
+    /* warm up samples then residuals */
+    r.p = frame + ADS1115_CODEC_HEADER_SIZE;                                       /* set the start */
+    r.end = r.p + bytes;                                                           /* set the end */
+    r.acc = 0;                                                                     /* init 0 */
+    r.bits = 0;                                                                    /* init 0 */
+    r.pad = 0;                                                                     /* init 0 */
+    for (i = 0; i < predictor; i++)
+    {
+        a_codec_fill(&r);                                                          /* fill */
+        raw[i] = (int16_t)a_codec_take(&r, 16);                                    /* warm up sample */
+    }
+    for (i = predictor; i < count; i++)
+    {
+        a_codec_fill(&r);                                                          /* fill */
+        q = a_codec_ones(&r);                                                      /* unary part */
+        if (q < CODEC_ESCAPE_Q)
+        {
+            r.bits -= q + 1;                                                       /* skip the ones and the stop bit */
+            u = (q << k) | a_codec_take(&r, k);                                    /* binary part */
+        }
+        else
+        {
+            r.bits -= CODEC_ESCAPE_Q;                                              /* skip the escape */
+            u = a_codec_take(&r, CODEC_ESCAPE_BITS);                               /* raw residual */
+        }
+        x = a_codec_predict(raw, i, predictor) + (int32_t)((u & 1) ? ~(u >> 1) : (u >> 1));
+        if ((x < -32768) || (x > 32767))                                           /* check the range */
+        {
+            return 1;                                                              /* return error */
+        }
+        raw[i] = (int16_t)x;                                                       /* set the sample */
+    }
+    if (r.pad > r.bits)                                                            /* read past the payload */
+    {
+        return 1;                                                                  /* return error */
+    }
+    *n = count;                                                                    /* set the count */
+    *used = ADS1115_CODEC_HEADER_SIZE + bytes;                                     /* set the length */
+    
+    return 0;                                                                      /* success return 0 */
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_codec.h
+ * @brief     driver ads1115 codec header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_CODEC_H
+#define DRIVER_ADS1115_CODEC_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_codec_driver ads1115 codec driver function
+ * @brief    ads1115 codec driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 codec block size definition
+ */
+#ifndef ADS1115_CODEC_BLOCK_MAX
+    #define ADS1115_CODEC_BLOCK_MAX 4096        /**< samples per frame at most */
+#endif
+
+/**
+ * @brief ads1115 codec frame definition
+ */
+#define ADS1115_CODEC_HEADER_SIZE    6                                          /**< frame header bytes */
+#define ADS1115_CODEC_FRAME_MAX(n)   (ADS1115_CODEC_HEADER_SIZE + 2 * (n))      /**< worst case frame bytes for n samples */
+
+/**
+ * @brief ads1115 codec predictor enumeration definition
+ */
+typedef enum
+{
+    ADS1115_CODEC_PREDICTOR_VERBATIM = 0x00,        /**< raw samples */
+    ADS1115_CODEC_PREDICTOR_DELTA    = 0x01,        /**< x[i] - x[i-1] */
+    ADS1115_CODEC_PREDICTOR_LINEAR   = 0x02,        /**< x[i] - 2x[i-1] + x[i-2] */
+} ads1115_codec_predictor_t;
+
+/**
+ * @brief      encode a block of samples into one frame
+ * @param[in]  *raw points to a raw sample buffer
+ * @param[in]  n is the number of samples
+ * @param[out] *frame points to a frame buffer
+ * @param[in]  len is the frame buffer size
+ * @param[out] *used points to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame buffer is too small
+ *             - 2 raw, frame or used is NULL
+ *             - 4 n is invalid
+ * @note       lossless, the smaller residual of the delta and linear predictors is Rice coded,
+ *             a frame never exceeds ADS1115_CODEC_FRAME_MAX(n) bytes
+ */
+uint8_t ads1115_codec_encode(const int16_t *raw, uint32_t n, uint8_t *frame, uint32_t len, uint32_t *used);
+
+/**
+ * @brief      decode one frame
+ * @param[in]  *frame points to a frame buffer
+ * @param[in]  len is the number of bytes available
+ * @param[out] *raw points to a raw sample buffer
+ * @param[in]  max is the raw sample buffer size
+ * @param[out] *n points to a sample number buffer
+ * @param[out] *used points to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated or corrupt
+ *             - 2 frame, raw, n or used is NULL
+ *             - 4 raw buffer is too small
+ * @note       used gives the offset of the next frame in a stream
+ */
+uint8_t ads1115_codec_decode(const uint8_t *frame, uint32_t len, int16_t *raw, uint32_t max,
+                             uint32_t *n, uint32_t *used);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
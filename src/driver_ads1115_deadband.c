@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_deadband.c
+ * @brief     driver ads1115 deadband source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_deadband.h"
+
+/**
+ * @brief     initialize a deadband filter
+ * @param[in] *deadband points to an ads1115 deadband structure
+ * @param[in] threshold is the change in raw counts that is reported
+ * @param[in] heartbeat_ms is the longest silence in ms, 0 means none
+ * @return    status code
+ *            - 0 success
+ *            - 2 deadband is NULL
+ * @note      threshold 0 reports every change
+ */
+uint8_t ads1115_deadband_init(ads1115_deadband_t *deadband, uint16_t threshold, uint32_t heartbeat_ms)
+{
+    if (deadband == NULL)                                        /* check deadband */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    deadband->last_us = 0;                                       /* init 0 */
+    deadband->heartbeat_us = (uint64_t)heartbeat_ms * 1000ULL;   /* set the heartbeat */
+    deadband->threshold = threshold;                             /* set the threshold */
+    deadband->last_raw = 0;                                      /* init 0 */
+    deadband->valid = 0;                                         /* nothing published */
+    deadband->published = 0;                                     /* init 0 */
+    deadband->suppressed = 0;                                    /* init 0 */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *deadband points to an ads1115 deadband structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  timestamp_us is the sample time
+ * @param[out] *publish points to a publish flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 deadband or publish is NULL
+ * @note       a sample is published when it differs from the last published one by more than the
+ *             threshold or when the heartbeat has elapsed, the first sample is always published
+ */
+uint8_t ads1115_deadband_update(ads1115_deadband_t *deadband, int16_t raw, uint64_t timestamp_us,
+                                ads1115_bool_t *publish)
+{
+    int32_t diff;
+    
+    if ((deadband == NULL) || (publish == NULL))                                      /* check the buffers */
+    {
+        return 2;                                                                     /* return error */
+    }
+    
+    diff = (int32_t)raw - (int32_t)deadband->last_raw;                                /* change since the last report */
+    if (diff < 0)                                                                     /* check the sign */
+    {
+        diff = -diff;                                                                 /* absolute value */
+    }
+    if ((deadband->valid == 0) || (diff > (int32_t)deadband->threshold) ||
+        ((deadband->heartbeat_us != 0) && (timestamp_us - deadband->last_us >= deadband->heartbeat_us)))
+    {
+        deadband->last_raw = raw;                                                     /* save the sample */
+        deadband->last_us = timestamp_us;                                             /* save the time */
+        deadband->valid = 1;                                                          /* set valid */
+        deadband->published++;                                                        /* count */
+        *publish = ADS1115_BOOL_TRUE;                                                 /* publish */
+    }
+    else
+    {
+        deadband->suppressed++;                                                       /* count */
+        *publish = ADS1115_BOOL_FALSE;                                                /* suppress */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     force the next sample out
+ * @param[in] *deadband points to an ads1115 deadband structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 deadband is NULL
+ * @note      call after a range or channel change
+ */
+uint8_t ads1115_deadband_reset(ads1115_deadband_t *deadband)
+{
+    if (deadband == NULL)                                        /* check deadband */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    deadband->valid = 0;                                         /* publish the next sample */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the deadband counters
+ * @param[in]  *deadband points to an ads1115 deadband structure
+ * @param[out] *published points to a published sample counter buffer
+ * @param[out] *suppressed points to a suppressed sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 deadband is NULL
+ * @note       none
+ */
+uint8_t ads1115_deadband_get_counters(ads1115_deadband_t *deadband, uint32_t *published, uint32_t *suppressed)
+{
+    if (deadband == NULL)                                        /* check deadband */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    if (published != NULL)                                       /* check published */
+    {
+        *published = deadband->published;                        /* get the published counter */
+    }
+    if (suppressed != NULL)                                      /* check suppressed */
+    {
+        *suppressed = deadband->suppressed;                      /* get the suppressed counter */
+    }
+    
+    return 0;                                                    /* success return 0 */
+}
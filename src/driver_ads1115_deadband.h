@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_deadband.h
+ * @brief     driver ads1115 deadband header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_DEADBAND_H
+#define DRIVER_ADS1115_DEADBAND_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_deadband_driver ads1115 deadband driver function
+ * @brief    ads1115 deadband driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 deadband structure definition
+ */
+typedef struct ads1115_deadband_s
+{
+    uint64_t last_us;             /**< time of the last published sample */
+    uint64_t heartbeat_us;        /**< longest silence, 0 means none */
+    uint16_t threshold;           /**< raw counts the sample must move by */
+    int16_t last_raw;             /**< last published raw sample */
+    uint8_t valid;                /**< 1 once a sample was published */
+    uint32_t published;           /**< published sample counter */
+    uint32_t suppressed;          /**< suppressed sample counter */
+} ads1115_deadband_t;
+
+/**
+ * @brief     initialize a deadband filter
+ * @param[in] *deadband points to an ads1115 deadband structure
+ * @param[in] threshold is the change in raw counts that is reported
+ * @param[in] heartbeat_ms is the longest silence in ms, 0 means none
+ * @return    status code
+ *            - 0 success
+ *            - 2 deadband is NULL
+ * @note      threshold 0 reports every change
+ */
+uint8_t ads1115_deadband_init(ads1115_deadband_t *deadband, uint16_t threshold, uint32_t heartbeat_ms);
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *deadband points to an ads1115 deadband structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  timestamp_us is the sample time
+ * @param[out] *publish points to a publish flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 deadband or publish is NULL
+ * @note       a sample is published when it differs from the last published one by more than the
+ *             threshold or when the heartbeat has elapsed, the first sample is always published
+ */
+uint8_t ads1115_deadband_update(ads1115_deadband_t *deadband, int16_t raw, uint64_t timestamp_us,
+                                ads1115_bool_t *publish);
+
+/**
+ * @brief     force the next sample out
+ * @param[in] *deadband points to an ads1115 deadband structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 deadband is NULL
+ * @note      call after a range or channel change
+ */
+uint8_t ads1115_deadband_reset(ads1115_deadband_t *deadband);
+
+/**
+ * @brief      get the deadband counters
+ * @param[in]  *deadband points to an ads1115 deadband structure
+ * @param[out] *published points to a published sample counter buffer
+ * @param[out] *suppressed points to a suppressed sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 deadband is NULL
+ * @note       none
+ */
+uint8_t ads1115_deadband_get_counters(ads1115_deadband_t *deadband, uint32_t *published, uint32_t *suppressed);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
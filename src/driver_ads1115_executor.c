@@ -0,0 +1,411 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_executor.c
+ * @brief     driver ads1115 executor source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_executor.h"
+
+/**
+ * @brief     check whether a device has a conversion in flight
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    1 if busy else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_executor_busy(ads1115_executor_t *executor, ads1115_handle_t *handle)
+{
+    ads1115_op_t *op;
+    
+    for (op = executor->running; op != NULL; op = op->next)        /* scan the running list */
+    {
+        if (op->handle == handle)                                  /* check device */
+        {
+            return 1;                                              /* busy */
+        }
+    }
+    
+    return 0;                                                      /* idle */
+}
+
+/**
+ * @brief     insert an operation into the running list by due time
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *op points to an ads1115 read operation structure
+ * @note      none
+ */
+static void a_ads1115_executor_insert(ads1115_executor_t *executor, ads1115_op_t *op)
+{
+    ads1115_op_t **link;
+    
+    link = &executor->running;                                                /* from the head */
+    while ((*link != NULL) && ((*link)->due_us <= op->due_us))                /* keep due order */
+    {
+        link = &(*link)->next;                                                /* next link */
+    }
+    op->next = *link;                                                         /* link the rest */
+    *link = op;                                                               /* insert */
+}
+
+/**
+ * @brief     complete an operation and resume its continuation
+ * @param[in] *op points to an ads1115 read operation structure
+ * @param[in] status is the completion status
+ * @note      none
+ */
+static void a_ads1115_executor_complete(ads1115_op_t *op, uint8_t status)
+{
+    op->state = ADS1115_OP_STATE_IDLE;        /* set idle */
+    op->status = status;                      /* set status */
+    op->next = NULL;                          /* unlink */
+    if (op->resume != NULL)                   /* check continuation */
+    {
+        op->resume(op);                       /* resume */
+    }
+}
+
+/**
+ * @brief     start the queued operations whose device is idle
+ * @param[in] *executor points to an ads1115 executor structure
+ * @note      operations submitted by continuations during the pass wait for the next pass,
+ *            a valid shadow config switches the mux and starts in one transaction,
+ *            a config operation runs and completes at once
+ */
+static void a_ads1115_executor_dispatch(ads1115_executor_t *executor)
+{
+    uint8_t res;
+    uint16_t conf;
+    uint32_t wait_us;
+    ads1115_op_t *list;
+    ads1115_op_t *op;
+    ads1115_op_t *keep = NULL;
+    ads1115_op_t *keep_tail = NULL;
+    
+    list = executor->queued;                                                              /* detach the queue */
+    executor->queued = NULL;                                                              /* clear head */
+    executor->queued_tail = NULL;                                                         /* clear tail */
+    while (list != NULL)                                                                  /* walk in submit order */
+    {
+        op = list;                                                                        /* pop */
+        list = op->next;                                                                  /* advance */
+        op->next = NULL;                                                                  /* unlink */
+        if (a_ads1115_executor_busy(executor, op->handle) != 0)                           /* keep device order */
+        {
+            if (keep_tail == NULL)                                                        /* check empty */
+            {
+                keep = op;                                                                /* set head */
+            }
+            else
+            {
+                keep_tail->next = op;                                                     /* append */
+            }
+            keep_tail = op;                                                               /* set tail */
+            
+            continue;                                                                     /* next op */
+        }
+        if (op->config != NULL)                                                           /* config operation */
+        {
+            res = op->config(op->handle, op->arg);                                        /* run config */
+            a_ads1115_executor_complete(op, (res != 0) ? 1 : 0);                          /* complete */
+            
+            continue;                                                                     /* next op */
+        }
+        if (ads1115_get_shadow_config(op->handle, &conf) == 0)                            /* check shadow */
+        {
+            conf = (uint16_t)((conf & ~(0x7 << 12)) | ((op->channel & 0x7) << 12));       /* set mux */
+            res = ads1115_start_single_read_word(op->handle, conf, &wait_us);             /* switch and start */
+        }
+        else
+        {
+            res = ads1115_set_channel(op->handle, op->channel);                           /* switch channel */
+            if (res == 0)                                                                 /* check result */
+            {
+                res = ads1115_start_single_read(op->handle, &wait_us);                    /* start conversion */
+            }
+        }
+        if (res != 0)                                                                     /* check result */
+        {
+            a_ads1115_executor_complete(op, 1);                                           /* complete with error */
+            
+            continue;                                                                     /* next op */
+        }
+        op->state = ADS1115_OP_STATE_CONVERTING;                                          /* set converting */
+        op->polls = 0;                                                                    /* clear polls */
+        op->due_us = executor->timestamp_us() + wait_us;                                  /* expected ready time */
+        a_ads1115_executor_insert(executor, op);                                          /* insert by due time */
+    }
+    if (keep != NULL)                                                                     /* requeue the kept ops */
+    {
+        keep_tail->next = executor->queued;                                               /* before new submits */
+        if (executor->queued == NULL)                                                     /* check empty */
+        {
+            executor->queued_tail = keep_tail;                                            /* set tail */
+        }
+        executor->queued = keep;                                                          /* set head */
+    }
+}
+
+/**
+ * @brief     check whether a queued operation can start
+ * @param[in] *executor points to an ads1115 executor structure
+ * @return    1 if dispatchable else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_executor_dispatchable(ads1115_executor_t *executor)
+{
+    ads1115_op_t *op;
+    
+    for (op = executor->queued; op != NULL; op = op->next)                  /* scan the queue */
+    {
+        if (a_ads1115_executor_busy(executor, op->handle) == 0)             /* check device */
+        {
+            return 1;                                                       /* dispatchable */
+        }
+    }
+    
+    return 0;                                                               /* nothing to start */
+}
+
+/**
+ * @brief     initialize the executor
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *timestamp_us points to a monotonic timestamp function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor or timestamp_us is NULL
+ * @note      none
+ */
+uint8_t ads1115_executor_init(ads1115_executor_t *executor, uint64_t (*timestamp_us)(void))
+{
+    if ((executor == NULL) || (timestamp_us == NULL))                /* check executor */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    memset(executor, 0, sizeof(ads1115_executor_t));                 /* clear the executor */
+    executor->timestamp_us = timestamp_us;                           /* set timestamp */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     submit a read operation
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *op points to an ads1115 read operation structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] *resume points to a continuation function address
+ * @param[in] *arg is the continuation argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor, op or handle is NULL
+ *            - 4 op is already submitted
+ * @note      resume runs inside ads1115_executor_run and may submit op again,
+ *            the handle must be initialized in single shot mode
+ */
+uint8_t ads1115_executor_submit(ads1115_executor_t *executor, ads1115_op_t *op, ads1115_handle_t *handle,
+                                ads1115_channel_t channel, void (*resume)(ads1115_op_t *op), void *arg)
+{
+    if ((executor == NULL) || (op == NULL) || (handle == NULL))        /* check pointer */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (op->state != ADS1115_OP_STATE_IDLE)                            /* check op */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    op->handle = handle;                                               /* set handle */
+    op->channel = channel;                                             /* set channel */
+    op->config = NULL;                                                 /* read operation */
+    op->resume = resume;                                               /* set continuation */
+    op->arg = arg;                                                     /* set argument */
+    op->state = ADS1115_OP_STATE_QUEUED;                               /* set queued */
+    op->status = 0;                                                    /* clear status */
+    op->next = NULL;                                                   /* unlink */
+    if (executor->queued_tail == NULL)                                 /* check empty */
+    {
+        executor->queued = op;                                         /* set head */
+    }
+    else
+    {
+        executor->queued_tail->next = op;                              /* append */
+    }
+    executor->queued_tail = op;                                        /* set tail */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     submit a config operation
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *op points to an ads1115 read operation structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *config points to a config function address called with the handle and arg
+ * @param[in] *resume points to a continuation function address
+ * @param[in] *arg is the continuation argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor, op, handle or config is NULL
+ *            - 4 op is already submitted
+ * @note      config runs inside ads1115_executor_run once the device has no conversion in flight,
+ *            so it keeps its order with the reads of the device, a config status other than 0
+ *            completes op with status 1
+ */
+uint8_t ads1115_executor_submit_config(ads1115_executor_t *executor, ads1115_op_t *op, ads1115_handle_t *handle,
+                                       uint8_t (*config)(ads1115_handle_t *handle, void *arg),
+                                       void (*resume)(ads1115_op_t *op), void *arg)
+{
+    uint8_t res;
+    
+    if (config == NULL)                                                          /* check config */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    res = ads1115_executor_submit(executor, op, handle, ADS1115_CHANNEL_AIN0_GND, resume, arg);    /* queue in order */
+    if (res != 0)                                                                /* check result */
+    {
+        return res;                                                              /* return error */
+    }
+    op->config = config;                                                         /* make it a config */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     wake the conversion of a device on its conversion ready edge
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 no conversion in flight
+ *            - 2 executor or handle is NULL
+ * @note      without ready edges the executor waits the conversion period of the data rate
+ */
+uint8_t ads1115_executor_notify(ads1115_executor_t *executor, ads1115_handle_t *handle)
+{
+    ads1115_op_t **link;
+    ads1115_op_t *op;
+    
+    if ((executor == NULL) || (handle == NULL))                        /* check pointer */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    for (link = &executor->running; *link != NULL; link = &(*link)->next)        /* find the conversion */
+    {
+        op = *link;                                                              /* get op */
+        if (op->handle == handle)                                                /* check device */
+        {
+            *link = op->next;                                                    /* unlink */
+            op->due_us = 0;                                                      /* due now */
+            op->next = executor->running;                                        /* link the rest */
+            executor->running = op;                                              /* move to head */
+            
+            return 0;                                                            /* success return 0 */
+        }
+    }
+    
+    return 1;                                                                    /* return error */
+}
+
+/**
+ * @brief      run every operation step that is due
+ * @param[in]  *executor points to an ads1115 executor structure
+ * @param[out] *next_us points to a next service time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 executor or next_us is NULL
+ * @note       the caller sleeps until next_us or the next ready edge and calls again,
+ *             next_us is UINT64_MAX when nothing is pending
+ */
+uint8_t ads1115_executor_run(ads1115_executor_t *executor, uint64_t *next_us)
+{
+    uint8_t res;
+    uint64_t now;
+    ads1115_bool_t finished;
+    ads1115_op_t *op;
+    
+    if ((executor == NULL) || (next_us == NULL))                                          /* check pointer */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    a_ads1115_executor_dispatch(executor);                                                /* start idle devices */
+    now = executor->timestamp_us();                                                       /* get now */
+    while ((executor->running != NULL) && (executor->running->due_us <= now))             /* service due ops */
+    {
+        op = executor->running;                                                           /* pop the head */
+        executor->running = op->next;                                                     /* advance */
+        op->next = NULL;                                                                  /* unlink */
+        res = ads1115_get_single_read_status(op->handle, &finished);                      /* check os bit */
+        if (res != 0)                                                                     /* check result */
+        {
+            a_ads1115_executor_complete(op, 1);                                           /* complete with error */
+        }
+        else if (finished == ADS1115_BOOL_TRUE)                                           /* check finished */
+        {
+            res = ads1115_get_single_read(op->handle, &op->raw, &op->v);                  /* read result */
+            a_ads1115_executor_complete(op, (res != 0) ? 1 : 0);                          /* complete */
+        }
+        else if (++op->polls > ADS1115_EXECUTOR_POLL_MAX)                                 /* check poll limit */
+        {
+            a_ads1115_executor_complete(op, 1);                                           /* complete with timeout */
+        }
+        else
+        {
+            op->due_us = now + ADS1115_EXECUTOR_POLL_US;                                  /* poll again later */
+            a_ads1115_executor_insert(executor, op);                                      /* insert by due time */
+            
+            continue;                                                                     /* next op */
+        }
+        a_ads1115_executor_dispatch(executor);                                            /* device is idle again */
+        now = executor->timestamp_us();                                                   /* update now */
+    }
+    
+    if (a_ads1115_executor_dispatchable(executor) != 0)                                   /* check queued ops */
+    {
+        *next_us = now;                                                                   /* run again now */
+    }
+    else if (executor->running != NULL)                                                   /* check running ops */
+    {
+        *next_us = executor->running->due_us;                                             /* earliest ready time */
+    }
+    else
+    {
+        *next_us = UINT64_MAX;                                                            /* nothing pending */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_executor.h
+ * @brief     driver ads1115 executor header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_EXECUTOR_H
+#define DRIVER_ADS1115_EXECUTOR_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_executor_driver ads1115 executor driver function
+ * @brief    ads1115 executor driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 executor poll definition
+ */
+#ifndef ADS1115_EXECUTOR_POLL_US
+    #define ADS1115_EXECUTOR_POLL_US 100        /**< status poll interval after the expected ready time */
+#endif
+#ifndef ADS1115_EXECUTOR_POLL_MAX
+    #define ADS1115_EXECUTOR_POLL_MAX 1000      /**< status poll limit */
+#endif
+
+/**
+ * @brief ads1115 read operation state enumeration definition
+ */
+typedef enum
+{
+    ADS1115_OP_STATE_IDLE       = 0x00,        /**< not submitted or completed */
+    ADS1115_OP_STATE_QUEUED     = 0x01,        /**< waiting for its device */
+    ADS1115_OP_STATE_CONVERTING = 0x02,        /**< conversion in flight */
+} ads1115_op_state_t;
+
+/**
+ * @brief ads1115 read operation structure definition
+ */
+typedef struct ads1115_op_s
+{
+    ads1115_handle_t *handle;                       /**< device to read */
+    ads1115_channel_t channel;                      /**< channel to read */
+    uint8_t (*config)(ads1115_handle_t *handle,
+                      void *arg);                   /**< config function of a config operation, NULL for a read */
+    void (*resume)(struct ads1115_op_s *op);        /**< continuation called on completion */
+    void *arg;                                      /**< continuation argument */
+    ads1115_op_state_t state;                       /**< operation state */
+    uint8_t status;                                 /**< completion status, 0 means success */
+    int16_t raw;                                    /**< raw result */
+    float v;                                        /**< converted result */
+    uint16_t polls;                                 /**< status polls after the expected ready time */
+    uint64_t due_us;                                /**< next service time */
+    struct ads1115_op_s *next;                      /**< list link */
+} ads1115_op_t;
+
+/**
+ * @brief ads1115 executor structure definition
+ */
+typedef struct ads1115_executor_s
+{
+    uint64_t (*timestamp_us)(void);        /**< point to a monotonic timestamp function address */
+    ads1115_op_t *queued;                  /**< operations waiting for their device */
+    ads1115_op_t *queued_tail;             /**< queued list tail */
+    ads1115_op_t *running;                 /**< conversions in flight sorted by due time */
+} ads1115_executor_t;
+
+/**
+ * @brief     initialize the executor
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *timestamp_us points to a monotonic timestamp function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor or timestamp_us is NULL
+ * @note      none
+ */
+uint8_t ads1115_executor_init(ads1115_executor_t *executor, uint64_t (*timestamp_us)(void));
+
+/**
+ * @brief     submit a read operation
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *op points to an ads1115 read operation structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] *resume points to a continuation function address
+ * @param[in] *arg is the continuation argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor, op or handle is NULL
+ *            - 4 op is already submitted
+ * @note      resume runs inside ads1115_executor_run and may submit op again,
+ *            the handle must be initialized in single shot mode
+ */
+uint8_t ads1115_executor_submit(ads1115_executor_t *executor, ads1115_op_t *op, ads1115_handle_t *handle,
+                                ads1115_channel_t channel, void (*resume)(ads1115_op_t *op), void *arg);
+
+/**
+ * @brief     submit a config operation
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *op points to an ads1115 read operation structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *config points to a config function address called with the handle and arg
+ * @param[in] *resume points to a continuation function address
+ * @param[in] *arg is the continuation argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 executor, op, handle or config is NULL
+ *            - 4 op is already submitted
+ * @note      config runs inside ads1115_executor_run once the device has no conversion in flight,
+ *            so it keeps its order with the reads of the device, a config status other than 0
+ *            completes op with status 1
+ */
+uint8_t ads1115_executor_submit_config(ads1115_executor_t *executor, ads1115_op_t *op, ads1115_handle_t *handle,
+                                       uint8_t (*config)(ads1115_handle_t *handle, void *arg),
+                                       void (*resume)(ads1115_op_t *op), void *arg);
+
+/**
+ * @brief     wake the conversion of a device on its conversion ready edge
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 no conversion in flight
+ *            - 2 executor or handle is NULL
+ * @note      without ready edges the executor waits the conversion period of the data rate
+ */
+uint8_t ads1115_executor_notify(ads1115_executor_t *executor, ads1115_handle_t *handle);
+
+/**
+ * @brief      run every operation step that is due
+ * @param[in]  *executor points to an ads1115 executor structure
+ * @param[out] *next_us points to a next service time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 executor or next_us is NULL
+ * @note       the caller sleeps until next_us or the next ready edge and calls again,
+ *             next_us is UINT64_MAX when nothing is pending
+ */
+uint8_t ads1115_executor_run(ads1115_executor_t *executor, uint64_t *next_us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_power.c
+ * @brief     driver ads1115 power source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_power.h"
+
+/**
+ * @brief     integer square root
+ * @param[in] x is the radicand
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_ads1115_power_sqrt(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+    
+    while (bit > x)                                              /* highest power of 4 not above x */
+    {
+        bit >>= 2;                                               /* next */
+    }
+    while (bit != 0)                                             /* digit by digit */
+    {
+        if (x >= res + bit)                                      /* check the digit */
+        {
+            x -= res + bit;                                      /* remove */
+            res = (res >> 1) + bit;                              /* set the digit */
+        }
+        else
+        {
+            res >>= 1;                                           /* clear the digit */
+        }
+        bit >>= 2;                                               /* next */
+    }
+    
+    return (uint32_t)res;                                        /* return the root */
+}
+
+/**
+ * @brief     get the rms of a square sum
+ * @param[in] sum is the sum of the squared samples
+ * @param[in] n is the number of samples
+ * @param[in] shift is 16 minus the fraction bits of the sum
+ * @return    rms in counts
+ * @note      16 fraction bits before the root
+ */
+static float a_ads1115_power_rms(uint64_t sum, uint32_t n, uint8_t shift)
+{
+    uint64_t ms_q16;
+    
+    if (n == 0)                                                  /* check the samples */
+    {
+        return 0.0f;                                             /* no samples */
+    }
+    ms_q16 = ((sum / n) << shift) + (((sum % n) << shift) / n);  /* mean square */
+    
+    return (float)a_ads1115_power_sqrt(ms_q16) / 256.0f;         /* return the rms */
+}
+
+/**
+ * @brief     close the averaging window
+ * @param[in] *power points to an ads1115 power structure
+ * @note      none
+ */
+static void a_ads1115_power_close(ads1115_power_t *power)
+{
+    ads1115_power_average_t *a = &power->average;
+    float v_rms;
+    float w_rms;
+    
+    v_rms = a_ads1115_power_rms(power->sum_vv, power->count_v, 16);                              /* raw voltage rms */
+    w_rms = a_ads1115_power_rms(power->sum_ww, power->count_vi, 8);                              /* interpolated voltage rms */
+    a->pairs = power->count_vi;                                                                  /* set the pairs */
+    a->v_rms = v_rms * power->v_scale;                                                           /* set the rms voltage */
+    a->i_rms = a_ads1115_power_rms(power->sum_ii, power->count_i, 16) * power->i_scale;          /* set the rms current */
+    a->p = (float)(power->sum_vi / (int64_t)power->count_vi) / 256.0f *
+           power->v_scale * power->i_scale;                                                      /* set the real power */
+    if (w_rms > 0.0f)                                                                            /* check the interpolated rms */
+    {
+        a->p = a->p * v_rms / w_rms;                                                             /* undo the interpolation loss */
+    }
+    a->s = a->v_rms * a->i_rms;                                                                  /* set the apparent power */
+    a->pf = (a->s > 0.0f) ? (a->p / a->s) : 0.0f;                                                /* set the power factor */
+    a->energy = a->p * (float)power->span_us * 1e-6f;                                            /* set the energy */
+    power->average_new = 1;                                                                      /* new average */
+    power->sum_vv = 0;                                                                           /* init 0 */
+    power->count_v = 0;                                                                          /* init 0 */
+    power->sum_ii = 0;                                                                           /* init 0 */
+    power->count_i = 0;                                                                          /* init 0 */
+    power->sum_vi = 0;                                                                           /* init 0 */
+    power->sum_ww = 0;                                                                           /* init 0 */
+    power->count_vi = 0;                                                                         /* init 0 */
+    power->span_us = 0;                                                                          /* init 0 */
+}
+
+/**
+ * @brief     initialize a power engine
+ * @param[in] *power points to an ads1115 power structure
+ * @param[in] v_scale is the voltage in volts of one voltage count
+ * @param[in] i_scale is the current in amperes of one current count
+ * @param[in] window is the number of aligned pairs per average
+ * @param[in] max_gap_us is the longest gap between two voltage samples that is interpolated
+ * @return    status code
+ *            - 0 success
+ *            - 2 power is NULL
+ *            - 4 window is 0 or above ADS1115_POWER_MAX_WINDOW or max_gap_us is 0
+ * @note      the scales include the pga lsb, the divider and the shunt
+ */
+uint8_t ads1115_power_init(ads1115_power_t *power, float v_scale, float i_scale, uint32_t window, uint32_t max_gap_us)
+{
+    if (power == NULL)                                                       /* check power */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((window == 0) || (window > ADS1115_POWER_MAX_WINDOW) || (max_gap_us == 0))
+    {
+        return 4;                                                            /* return error */
+    }
+    
+    power->v_scale = v_scale;                                                /* set the voltage scale */
+    power->i_scale = i_scale;                                                /* set the current scale */
+    power->window = window;                                                  /* set the window */
+    power->max_gap_us = max_gap_us;                                          /* set the gap */
+    power->v_raw = 0;                                                        /* init 0 */
+    power->v_us = 0;                                                         /* init 0 */
+    power->v_valid = 0;                                                      /* no voltage yet */
+    power->i_raw = 0;                                                        /* init 0 */
+    power->i_us = 0;                                                         /* init 0 */
+    power->i_pending = 0;                                                    /* no current waits */
+    power->sum_vv = 0;                                                       /* init 0 */
+    power->count_v = 0;                                                      /* init 0 */
+    power->sum_ii = 0;                                                       /* init 0 */
+    power->count_i = 0;                                                      /* init 0 */
+    power->sum_vi = 0;                                                       /* init 0 */
+    power->sum_ww = 0;                                                       /* init 0 */
+    power->count_vi = 0;                                                     /* init 0 */
+    power->pair_us = 0;                                                      /* init 0 */
+    power->pair_valid = 0;                                                   /* no pair yet */
+    power->span_us = 0;                                                      /* init 0 */
+    power->average_new = 0;                                                  /* no average */
+    power->pairs = 0;                                                        /* init 0 */
+    power->skipped = 0;                                                      /* init 0 */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      add one conversion
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[in]  input is the input the conversion belongs to
+ * @param[in]  raw is the raw sample
+ * @param[in]  timestamp_us is the conversion time
+ * @param[out] *sample points to a power sample buffer
+ * @param[out] *valid points to a sample valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 power, sample or valid is NULL
+ *             - 4 input is invalid
+ * @note       feed voltage and current alternately, the voltage is interpolated between the samples
+ *             before and after a current sample to its time, so the sample is emitted with the next voltage,
+ *             any fixed offset between conversion start and timestamp cancels
+ */
+uint8_t ads1115_power_update(ads1115_power_t *power, ads1115_power_input_t input, int16_t raw,
+                             uint64_t timestamp_us, ads1115_power_sample_t *sample, ads1115_bool_t *valid)
+{
+    int64_t v_q8;
+    
+    if ((power == NULL) || (sample == NULL) || (valid == NULL))                             /* check the buffers */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (input > ADS1115_POWER_INPUT_CURRENT)                                                 /* check the input */
+    {
+        return 4;                                                                            /* return error */
+    }
+    
+    *valid = ADS1115_BOOL_FALSE;                                                             /* no sample */
+    if (input == ADS1115_POWER_INPUT_CURRENT)                                                /* current */
+    {
+        if (power->i_pending != 0)                                                           /* two currents in a row */
+        {
+            power->skipped++;                                                                /* the older one is lost */
+        }
+        power->i_raw = raw;                                                                  /* save the current */
+        power->i_us = timestamp_us;                                                          /* save the time */
+        power->i_pending = 1;                                                                /* wait for the voltage */
+        power->sum_ii += (uint64_t)((int32_t)raw * (int32_t)raw);                            /* square sum */
+        power->count_i++;                                                                    /* count */
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    
+    if (power->i_pending != 0)                                                               /* a current waits */
+    {
+        if ((power->v_valid != 0) && (power->v_us <= power->i_us) && (power->i_us <= timestamp_us) &&
+            (timestamp_us > power->v_us) && (timestamp_us - power->v_us <= power->max_gap_us))
+        {
+            v_q8 = (int64_t)power->v_raw * 256 +
+                   ((int64_t)(raw - power->v_raw) * 256 * (int64_t)(power->i_us - power->v_us)) /
+                   (int64_t)(timestamp_us - power->v_us);                                    /* voltage at the current time */
+            power->sum_vi += v_q8 * power->i_raw;                                            /* aligned product */
+            power->sum_ww += (uint64_t)(v_q8 * v_q8) >> 8;                                   /* interpolated square sum */
+            power->count_vi++;                                                               /* count */
+            power->pairs++;                                                                  /* count */
+            if (power->pair_valid != 0)                                                      /* check the last pair */
+            {
+                power->span_us += power->i_us - power->pair_us;                              /* time since the last pair */
+            }
+            power->pair_us = power->i_us;                                                    /* save the pair time */
+            power->pair_valid = 1;                                                           /* set valid */
+            sample->timestamp_us = power->i_us;                                              /* set the time */
+            sample->v = (float)v_q8 / 256.0f * power->v_scale;                               /* set the voltage */
+            sample->i = (float)power->i_raw * power->i_scale;                                /* set the current */
+            sample->p = sample->v * sample->i;                                               /* set the power */
+            *valid = ADS1115_BOOL_TRUE;                                                      /* a new sample */
+        }
+        else
+        {
+            power->skipped++;                                                                /* no neighbours */
+        }
+        power->i_pending = 0;                                                                /* consumed */
+    }
+    power->v_raw = raw;                                                                      /* save the voltage */
+    power->v_us = timestamp_us;                                                              /* save the time */
+    power->v_valid = 1;                                                                      /* set valid */
+    power->sum_vv += (uint64_t)((int32_t)raw * (int32_t)raw);                                /* square sum */
+    power->count_v++;                                                                        /* count */
+    if (power->count_vi >= power->window)                                                    /* window full */
+    {
+        a_ads1115_power_close(power);                                                        /* close the window */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get a new average
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[out] *average points to a power average buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new average
+ *             - 2 power or average is NULL
+ * @note       the rms values use every sample, the real power only the aligned pairs,
+ *             linear interpolation attenuates the voltage, so the real power is scaled by the ratio
+ *             of the raw and the interpolated voltage rms,
+ *             the energy integrates the real power from the pair before the window to its last pair
+ */
+uint8_t ads1115_power_get_average(ads1115_power_t *power, ads1115_power_average_t *average)
+{
+    if ((power == NULL) || (average == NULL))                    /* check the buffers */
+    {
+        return 2;                                                /* return error */
+    }
+    if (power->average_new == 0)                                 /* check the average */
+    {
+        return 1;                                                /* return error */
+    }
+    
+    *average = power->average;                                   /* copy the average */
+    power->average_new = 0;                                      /* consumed */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the power counters
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[out] *pairs points to an aligned pair counter buffer
+ * @param[out] *skipped points to a skipped current sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 power is NULL
+ * @note       none
+ */
+uint8_t ads1115_power_get_counters(ads1115_power_t *power, uint32_t *pairs, uint32_t *skipped)
+{
+    if (power == NULL)                                           /* check power */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    if (pairs != NULL)                                           /* check pairs */
+    {
+        *pairs = power->pairs;                                   /* get the pair counter */
+    }
+    if (skipped != NULL)                                         /* check skipped */
+    {
+        *skipped = power->skipped;                               /* get the skipped counter */
+    }
+    
+    return 0;                                                    /* success return 0 */
+}
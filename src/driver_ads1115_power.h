@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_power.h
+ * @brief     driver ads1115 power header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_POWER_H
+#define DRIVER_ADS1115_POWER_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_power_driver ads1115 power driver function
+ * @brief    ads1115 power driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 power definition
+ */
+#define ADS1115_POWER_MAX_WINDOW 0x1000000        /**< longest window the 64 bit sums hold in fixed point */
+
+/**
+ * @brief ads1115 power input enumeration definition
+ */
+typedef enum
+{
+    ADS1115_POWER_INPUT_VOLTAGE = 0x00,        /**< voltage sample */
+    ADS1115_POWER_INPUT_CURRENT = 0x01,        /**< current sample */
+} ads1115_power_input_t;
+
+/**
+ * @brief ads1115 power sample structure definition
+ */
+typedef struct ads1115_power_sample_s
+{
+    uint64_t timestamp_us;        /**< time of the current sample */
+    float v;                      /**< voltage interpolated to the current sample time */
+    float i;                      /**< current */
+    float p;                      /**< instantaneous power */
+} ads1115_power_sample_t;
+
+/**
+ * @brief ads1115 power average structure definition
+ */
+typedef struct ads1115_power_average_s
+{
+    uint32_t pairs;               /**< aligned pairs in the window */
+    float v_rms;                  /**< rms voltage */
+    float i_rms;                  /**< rms current */
+    float p;                      /**< real power */
+    float s;                      /**< apparent power */
+    float pf;                     /**< power factor, 0 when s is 0 */
+    float energy;                 /**< energy in J, real power times the time the pairs span */
+} ads1115_power_average_t;
+
+/**
+ * @brief ads1115 power structure definition
+ */
+typedef struct ads1115_power_s
+{
+    float v_scale;                        /**< volts per voltage count */
+    float i_scale;                        /**< amperes per current count */
+    uint32_t window;                      /**< aligned pairs per average */
+    uint32_t max_gap_us;                  /**< longest voltage gap that is interpolated */
+    int16_t v_raw;                        /**< last voltage sample */
+    uint64_t v_us;                        /**< last voltage sample time */
+    uint8_t v_valid;                      /**< 1 once a voltage sample arrived */
+    int16_t i_raw;                        /**< current sample waiting for the next voltage */
+    uint64_t i_us;                        /**< waiting current sample time */
+    uint8_t i_pending;                    /**< 1 if a current sample waits */
+    uint64_t sum_vv;                      /**< sum of the squared voltage samples */
+    uint32_t count_v;                     /**< voltage samples in the window */
+    uint64_t sum_ii;                      /**< sum of the squared current samples */
+    uint32_t count_i;                     /**< current samples in the window */
+    int64_t sum_vi;                       /**< sum of the aligned products, 8 fraction bits */
+    uint64_t sum_ww;                      /**< sum of the squared interpolated voltages, 8 fraction bits */
+    uint32_t count_vi;                    /**< aligned pairs in the window */
+    uint64_t pair_us;                     /**< time of the last aligned pair */
+    uint8_t pair_valid;                   /**< 1 once a pair was aligned */
+    uint64_t span_us;                     /**< time from the pair before the window to its last pair */
+    ads1115_power_average_t average;      /**< last average */
+    uint8_t average_new;                  /**< 1 if the average was not read */
+    uint32_t pairs;                       /**< aligned pair counter */
+    uint32_t skipped;                     /**< current samples that could not be aligned */
+} ads1115_power_t;
+
+/**
+ * @brief     initialize a power engine
+ * @param[in] *power points to an ads1115 power structure
+ * @param[in] v_scale is the voltage in volts of one voltage count
+ * @param[in] i_scale is the current in amperes of one current count
+ * @param[in] window is the number of aligned pairs per average
+ * @param[in] max_gap_us is the longest gap between two voltage samples that is interpolated
+ * @return    status code
+ *            - 0 success
+ *            - 2 power is NULL
+ *            - 4 window is 0 or above ADS1115_POWER_MAX_WINDOW or max_gap_us is 0
+ * @note      the scales include the pga lsb, the divider and the shunt
+ */
+uint8_t ads1115_power_init(ads1115_power_t *power, float v_scale, float i_scale, uint32_t window, uint32_t max_gap_us);
+
+/**
+ * @brief      add one conversion
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[in]  input is the input the conversion belongs to
+ * @param[in]  raw is the raw sample
+ * @param[in]  timestamp_us is the conversion time
+ * @param[out] *sample points to a power sample buffer
+ * @param[out] *valid points to a sample valid buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 power, sample or valid is NULL
+ *             - 4 input is invalid
+ * @note       feed voltage and current alternately, the voltage is interpolated between the samples
+ *             before and after a current sample to its time, so the sample is emitted with the next voltage,
+ *             any fixed offset between conversion start and timestamp cancels
+ */
+uint8_t ads1115_power_update(ads1115_power_t *power, ads1115_power_input_t input, int16_t raw,
+                             uint64_t timestamp_us, ads1115_power_sample_t *sample, ads1115_bool_t *valid);
+
+/**
+ * @brief      get a new average
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[out] *average points to a power average buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new average
+ *             - 2 power or average is NULL
+ * @note       the rms values use every sample, the real power only the aligned pairs,
+ *             the energy integrates the real power from the pair before the window to its last pair
+ */
+uint8_t ads1115_power_get_average(ads1115_power_t *power, ads1115_power_average_t *average);
+
+/**
+ * @brief      get the power counters
+ * @param[in]  *power points to an ads1115 power structure
+ * @param[out] *pairs points to an aligned pair counter buffer
+ * @param[out] *skipped points to a skipped current sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 power is NULL
+ * @note       none
+ */
+uint8_t ads1115_power_get_counters(ads1115_power_t *power, uint32_t *pairs, uint32_t *skipped);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
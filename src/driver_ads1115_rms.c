@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_rms.c
+ * @brief     driver ads1115 rms source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_rms.h"
+
+/**
+ * @brief     integer square root
+ * @param[in] x is the radicand
+ * @return    floor of the square root
+ * @note      none
+ */
+static uint32_t a_ads1115_rms_sqrt(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+    
+    while (bit > x)                                              /* highest power of 4 not above x */
+    {
+        bit >>= 2;                                               /* next */
+    }
+    while (bit != 0)                                             /* digit by digit */
+    {
+        if (x >= res + bit)                                      /* check the digit */
+        {
+            x -= res + bit;                                      /* remove */
+            res = (res >> 1) + bit;                              /* set the digit */
+        }
+        else
+        {
+            res >>= 1;                                           /* clear the digit */
+        }
+        bit >>= 2;                                               /* next */
+    }
+    
+    return (uint32_t)res;                                        /* return the root */
+}
+
+/**
+ * @brief     clear the window accumulators
+ * @param[in] *rms points to an ads1115 rms structure
+ * @note      none
+ */
+static void a_ads1115_rms_clear(ads1115_rms_t *rms)
+{
+    rms->sum = 0;                                                /* init 0 */
+    rms->sum_sq = 0;                                             /* init 0 */
+    rms->count = 0;                                              /* init 0 */
+    rms->min = 32767;                                            /* init the min */
+    rms->max = -32768;                                           /* init the max */
+    rms->crossings = 0;                                          /* init 0 */
+    rms->start_fraction = 0.0f;                                  /* init 0 */
+}
+
+/**
+ * @brief     close the window
+ * @param[in] *rms points to an ads1115 rms structure
+ * @param[in] cycles is the number of whole cycles, 0 when not locked
+ * @param[in] span is the window length in samples between the crossings
+ * @note      a locked window is scaled to the interpolated crossings, the part of a sample
+ *            gained or lost at each end is taken at the crossing level, the level then follows the mean
+ */
+static void a_ads1115_rms_close(ads1115_rms_t *rms, uint16_t cycles, float span)
+{
+    ads1115_rms_result_t *r = &rms->result;
+    int64_t n = (int64_t)rms->count;
+    int64_t d;
+    int64_t level = rms->level;
+    int64_t x_sq;
+    int64_t x_sum;
+    uint64_t ms_q16;
+    int64_t mean_q8;
+    uint64_t mean_sq_q16;
+    int32_t peak;
+    
+    d = (cycles != 0) ? (int64_t)(span * 256.0f + 0.5f) : (n * 256);                    /* window length, 8 fraction bits */
+    if (d <= 0)                                                                          /* check the length */
+    {
+        d = n * 256;                                                                     /* use the samples */
+    }
+    x_sq = (int64_t)rms->sum_sq * 256 + level * level * (d - n * 256);                  /* edges sit at the crossing level */
+    x_sum = rms->sum * 256 + level * (d - n * 256);                                      /* edges sit at the crossing level */
+    if (x_sq < 0)                                                                        /* check the sum */
+    {
+        x_sq = 0;                                                                        /* clamp */
+    }
+    ms_q16 = ((uint64_t)(x_sq / d) << 16) + ((uint64_t)(x_sq % d) << 16) / (uint64_t)d;  /* mean square, 16 fraction bits */
+    mean_q8 = (x_sum * 256) / d;                                                         /* mean, 8 fraction bits */
+    mean_sq_q16 = (uint64_t)(mean_q8 * mean_q8);                                         /* squared mean */
+    r->start_seq = rms->start_seq;                                                       /* set the start */
+    r->samples = rms->count;                                                             /* set the length */
+    r->cycles = cycles;                                                                  /* set the cycles */
+    r->start_fraction = rms->start_fraction;                                             /* set the crossing */
+    r->mean = (float)mean_q8 / 256.0f;                                                   /* set the mean */
+    r->rms = (float)a_ads1115_rms_sqrt(ms_q16) / 256.0f;                                 /* set the true rms */
+    r->ac_rms = (ms_q16 > mean_sq_q16) ?
+                (float)a_ads1115_rms_sqrt(ms_q16 - mean_sq_q16) / 256.0f : 0.0f;         /* set the ac rms */
+    r->min = rms->min;                                                                   /* set the min */
+    r->max = rms->max;                                                                   /* set the max */
+    peak = ((int32_t)rms->max > -(int32_t)rms->min) ? rms->max : -(int32_t)rms->min;     /* largest magnitude */
+    r->crest = (r->rms > 0.0f) ? (float)peak / r->rms : 0.0f;                            /* set the crest factor */
+    r->frequency_hz = 0.0f;                                                              /* unknown */
+    if ((cycles != 0) && (rms->period_us > 0.0f) && (span > 0.0f))                       /* check the timing */
+    {
+        r->frequency_hz = (float)cycles * 1000000.0f / (span * rms->period_us);          /* set the frequency */
+    }
+    rms->level = (int16_t)((rms->sum >= 0) ? ((rms->sum + n / 2) / n) : ((rms->sum - n / 2) / n));   /* follow the mean */
+    rms->ready = 1;                                                                      /* new result */
+    rms->windows++;                                                                      /* count */
+}
+
+/**
+ * @brief     initialize an rms engine
+ * @param[in] *rms points to an ads1115 rms structure
+ * @param[in] cycles is the number of cycles per window
+ * @param[in] hysteresis is the crossing hysteresis in raw counts
+ * @param[in] max_samples is the longest window in samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 rms is NULL
+ *            - 4 cycles is 0 or max_samples is 0 or above ADS1115_RMS_MAX_SAMPLES
+ * @note      a window that reaches max_samples without the cycles closes unlocked,
+ *            so a dc input still reports its mean and rms
+ */
+uint8_t ads1115_rms_init(ads1115_rms_t *rms, uint16_t cycles, uint16_t hysteresis, uint32_t max_samples)
+{
+    if (rms == NULL)                                             /* check rms */
+    {
+        return 2;                                                /* return error */
+    }
+    if ((cycles == 0) || (max_samples == 0) ||
+        (max_samples > ADS1115_RMS_MAX_SAMPLES))                 /* check the config */
+    {
+        return 4;                                                /* return error */
+    }
+    
+    a_ads1115_rms_clear(rms);                                    /* clear the window */
+    rms->start_seq = 0;                                          /* init 0 */
+    rms->cycles = cycles;                                        /* set the cycles */
+    rms->hysteresis = hysteresis;                                /* set the hysteresis */
+    rms->level = 0;                                              /* start at zero */
+    rms->prev = 0;                                               /* init 0 */
+    rms->last_seq = 0;                                           /* init 0 */
+    rms->max_samples = max_samples;                              /* set the longest window */
+    rms->period_us = 0.0f;                                       /* unknown */
+    rms->prev_valid = 0;                                         /* no previous sample */
+    rms->locked = 0;                                             /* not locked */
+    rms->armed = 0;                                              /* not armed */
+    rms->ready = 0;                                              /* no result */
+    rms->windows = 0;                                            /* init 0 */
+    rms->resyncs = 0;                                            /* init 0 */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     set the conversion period
+ * @param[in] *rms points to an ads1115 rms structure
+ * @param[in] period_us is the conversion period
+ * @return    status code
+ *            - 0 success
+ *            - 2 rms is NULL
+ * @note      pass the period recovered by ads1115_clock_get_period so the
+ *            frequency is free of the host timestamp jitter
+ */
+uint8_t ads1115_rms_set_period(ads1115_rms_t *rms, float period_us)
+{
+    if (rms == NULL)                                             /* check rms */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    rms->period_us = period_us;                                  /* set the period */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      add one sample
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  seq is the conversion sequence number
+ * @param[out] *ready points to a result ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rms or ready is NULL
+ * @note       integer work only, a window closes on the rising crossing that completes
+ *             its cycles and that crossing starts the next window, a sequence gap restarts the lock
+ */
+uint8_t ads1115_rms_update(ads1115_rms_t *rms, int16_t raw, uint32_t seq, ads1115_bool_t *ready)
+{
+    uint8_t crossing = 0;
+    uint8_t closed = 0;
+    float fraction = 0.0f;
+    
+    if ((rms == NULL) || (ready == NULL))                                                    /* check the buffers */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    if ((rms->prev_valid != 0) && (seq != rms->last_seq + 1))                                /* check the sequence */
+    {
+        a_ads1115_rms_clear(rms);                                                            /* drop the window */
+        rms->locked = 0;                                                                     /* lost the lock */
+        rms->armed = 0;                                                                      /* not armed */
+        rms->prev_valid = 0;                                                                 /* no previous sample */
+        rms->resyncs++;                                                                      /* count */
+    }
+    if (rms->prev_valid != 0)                                                                /* check the previous sample */
+    {
+        if ((int32_t)raw < (int32_t)rms->level - (int32_t)rms->hysteresis)                   /* well below the level */
+        {
+            rms->armed = 1;                                                                  /* arm */
+        }
+        else if ((rms->armed != 0) && (rms->prev < rms->level) && (raw >= rms->level))       /* rising crossing */
+        {
+            fraction = (float)(rms->level - rms->prev) / (float)(raw - rms->prev);           /* interpolate */
+            rms->armed = 0;                                                                  /* disarm */
+            crossing = 1;                                                                    /* flag */
+        }
+    }
+    if (crossing != 0)                                                                       /* a crossing */
+    {
+        if (rms->locked != 0)                                                                /* inside a window */
+        {
+            rms->crossings++;                                                                /* one more cycle */
+            if (rms->crossings >= rms->cycles)                                               /* all cycles */
+            {
+                a_ads1115_rms_close(rms, rms->cycles, (float)(seq - rms->start_seq) +
+                                    fraction - rms->start_fraction);                         /* close the window */
+                closed = 1;                                                                  /* flag */
+            }
+        }
+        if ((rms->locked == 0) || (closed != 0))                                             /* start a window */
+        {
+            a_ads1115_rms_clear(rms);                                                        /* clear the window */
+            rms->start_seq = seq;                                                            /* set the start */
+            rms->start_fraction = fraction;                                                  /* set the crossing */
+            rms->locked = 1;                                                                 /* locked */
+        }
+    }
+    if (rms->count == 0)                                                                     /* first sample */
+    {
+        rms->start_seq = seq;                                                                /* set the start */
+    }
+    rms->sum += raw;                                                                         /* sum */
+    rms->sum_sq += (uint64_t)((int32_t)raw * (int32_t)raw);                                  /* sum of squares */
+    rms->count++;                                                                            /* count */
+    if (raw < rms->min)                                                                      /* check the min */
+    {
+        rms->min = raw;                                                                      /* set the min */
+    }
+    if (raw > rms->max)                                                                      /* check the max */
+    {
+        rms->max = raw;                                                                      /* set the max */
+    }
+    if (rms->count >= rms->max_samples)                                                      /* too long */
+    {
+        a_ads1115_rms_close(rms, 0, 0.0f);                                                   /* close unlocked */
+        a_ads1115_rms_clear(rms);                                                            /* clear the window */
+        rms->locked = 0;                                                                     /* relock */
+        closed = 1;                                                                          /* flag */
+    }
+    rms->prev = raw;                                                                         /* save the sample */
+    rms->last_seq = seq;                                                                     /* save the sequence */
+    rms->prev_valid = 1;                                                                     /* set valid */
+    *ready = (closed != 0) ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE;                         /* set ready */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the last result
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[out] *result points to an rms result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no window has closed
+ *             - 2 rms or result is NULL
+ * @note       the values are in raw counts, scale them by the lsb of the range
+ */
+uint8_t ads1115_rms_get_result(ads1115_rms_t *rms, ads1115_rms_result_t *result)
+{
+    if ((rms == NULL) || (result == NULL))                       /* check the buffers */
+    {
+        return 2;                                                /* return error */
+    }
+    if (rms->ready == 0)                                         /* check the result */
+    {
+        return 1;                                                /* return error */
+    }
+    
+    *result = rms->result;                                       /* copy the result */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the rms counters
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[out] *windows points to a closed window counter buffer
+ * @param[out] *resyncs points to a sequence gap counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rms is NULL
+ * @note       none
+ */
+uint8_t ads1115_rms_get_counters(ads1115_rms_t *rms, uint32_t *windows, uint32_t *resyncs)
+{
+    if (rms == NULL)                                             /* check rms */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    if (windows != NULL)                                         /* check windows */
+    {
+        *windows = rms->windows;                                 /* get the window counter */
+    }
+    if (resyncs != NULL)                                         /* check resyncs */
+    {
+        *resyncs = rms->resyncs;                                 /* get the resync counter */
+    }
+    
+    return 0;                                                    /* success return 0 */
+}
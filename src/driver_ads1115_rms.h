@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_rms.h
+ * @brief     driver ads1115 rms header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_RMS_H
+#define DRIVER_ADS1115_RMS_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_rms_driver ads1115 rms driver function
+ * @brief    ads1115 rms driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 rms definition
+ */
+#define ADS1115_RMS_MAX_SAMPLES 0x1000000        /**< longest window the 64 bit sums hold in fixed point */
+
+/**
+ * @brief ads1115 rms result structure definition
+ */
+typedef struct ads1115_rms_result_s
+{
+    uint32_t start_seq;         /**< first sample of the window */
+    uint32_t samples;           /**< samples in the window */
+    uint16_t cycles;            /**< whole cycles, 0 when the window closed without a crossing lock */
+    float start_fraction;       /**< starting crossing position between start_seq - 1 and start_seq */
+    float mean;                 /**< mean in raw counts */
+    float rms;                  /**< true rms in raw counts including the mean */
+    float ac_rms;               /**< rms in raw counts with the mean removed */
+    int16_t min;                /**< lowest sample */
+    int16_t max;                /**< highest sample */
+    float crest;                /**< largest absolute sample over the true rms */
+    float frequency_hz;         /**< cycle frequency, 0 when unknown */
+} ads1115_rms_result_t;
+
+/**
+ * @brief ads1115 rms structure definition
+ */
+typedef struct ads1115_rms_s
+{
+    int64_t sum;                        /**< sum of the window samples */
+    uint64_t sum_sq;                    /**< sum of the squared window samples */
+    uint32_t count;                     /**< samples in the window */
+    uint32_t start_seq;                 /**< first sample of the window */
+    float start_fraction;               /**< starting crossing position */
+    int16_t min;                        /**< lowest window sample */
+    int16_t max;                        /**< highest window sample */
+    uint16_t crossings;                 /**< rising crossings since the window start */
+    uint16_t cycles;                    /**< cycles per window */
+    uint16_t hysteresis;                /**< counts below the level that arm a crossing */
+    int16_t level;                      /**< crossing level, follows the window mean */
+    int16_t prev;                       /**< previous sample */
+    uint32_t last_seq;                  /**< previous sample sequence */
+    uint32_t max_samples;               /**< longest window */
+    float period_us;                    /**< conversion period, 0 means unknown */
+    uint8_t prev_valid;                 /**< 1 if prev is the sample before the next one */
+    uint8_t locked;                     /**< 1 once a crossing started the window */
+    uint8_t armed;                      /**< 1 after a sample below the level minus the hysteresis */
+    uint8_t ready;                      /**< 1 once a window has closed */
+    ads1115_rms_result_t result;        /**< last result */
+    uint32_t windows;                   /**< window counter */
+    uint32_t resyncs;                   /**< sequence gap counter */
+} ads1115_rms_t;
+
+/**
+ * @brief     initialize an rms engine
+ * @param[in] *rms points to an ads1115 rms structure
+ * @param[in] cycles is the number of cycles per window
+ * @param[in] hysteresis is the crossing hysteresis in raw counts
+ * @param[in] max_samples is the longest window in samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 rms is NULL
+ *            - 4 cycles is 0 or max_samples is 0 or above ADS1115_RMS_MAX_SAMPLES
+ * @note      a window that reaches max_samples without the cycles closes unlocked,
+ *            so a dc input still reports its mean and rms
+ */
+uint8_t ads1115_rms_init(ads1115_rms_t *rms, uint16_t cycles, uint16_t hysteresis, uint32_t max_samples);
+
+/**
+ * @brief     set the conversion period
+ * @param[in] *rms points to an ads1115 rms structure
+ * @param[in] period_us is the conversion period
+ * @return    status code
+ *            - 0 success
+ *            - 2 rms is NULL
+ * @note      pass the period recovered by ads1115_clock_get_period so the
+ *            frequency is free of the host timestamp jitter
+ */
+uint8_t ads1115_rms_set_period(ads1115_rms_t *rms, float period_us);
+
+/**
+ * @brief      add one sample
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  seq is the conversion sequence number
+ * @param[out] *ready points to a result ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rms or ready is NULL
+ * @note       integer work only, a window closes on the rising crossing that completes
+ *             its cycles and that crossing starts the next window, a sequence gap restarts the lock
+ */
+uint8_t ads1115_rms_update(ads1115_rms_t *rms, int16_t raw, uint32_t seq, ads1115_bool_t *ready);
+
+/**
+ * @brief      get the last result
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[out] *result points to an rms result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no window has closed
+ *             - 2 rms or result is NULL
+ * @note       the values are in raw counts, scale them by the lsb of the range
+ */
+uint8_t ads1115_rms_get_result(ads1115_rms_t *rms, ads1115_rms_result_t *result);
+
+/**
+ * @brief      get the rms counters
+ * @param[in]  *rms points to an ads1115 rms structure
+ * @param[out] *windows points to a closed window counter buffer
+ * @param[out] *resyncs points to a sequence gap counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rms is NULL
+ * @note       none
+ */
+uint8_t ads1115_rms_get_counters(ads1115_rms_t *rms, uint32_t *windows, uint32_t *resyncs);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,548 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_scheduler.c
+ * @brief     driver ads1115 scheduler source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_scheduler.h"
+
+/**
+ * @brief liu layland bound table definition
+ */
+static const float gs_rm_bound[9] =
+{
+    1.0f, 1.0f, 0.8284f, 0.7798f, 0.7568f, 0.7435f, 0.7348f, 0.7286f, 0.7241f,
+};
+
+/**
+ * @brief status poll limit definition
+ */
+#define ADS1115_SCHEDULER_POLL_MAX 1000        /**< status poll limit */
+
+/**
+ * @brief     compare the priority of two tasks
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] *a points to an ads1115 scheduler task structure
+ * @param[in] *b points to an ads1115 scheduler task structure
+ * @return    1 if a runs before b else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_scheduler_before(ads1115_scheduler_t *scheduler,
+                                          ads1115_scheduler_task_t *a, ads1115_scheduler_task_t *b)
+{
+    if (b == NULL)                                                         /* check b */
+    {
+        return 1;                                                          /* a wins */
+    }
+    if ((scheduler->policy == ADS1115_SCHEDULER_POLICY_RM) &&
+        (a->period_us != b->period_us))                                    /* static priority */
+    {
+        return (a->period_us < b->period_us) ? 1 : 0;                      /* shorter period first */
+    }
+    
+    return (a->abs_deadline_us < b->abs_deadline_us) ? 1 : 0;              /* earlier deadline first */
+}
+
+/**
+ * @brief     check whether a device has a conversion in flight
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] *handle points to an ads1115 handle structure
+ * @return    1 if busy else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_scheduler_busy(ads1115_scheduler_t *scheduler, ads1115_handle_t *handle)
+{
+    uint8_t i;
+    
+    for (i = 0; i < scheduler->count; i++)                                                  /* scan the tasks */
+    {
+        if ((scheduler->task[i]->running != 0) && (scheduler->task[i]->handle == handle))   /* check device */
+        {
+            return 1;                                                                       /* busy */
+        }
+    }
+    
+    return 0;                                                                               /* idle */
+}
+
+/**
+ * @brief     release the jobs that are due
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] now is the current time
+ * @note      a job not started by the next release is dropped and counted as missed,
+ *            a release during a running conversion waits for its completion
+ */
+static void a_ads1115_scheduler_release(ads1115_scheduler_t *scheduler, uint64_t now)
+{
+    uint8_t i;
+    ads1115_scheduler_task_t *t;
+    
+    for (i = 0; i < scheduler->count; i++)                                     /* scan the tasks */
+    {
+        t = scheduler->task[i];                                                /* get task */
+        if ((t->running != 0) || (now < t->next_release_us))                   /* check release */
+        {
+            continue;                                                          /* next task */
+        }
+        if (t->pending != 0)                                                   /* job never started */
+        {
+            t->misses++;                                                       /* task miss */
+            scheduler->misses++;                                               /* total miss */
+        }
+        t->release_us = t->next_release_us;                                    /* release slot */
+        while (t->release_us + t->period_us <= now)                            /* skip the lost slots */
+        {
+            t->release_us += t->period_us;                                     /* next slot */
+            t->misses++;                                                       /* task miss */
+            scheduler->misses++;                                               /* total miss */
+        }
+        t->abs_deadline_us = t->release_us + t->deadline_us;                   /* absolute deadline */
+        t->next_release_us = t->release_us + t->period_us;                     /* next release */
+        t->pending = 1;                                                        /* flag pending */
+    }
+}
+
+/**
+ * @brief     complete a job
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] *t points to an ads1115 scheduler task structure
+ * @param[in] status is the completion status
+ * @note      none
+ */
+static void a_ads1115_scheduler_complete(ads1115_scheduler_t *scheduler, ads1115_scheduler_task_t *t, uint8_t status)
+{
+    uint64_t now;
+    
+    now = scheduler->timestamp_us();                                           /* completion time */
+    t->running = 0;                                                            /* clear running */
+    t->pending = 0;                                                            /* clear pending */
+    t->status = status;                                                        /* set status */
+    t->jobs++;                                                                 /* job counter */
+    if (now - t->release_us > t->max_latency_us)                               /* check latency */
+    {
+        t->max_latency_us = (uint32_t)(now - t->release_us);                   /* worst latency */
+    }
+    if ((status != 0) || (now > t->abs_deadline_us))                           /* check deadline */
+    {
+        t->misses++;                                                           /* task miss */
+        scheduler->misses++;                                                   /* total miss */
+    }
+    if (t->callback != NULL)                                                   /* check callback */
+    {
+        t->callback(t);                                                        /* run callback */
+    }
+}
+
+/**
+ * @brief     finish the highest priority conversion that should be ready
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] now is the current time
+ * @return    1 if a step ran else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_scheduler_finish(ads1115_scheduler_t *scheduler, uint64_t now)
+{
+    uint8_t i;
+    uint8_t res;
+    uint64_t t0;
+    ads1115_bool_t finished;
+    ads1115_scheduler_task_t *t = NULL;
+    
+    for (i = 0; i < scheduler->count; i++)                                                      /* pick a conversion */
+    {
+        if ((scheduler->task[i]->running != 0) && (scheduler->task[i]->ready_us <= now) &&
+            (a_ads1115_scheduler_before(scheduler, scheduler->task[i], t) != 0))                /* check priority */
+        {
+            t = scheduler->task[i];                                                             /* best so far */
+        }
+    }
+    if (t == NULL)                                                                              /* check task */
+    {
+        return 0;                                                                               /* nothing ready */
+    }
+    
+    t0 = scheduler->timestamp_us();                                                             /* bus start */
+    res = ads1115_get_single_read_status(t->handle, &finished);                                 /* check os bit */
+    if ((res == 0) && (finished == ADS1115_BOOL_TRUE))                                          /* check finished */
+    {
+        res = ads1115_get_single_read(t->handle, &t->raw, &t->v);                               /* read result */
+        scheduler->bus_busy_us += scheduler->timestamp_us() - t0;                               /* bus time */
+        a_ads1115_scheduler_complete(scheduler, t, (res != 0) ? 1 : 0);                         /* complete */
+    }
+    else if ((res != 0) || (++t->polls > ADS1115_SCHEDULER_POLL_MAX))                           /* check error */
+    {
+        scheduler->bus_busy_us += scheduler->timestamp_us() - t0;                               /* bus time */
+        a_ads1115_scheduler_complete(scheduler, t, 1);                                          /* complete with error */
+    }
+    else
+    {
+        scheduler->bus_busy_us += scheduler->timestamp_us() - t0;                               /* bus time */
+        t->ready_us = now + ADS1115_SCHEDULER_POLL_US;                                          /* poll again later */
+    }
+    
+    return 1;                                                                                   /* step ran */
+}
+
+/**
+ * @brief     start the highest priority pending job on an idle device
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @return    1 if a step ran else 0
+ * @note      none
+ */
+static uint8_t a_ads1115_scheduler_dispatch(ads1115_scheduler_t *scheduler)
+{
+    uint8_t i;
+    uint8_t res;
+    uint32_t wait_us;
+    uint64_t t0;
+    uint64_t t1;
+    ads1115_scheduler_task_t *t = NULL;
+    
+    for (i = 0; i < scheduler->count; i++)                                                      /* pick a job */
+    {
+        if ((scheduler->task[i]->pending != 0) &&
+            (a_ads1115_scheduler_before(scheduler, scheduler->task[i], t) != 0) &&
+            (a_ads1115_scheduler_busy(scheduler, scheduler->task[i]->handle) == 0))             /* check priority */
+        {
+            t = scheduler->task[i];                                                             /* best so far */
+        }
+    }
+    if (t == NULL)                                                                              /* check task */
+    {
+        return 0;                                                                               /* nothing to start */
+    }
+    
+    t0 = scheduler->timestamp_us();                                                             /* bus start */
+    res = ads1115_set_channel(t->handle, t->channel);                                           /* switch channel */
+    if (res == 0)                                                                               /* check result */
+    {
+        res = ads1115_start_single_read(t->handle, &wait_us);                                   /* start conversion */
+    }
+    t1 = scheduler->timestamp_us();                                                             /* bus end */
+    scheduler->bus_busy_us += t1 - t0;                                                          /* bus time */
+    if (res != 0)                                                                               /* check result */
+    {
+        a_ads1115_scheduler_complete(scheduler, t, 1);                                          /* complete with error */
+        
+        return 1;                                                                               /* step ran */
+    }
+    t->pending = 0;                                                                             /* clear pending */
+    t->running = 1;                                                                             /* flag running */
+    t->polls = 0;                                                                               /* clear polls */
+    t->ready_us = t1 + wait_us;                                                                 /* expected ready time */
+    
+    return 1;                                                                                   /* step ran */
+}
+
+/**
+ * @brief     initialize the scheduler
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] policy is the scheduling policy
+ * @param[in] transaction_us is the bus cost of one register transaction
+ * @param[in] *timestamp_us points to a monotonic timestamp function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler or timestamp_us is NULL
+ *            - 4 policy is invalid
+ * @note      at 400kHz one register transaction takes about 75us
+ */
+uint8_t ads1115_scheduler_init(ads1115_scheduler_t *scheduler, ads1115_scheduler_policy_t policy,
+                               uint32_t transaction_us, uint64_t (*timestamp_us)(void))
+{
+    if ((scheduler == NULL) || (timestamp_us == NULL))                   /* check pointer */
+    {
+        return 2;                                                        /* return error */
+    }
+    if ((uint32_t)policy > (uint32_t)ADS1115_SCHEDULER_POLICY_RM)        /* check policy */
+    {
+        return 4;                                                        /* return error */
+    }
+    
+    memset(scheduler, 0, sizeof(ads1115_scheduler_t));                   /* clear the scheduler */
+    scheduler->policy = policy;                                          /* set policy */
+    scheduler->transaction_us = transaction_us;                          /* set bus cost */
+    scheduler->timestamp_us = timestamp_us;                              /* set timestamp */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     add a periodic channel task
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] *task points to an ads1115 scheduler task structure
+ * @param[in] *handle points to an initialized ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] period_us is the release period
+ * @param[in] deadline_us is the relative deadline, 0 means the period
+ * @param[in] *callback points to a completion function address
+ * @param[in] *arg is the completion argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 get conversion time failed
+ *            - 2 scheduler, task or handle is NULL
+ *            - 4 task table is full or period is 0
+ * @note      the device rate must be set before, the conversion time is read here
+ */
+uint8_t ads1115_scheduler_add_task(ads1115_scheduler_t *scheduler, ads1115_scheduler_task_t *task,
+                                   ads1115_handle_t *handle, ads1115_channel_t channel,
+                                   uint32_t period_us, uint32_t deadline_us,
+                                   void (*callback)(ads1115_scheduler_task_t *task), void *arg)
+{
+    uint32_t us;
+    
+    if ((scheduler == NULL) || (task == NULL) || (handle == NULL))           /* check pointer */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((scheduler->count >= ADS1115_SCHEDULER_MAX_TASK) || (period_us == 0))/* check table */
+    {
+        return 4;                                                            /* return error */
+    }
+    if (ads1115_get_conversion_time(handle, &us) != 0)                       /* get conversion time */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    memset(task, 0, sizeof(ads1115_scheduler_task_t));                       /* clear the task */
+    task->handle = handle;                                                   /* set handle */
+    task->channel = channel;                                                 /* set channel */
+    task->period_us = period_us;                                             /* set period */
+    if ((deadline_us == 0) || (deadline_us > period_us))                     /* check deadline */
+    {
+        deadline_us = period_us;                                             /* implicit deadline */
+    }
+    task->deadline_us = deadline_us;                                         /* set deadline */
+    task->callback = callback;                                               /* set callback */
+    task->arg = arg;                                                         /* set argument */
+    task->conversion_us = us;                                                /* set conversion time */
+    scheduler->task[scheduler->count] = task;                                /* add to the table */
+    scheduler->count++;                                                      /* task number */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      check the task set against the policy bound
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *device_load points to a worst device utilization buffer
+ * @param[out] *bus_load points to a bus utilization buffer
+ * @return     status code
+ *             - 0 schedulable
+ *             - 1 not schedulable
+ *             - 2 scheduler is NULL
+ * @note       edf accepts a device load up to 1, rm uses the liu layland bound,
+ *             conversions are not preemptive so a long conversion adds blocking the bound ignores
+ */
+uint8_t ads1115_scheduler_check(ads1115_scheduler_t *scheduler, float *device_load, float *bus_load)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t n;
+    uint8_t res = 0;
+    float load;
+    float bound;
+    float worst = 0.0f;
+    float bus = 0.0f;
+    ads1115_scheduler_task_t *t;
+    
+    if (scheduler == NULL)                                                                       /* check scheduler */
+    {
+        return 2;                                                                                /* return error */
+    }
+    
+    for (i = 0; i < scheduler->count; i++)                                                       /* each device once */
+    {
+        t = scheduler->task[i];                                                                  /* get task */
+        bus += (float)(ADS1115_SCHEDULER_JOB_TRANSACTIONS * scheduler->transaction_us) /
+               (float)t->period_us;                                                              /* bus demand */
+        for (j = 0; j < i; j++)                                                                  /* seen before */
+        {
+            if (scheduler->task[j]->handle == t->handle)                                         /* check device */
+            {
+                break;                                                                           /* seen */
+            }
+        }
+        if (j != i)                                                                              /* check seen */
+        {
+            continue;                                                                            /* next task */
+        }
+        load = 0.0f;                                                                             /* clear load */
+        n = 0;                                                                                   /* clear number */
+        for (j = i; j < scheduler->count; j++)                                                   /* tasks of the device */
+        {
+            if (scheduler->task[j]->handle == t->handle)                                         /* check device */
+            {
+                load += (float)scheduler->task[j]->conversion_us / (float)scheduler->task[j]->period_us;
+                n++;                                                                             /* task number */
+            }
+        }
+        if (scheduler->policy == ADS1115_SCHEDULER_POLICY_RM)                                    /* rm bound */
+        {
+            bound = (n < 9) ? gs_rm_bound[n] : 0.6931f;                                          /* liu layland */
+        }
+        else
+        {
+            bound = 1.0f;                                                                        /* edf bound */
+        }
+        if (load > bound)                                                                        /* check device */
+        {
+            res = 1;                                                                             /* not schedulable */
+        }
+        worst = (load > worst) ? load : worst;                                                   /* worst device */
+    }
+    if (bus > 1.0f)                                                                              /* check bus */
+    {
+        res = 1;                                                                                 /* not schedulable */
+    }
+    if (device_load != NULL)                                                                     /* check buffer */
+    {
+        *device_load = worst;                                                                    /* set device load */
+    }
+    if (bus_load != NULL)                                                                        /* check buffer */
+    {
+        *bus_load = bus;                                                                         /* set bus load */
+    }
+    
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief     start releasing jobs
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ * @note      every task releases its first job now
+ */
+uint8_t ads1115_scheduler_start(ads1115_scheduler_t *scheduler)
+{
+    uint8_t i;
+    
+    if (scheduler == NULL)                                                    /* check scheduler */
+    {
+        return 2;                                                             /* return error */
+    }
+    
+    scheduler->start_us = scheduler->timestamp_us();                          /* start time */
+    scheduler->bus_busy_us = 0;                                               /* clear bus time */
+    scheduler->misses = 0;                                                    /* clear misses */
+    for (i = 0; i < scheduler->count; i++)                                    /* each task */
+    {
+        scheduler->task[i]->next_release_us = scheduler->start_us;            /* release now */
+        scheduler->task[i]->pending = 0;                                      /* clear pending */
+        scheduler->task[i]->running = 0;                                      /* clear running */
+        scheduler->task[i]->jobs = 0;                                         /* clear jobs */
+        scheduler->task[i]->misses = 0;                                       /* clear misses */
+        scheduler->task[i]->max_latency_us = 0;                               /* clear latency */
+    }
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      run every scheduling step that is due
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *next_us points to a next service time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler or next_us is NULL
+ * @note       the caller sleeps until next_us and calls again
+ */
+uint8_t ads1115_scheduler_run(ads1115_scheduler_t *scheduler, uint64_t *next_us)
+{
+    uint8_t i;
+    uint8_t step;
+    uint64_t now;
+    uint64_t next;
+    ads1115_scheduler_task_t *t;
+    
+    if ((scheduler == NULL) || (next_us == NULL))                                   /* check pointer */
+    {
+        return 2;                                                                   /* return error */
+    }
+    
+    do
+    {
+        now = scheduler->timestamp_us();                                            /* get now */
+        a_ads1115_scheduler_release(scheduler, now);                                /* release due jobs */
+        step = a_ads1115_scheduler_finish(scheduler, now);                          /* finish one conversion */
+        step |= a_ads1115_scheduler_dispatch(scheduler);                            /* start one job */
+    } while (step != 0);                                                            /* until idle */
+    
+    next = UINT64_MAX;                                                              /* nothing pending */
+    for (i = 0; i < scheduler->count; i++)                                          /* earliest event */
+    {
+        t = scheduler->task[i];                                                     /* get task */
+        if (t->running != 0)                                                        /* conversion in flight */
+        {
+            next = (t->ready_us < next) ? t->ready_us : next;                       /* ready time */
+        }
+        else if (t->pending == 0)                                                   /* waiting release */
+        {
+            next = (t->next_release_us < next) ? t->next_release_us : next;         /* release time */
+        }
+        else
+        {
+            /* pending behind a busy device, woken by that device */
+        }
+    }
+    *next_us = next;                                                                /* set next time */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the measured statistics
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *misses points to a total deadline miss counter buffer
+ * @param[out] *bus_load points to a measured bus utilization buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ * @note       per task counters are kept in each task structure
+ */
+uint8_t ads1115_scheduler_get_statistics(ads1115_scheduler_t *scheduler, uint32_t *misses, float *bus_load)
+{
+    uint64_t elapsed;
+    
+    if (scheduler == NULL)                                                           /* check scheduler */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    elapsed = scheduler->timestamp_us() - scheduler->start_us;                       /* elapsed time */
+    *misses = scheduler->misses;                                                     /* set misses */
+    *bus_load = (elapsed != 0) ? (float)scheduler->bus_busy_us / (float)elapsed : 0.0f;
+    
+    return 0;                                                                        /* success return 0 */
+}
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_scheduler.h
+ * @brief     driver ads1115 scheduler header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_SCHEDULER_H
+#define DRIVER_ADS1115_SCHEDULER_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_scheduler_driver ads1115 scheduler driver function
+ * @brief    ads1115 scheduler driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 scheduler definition
+ */
+#ifndef ADS1115_SCHEDULER_MAX_TASK
+    #define ADS1115_SCHEDULER_MAX_TASK 32              /**< max task number */
+#endif
+#ifndef ADS1115_SCHEDULER_POLL_US
+    #define ADS1115_SCHEDULER_POLL_US 100              /**< status poll interval after the expected ready time */
+#endif
+#define ADS1115_SCHEDULER_JOB_TRANSACTIONS 7           /**< bus transactions of one conversion job */
+
+/**
+ * @brief ads1115 scheduler policy enumeration definition
+ */
+typedef enum
+{
+    ADS1115_SCHEDULER_POLICY_EDF = 0x00,        /**< earliest deadline first */
+    ADS1115_SCHEDULER_POLICY_RM  = 0x01,        /**< rate monotonic */
+} ads1115_scheduler_policy_t;
+
+/**
+ * @brief ads1115 scheduler task structure definition
+ */
+typedef struct ads1115_scheduler_task_s
+{
+    ads1115_handle_t *handle;                                    /**< device to read */
+    ads1115_channel_t channel;                                   /**< channel to read */
+    uint32_t period_us;                                          /**< release period */
+    uint32_t deadline_us;                                        /**< relative deadline */
+    void (*callback)(struct ads1115_scheduler_task_s *task);     /**< point to a completion function address */
+    void *arg;                                                   /**< completion argument */
+    int16_t raw;                                                 /**< raw result */
+    float v;                                                     /**< converted result */
+    uint8_t status;                                              /**< completion status, 0 means success */
+    uint32_t conversion_us;                                      /**< conversion time of the device */
+    uint64_t next_release_us;                                    /**< next job release time */
+    uint64_t release_us;                                         /**< current job release time */
+    uint64_t abs_deadline_us;                                    /**< current job deadline */
+    uint64_t ready_us;                                           /**< expected ready time of the conversion */
+    uint8_t pending;                                             /**< job released and not started */
+    uint8_t running;                                             /**< conversion in flight */
+    uint16_t polls;                                              /**< status polls of the conversion */
+    uint32_t jobs;                                               /**< completed job counter */
+    uint32_t misses;                                             /**< deadline miss counter */
+    uint32_t max_latency_us;                                     /**< worst release to completion latency */
+} ads1115_scheduler_task_t;
+
+/**
+ * @brief ads1115 scheduler structure definition
+ */
+typedef struct ads1115_scheduler_s
+{
+    uint64_t (*timestamp_us)(void);                               /**< point to a monotonic timestamp function address */
+    ads1115_scheduler_task_t *task[ADS1115_SCHEDULER_MAX_TASK];   /**< task table */
+    uint8_t count;                                                /**< task number */
+    ads1115_scheduler_policy_t policy;                            /**< scheduling policy */
+    uint32_t transaction_us;                                      /**< bus cost of one transaction */
+    uint64_t start_us;                                            /**< start time */
+    uint64_t bus_busy_us;                                         /**< measured bus busy time */
+    uint32_t misses;                                              /**< total deadline miss counter */
+} ads1115_scheduler_t;
+
+/**
+ * @brief     initialize the scheduler
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] policy is the scheduling policy
+ * @param[in] transaction_us is the bus cost of one register transaction
+ * @param[in] *timestamp_us points to a monotonic timestamp function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler or timestamp_us is NULL
+ *            - 4 policy is invalid
+ * @note      at 400kHz one register transaction takes about 75us
+ */
+uint8_t ads1115_scheduler_init(ads1115_scheduler_t *scheduler, ads1115_scheduler_policy_t policy,
+                               uint32_t transaction_us, uint64_t (*timestamp_us)(void));
+
+/**
+ * @brief     add a periodic channel task
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @param[in] *task points to an ads1115 scheduler task structure
+ * @param[in] *handle points to an initialized ads1115 handle structure
+ * @param[in] channel is the channel to read
+ * @param[in] period_us is the release period
+ * @param[in] deadline_us is the relative deadline, 0 means the period
+ * @param[in] *callback points to a completion function address
+ * @param[in] *arg is the completion argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 get conversion time failed
+ *            - 2 scheduler, task or handle is NULL
+ *            - 4 task table is full or period is 0
+ * @note      the device rate must be set before, the conversion time is read here
+ */
+uint8_t ads1115_scheduler_add_task(ads1115_scheduler_t *scheduler, ads1115_scheduler_task_t *task,
+                                   ads1115_handle_t *handle, ads1115_channel_t channel,
+                                   uint32_t period_us, uint32_t deadline_us,
+                                   void (*callback)(ads1115_scheduler_task_t *task), void *arg);
+
+/**
+ * @brief      check the task set against the policy bound
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *device_load points to a worst device utilization buffer
+ * @param[out] *bus_load points to a bus utilization buffer
+ * @return     status code
+ *             - 0 schedulable
+ *             - 1 not schedulable
+ *             - 2 scheduler is NULL
+ * @note       edf accepts a device load up to 1, rm uses the liu layland bound,
+ *             conversions are not preemptive so a long conversion adds blocking the bound ignores
+ */
+uint8_t ads1115_scheduler_check(ads1115_scheduler_t *scheduler, float *device_load, float *bus_load);
+
+/**
+ * @brief     start releasing jobs
+ * @param[in] *scheduler points to an ads1115 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ * @note      every task releases its first job now
+ */
+uint8_t ads1115_scheduler_start(ads1115_scheduler_t *scheduler);
+
+/**
+ * @brief      run every scheduling step that is due
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *next_us points to a next service time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler or next_us is NULL
+ * @note       the caller sleeps until next_us and calls again
+ */
+uint8_t ads1115_scheduler_run(ads1115_scheduler_t *scheduler, uint64_t *next_us);
+
+/**
+ * @brief      get the measured statistics
+ * @param[in]  *scheduler points to an ads1115 scheduler structure
+ * @param[out] *misses points to a total deadline miss counter buffer
+ * @param[out] *bus_load points to a measured bus utilization buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ * @note       per task counters are kept in each task structure
+ */
+uint8_t ads1115_scheduler_get_statistics(ads1115_scheduler_t *scheduler, uint32_t *misses, float *bus_load);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_sequence.c
+ * @brief     driver ads1115 sequence source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_sequence.h"
+
+/**
+ * @brief      count the conversions since the last read
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  n is the number of new conversions
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @note       none
+ */
+static void a_ads1115_sequence_count(ads1115_sequence_t *sequence, uint32_t n,
+                                     uint32_t *seq, ads1115_bool_t *fresh)
+{
+    if (n == 0)                                           /* no new conversion */
+    {
+        sequence->duplicates++;                           /* duplicate read */
+        *fresh = ADS1115_BOOL_FALSE;                      /* not fresh */
+    }
+    else
+    {
+        sequence->drops += n - 1;                         /* skipped conversions */
+        sequence->seq += n;                               /* advance the sequence */
+        sequence->samples++;                              /* fresh sample */
+        *fresh = ADS1115_BOOL_TRUE;                       /* fresh */
+    }
+    *seq = sequence->seq;                                 /* set sequence number */
+}
+
+/**
+ * @brief     initialize the sequence tracking
+ * @param[in] *sequence points to an ads1115 sequence structure
+ * @param[in] rate is the configured sample rate
+ * @param[in] start_us is the time continuous mode was started
+ * @return    status code
+ *            - 0 success
+ *            - 2 sequence is NULL
+ *            - 4 rate is invalid
+ * @note      the first conversion completes one period after start_us
+ */
+uint8_t ads1115_sequence_init(ads1115_sequence_t *sequence, ads1115_rate_t rate, uint64_t start_us)
+{
+    if (sequence == NULL)                                              /* check sequence */
+    {
+        return 2;                                                      /* return error */
+    }
+    if ((uint32_t)rate > (uint32_t)ADS1115_RATE_860SPS)                /* check rate */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    memset(sequence, 0, sizeof(ads1115_sequence_t));                   /* clear the sequence */
+    sequence->period_us = ads1115_rate_to_period_us(rate);             /* set nominal period */
+    sequence->edge_us = start_us;                                      /* set start time */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the conversion period
+ * @param[in] *sequence points to an ads1115 sequence structure
+ * @param[in] period_us is the conversion period
+ * @return    status code
+ *            - 0 success
+ *            - 2 sequence is NULL
+ *            - 4 period_us is 0
+ * @note      feed the clock recovery period here, the datasheet period drifts by up to 10%
+ */
+uint8_t ads1115_sequence_set_period(ads1115_sequence_t *sequence, uint32_t period_us)
+{
+    if (sequence == NULL)                    /* check sequence */
+    {
+        return 2;                            /* return error */
+    }
+    if (period_us == 0)                      /* check period */
+    {
+        return 4;                            /* return error */
+    }
+    
+    sequence->period_us = period_us;         /* set period */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief      tag a read by its timestamp
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  read_us is the time the conversion register read started
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence, seq or fresh is NULL
+ * @note       a read inside the period of the last counted conversion is a duplicate,
+ *             a read several periods later counts the skipped conversions as drops
+ */
+uint8_t ads1115_sequence_update_time(ads1115_sequence_t *sequence, uint64_t read_us,
+                                     uint32_t *seq, ads1115_bool_t *fresh)
+{
+    uint32_t n;
+    
+    if ((sequence == NULL) || (seq == NULL) || (fresh == NULL))                   /* check params */
+    {
+        return 2;                                                                 /* return error */
+    }
+    
+    n = 0;                                                                        /* no conversion yet */
+    if (read_us > sequence->edge_us)                                              /* check time */
+    {
+        n = (uint32_t)((read_us - sequence->edge_us) / sequence->period_us);      /* completed conversions */
+    }
+    sequence->edge_us += (uint64_t)n * sequence->period_us;                       /* keep the conversion phase */
+    a_ads1115_sequence_count(sequence, n, seq, fresh);                            /* count */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      tag a read by the conversion ready edge count
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  edges is the running ready edge count
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence, seq or fresh is NULL
+ * @note       exact when every edge is counted, the count may wrap
+ */
+uint8_t ads1115_sequence_update_edges(ads1115_sequence_t *sequence, uint32_t edges,
+                                      uint32_t *seq, ads1115_bool_t *fresh)
+{
+    uint32_t n;
+    
+    if ((sequence == NULL) || (seq == NULL) || (fresh == NULL))        /* check params */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    n = edges - sequence->edges;                                       /* new edges, wrap safe */
+    sequence->edges = edges;                                           /* save the count */
+    a_ads1115_sequence_count(sequence, n, seq, fresh);                 /* count */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the sequence counters
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[out] *samples points to a fresh sample counter buffer
+ * @param[out] *duplicates points to a duplicate read counter buffer
+ * @param[out] *drops points to a dropped conversion counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence is NULL
+ * @note       none
+ */
+uint8_t ads1115_sequence_get_counters(ads1115_sequence_t *sequence, uint32_t *samples,
+                                      uint32_t *duplicates, uint32_t *drops)
+{
+    if (sequence == NULL)                        /* check sequence */
+    {
+        return 2;                                /* return error */
+    }
+    
+    *samples = sequence->samples;                /* get samples */
+    *duplicates = sequence->duplicates;          /* get duplicates */
+    *drops = sequence->drops;                    /* get drops */
+    
+    return 0;                                    /* success return 0 */
+}
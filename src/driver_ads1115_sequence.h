@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_sequence.h
+ * @brief     driver ads1115 sequence header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_SEQUENCE_H
+#define DRIVER_ADS1115_SEQUENCE_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_sequence_driver ads1115 sequence driver function
+ * @brief    ads1115 sequence driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 sequence structure definition
+ */
+typedef struct ads1115_sequence_s
+{
+    uint64_t edge_us;           /**< estimated completion time of the last counted conversion */
+    uint32_t period_us;         /**< conversion period */
+    uint32_t edges;             /**< last ready edge count */
+    uint32_t seq;               /**< sequence number of the last conversion, 0 means none */
+    uint32_t samples;           /**< fresh sample counter */
+    uint32_t duplicates;        /**< duplicate read counter */
+    uint32_t drops;             /**< dropped conversion counter */
+} ads1115_sequence_t;
+
+/**
+ * @brief     initialize the sequence tracking
+ * @param[in] *sequence points to an ads1115 sequence structure
+ * @param[in] rate is the configured sample rate
+ * @param[in] start_us is the time continuous mode was started
+ * @return    status code
+ *            - 0 success
+ *            - 2 sequence is NULL
+ *            - 4 rate is invalid
+ * @note      the first conversion completes one period after start_us
+ */
+uint8_t ads1115_sequence_init(ads1115_sequence_t *sequence, ads1115_rate_t rate, uint64_t start_us);
+
+/**
+ * @brief     set the conversion period
+ * @param[in] *sequence points to an ads1115 sequence structure
+ * @param[in] period_us is the conversion period
+ * @return    status code
+ *            - 0 success
+ *            - 2 sequence is NULL
+ *            - 4 period_us is 0
+ * @note      feed the clock recovery period here, the datasheet period drifts by up to 10%
+ */
+uint8_t ads1115_sequence_set_period(ads1115_sequence_t *sequence, uint32_t period_us);
+
+/**
+ * @brief      tag a read by its timestamp
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  read_us is the time the conversion register read started
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence, seq or fresh is NULL
+ * @note       a read inside the period of the last counted conversion is a duplicate,
+ *             a read several periods later counts the skipped conversions as drops
+ */
+uint8_t ads1115_sequence_update_time(ads1115_sequence_t *sequence, uint64_t read_us,
+                                     uint32_t *seq, ads1115_bool_t *fresh);
+
+/**
+ * @brief      tag a read by the conversion ready edge count
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  edges is the running ready edge count
+ * @param[out] *seq points to a sequence number buffer
+ * @param[out] *fresh points to a fresh sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence, seq or fresh is NULL
+ * @note       exact when every edge is counted, the count may wrap
+ */
+uint8_t ads1115_sequence_update_edges(ads1115_sequence_t *sequence, uint32_t edges,
+                                      uint32_t *seq, ads1115_bool_t *fresh);
+
+/**
+ * @brief      get the sequence counters
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[out] *samples points to a fresh sample counter buffer
+ * @param[out] *duplicates points to a duplicate read counter buffer
+ * @param[out] *drops points to a dropped conversion counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sequence is NULL
+ * @note       none
+ */
+uint8_t ads1115_sequence_get_counters(ads1115_sequence_t *sequence, uint32_t *samples,
+                                      uint32_t *duplicates, uint32_t *drops);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
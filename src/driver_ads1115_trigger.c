@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_trigger.c
+ * @brief     driver ads1115 trigger source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_trigger.h"
+
+/**
+ * @brief     check the trigger condition
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] raw is the newest sample
+ * @return    1 if the sample triggers else 0
+ * @note      edge, window and slope triggers need the previous sample
+ */
+static uint8_t a_ads1115_trigger_match(ads1115_trigger_t *trigger, int16_t raw)
+{
+    const ads1115_trigger_config_t *c = &trigger->config;
+    uint8_t up;
+    uint8_t down;
+    int32_t d;
+    
+    if (c->type == ADS1115_TRIGGER_TYPE_LEVEL)                                      /* level */
+    {
+        up = (raw >= c->level) ? 1 : 0;                                              /* at or above */
+        down = (raw <= c->level) ? 1 : 0;                                            /* at or below */
+    }
+    else if (trigger->prev_valid == 0)                                               /* no previous sample */
+    {
+        return 0;                                                                    /* not matched */
+    }
+    else if (c->type == ADS1115_TRIGGER_TYPE_EDGE)                                  /* edge */
+    {
+        up = ((trigger->prev < c->level) && (raw >= c->level)) ? 1 : 0;              /* crossed upwards */
+        down = ((trigger->prev > c->level) && (raw <= c->level)) ? 1 : 0;            /* crossed downwards */
+    }
+    else if (c->type == ADS1115_TRIGGER_TYPE_WINDOW)                                /* window */
+    {
+        up = ((trigger->prev <= c->high) && (raw > c->high)) ? 1 : 0;                /* left through the high limit */
+        down = ((trigger->prev >= c->low) && (raw < c->low)) ? 1 : 0;                /* left through the low limit */
+    }
+    else                                                                             /* slope */
+    {
+        d = (int32_t)raw - (int32_t)trigger->prev;                                   /* change per sample */
+        up = (d >= (int32_t)c->slope) ? 1 : 0;                                       /* steep rise */
+        down = (-d >= (int32_t)c->slope) ? 1 : 0;                                    /* steep fall */
+    }
+    
+    if (c->edge == ADS1115_TRIGGER_EDGE_RISING)                                     /* rising */
+    {
+        return up;                                                                   /* return the rising match */
+    }
+    else if (c->edge == ADS1115_TRIGGER_EDGE_FALLING)                               /* falling */
+    {
+        return down;                                                                 /* return the falling match */
+    }
+    else
+    {
+        return (uint8_t)(up | down);                                                 /* return either match */
+    }
+}
+
+/**
+ * @brief     initialize a trigger
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] *config points to a trigger config structure
+ * @param[in] *buffer points to a ring buffer
+ * @param[in] capacity is the ring buffer length in samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 trigger, config or buffer is NULL
+ *            - 4 config is invalid or capacity is not a power of 2 above pre + post
+ * @note      use one trigger per channel, the spare capacity keeps
+ *            samples flowing while a window is being persisted
+ */
+uint8_t ads1115_trigger_init(ads1115_trigger_t *trigger, const ads1115_trigger_config_t *config,
+                             ads1115_trigger_sample_t *buffer, uint32_t capacity)
+{
+    if ((trigger == NULL) || (config == NULL) || (buffer == NULL))                  /* check the buffers */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0) ||
+        (config->pre >= capacity) || (config->post == 0) ||
+        (config->post >= capacity - config->pre))                                   /* check the capacity */
+    {
+        return 4;                                                                    /* return error */
+    }
+    if ((config->type > ADS1115_TRIGGER_TYPE_SLOPE) || (config->edge > ADS1115_TRIGGER_EDGE_BOTH) ||
+        ((config->type == ADS1115_TRIGGER_TYPE_LEVEL) && (config->edge == ADS1115_TRIGGER_EDGE_BOTH)) ||
+        ((config->type == ADS1115_TRIGGER_TYPE_WINDOW) && (config->low > config->high)) ||
+        ((config->type == ADS1115_TRIGGER_TYPE_SLOPE) && (config->slope == 0)))     /* check the config */
+    {
+        return 4;                                                                    /* return error */
+    }
+    
+    trigger->config = *config;                                                       /* save the config */
+    trigger->buffer = buffer;                                                        /* set the ring */
+    trigger->mask = capacity - 1;                                                    /* set the mask */
+    trigger->head = 0;                                                               /* init 0 */
+    trigger->run = 0;                                                                /* no history */
+    trigger->start = 0;                                                              /* init 0 */
+    trigger->end = 0;                                                                /* init 0 */
+    trigger->prev = 0;                                                               /* init 0 */
+    trigger->prev_valid = 0;                                                         /* no previous sample */
+    trigger->ended = 0;                                                              /* no window yet */
+    trigger->state = ADS1115_TRIGGER_STATE_ARMED;                                    /* arm */
+    trigger->triggers = 0;                                                           /* init 0 */
+    trigger->drops = 0;                                                              /* init 0 */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      push one sample
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  seq is the conversion sequence number
+ * @param[in]  timestamp_us is the sample time
+ * @param[out] *ready points to a window ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trigger or ready is NULL
+ * @note       a trigger needs pre samples of unbroken history, a sample that would overwrite
+ *             a window not yet released is dropped and breaks the history
+ */
+uint8_t ads1115_trigger_push(ads1115_trigger_t *trigger, int16_t raw, uint32_t seq, uint64_t timestamp_us,
+                             ads1115_bool_t *ready)
+{
+    ads1115_trigger_sample_t *sample;
+    
+    if ((trigger == NULL) || (ready == NULL))                                        /* check the buffers */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    if ((trigger->state == ADS1115_TRIGGER_STATE_READY) &&
+        (trigger->head - trigger->start > trigger->mask))                            /* the ring is full */
+    {
+        trigger->drops++;                                                            /* count */
+        trigger->run = 0;                                                            /* history is broken */
+        trigger->prev_valid = 0;                                                     /* no previous sample */
+        *ready = ADS1115_BOOL_TRUE;                                                  /* the window still waits */
+        
+        return 0;                                                                    /* success return 0 */
+    }
+    sample = &trigger->buffer[trigger->head & trigger->mask];                        /* get the slot */
+    sample->timestamp_us = timestamp_us;                                             /* set the time */
+    sample->seq = seq;                                                               /* set the sequence */
+    sample->raw = raw;                                                               /* set the raw */
+    sample->reserved = 0;                                                            /* set 0 */
+    
+    if ((trigger->state == ADS1115_TRIGGER_STATE_ARMED) && (trigger->run >= trigger->config.pre) &&
+        ((trigger->ended == 0) || (trigger->head - trigger->end >= trigger->config.holdoff)) &&
+        (a_ads1115_trigger_match(trigger, raw) != 0))                                /* check the trigger */
+    {
+        trigger->start = trigger->head - trigger->config.pre;                        /* window start */
+        trigger->end = trigger->head + trigger->config.post;                         /* window end */
+        trigger->state = ADS1115_TRIGGER_STATE_TRIGGERED;                            /* collect the post samples */
+        trigger->triggers++;                                                         /* count */
+    }
+    trigger->head++;                                                                 /* next slot */
+    if (trigger->run != 0xFFFFFFFFU)                                                 /* check the run */
+    {
+        trigger->run++;                                                              /* one more in the history */
+    }
+    trigger->prev = raw;                                                             /* save the sample */
+    trigger->prev_valid = 1;                                                         /* set valid */
+    if ((trigger->state == ADS1115_TRIGGER_STATE_TRIGGERED) && (trigger->head == trigger->end))
+    {
+        trigger->state = ADS1115_TRIGGER_STATE_READY;                                /* the window is complete */
+    }
+    *ready = (trigger->state == ADS1115_TRIGGER_STATE_READY) ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE;
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the ready window
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[out] *window points to a trigger window buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no window is ready
+ *             - 2 trigger or window is NULL
+ * @note       the slices point into the ring and stay valid until ads1115_trigger_release
+ */
+uint8_t ads1115_trigger_get_window(ads1115_trigger_t *trigger, ads1115_trigger_window_t *window)
+{
+    uint32_t index;
+    uint32_t count;
+    
+    if ((trigger == NULL) || (window == NULL))                                       /* check the buffers */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (trigger->state != ADS1115_TRIGGER_STATE_READY)                               /* check the state */
+    {
+        return 1;                                                                    /* return error */
+    }
+    
+    index = trigger->start & trigger->mask;                                          /* first slot */
+    count = trigger->end - trigger->start;                                           /* window length */
+    window->first = &trigger->buffer[index];                                         /* first slice */
+    window->first_count = trigger->mask + 1 - index;                                 /* up to the ring end */
+    if (window->first_count >= count)                                                /* no wrap */
+    {
+        window->first_count = count;                                                 /* whole window */
+        window->second = NULL;                                                       /* no wrapped slice */
+        window->second_count = 0;                                                    /* set 0 */
+    }
+    else
+    {
+        window->second = trigger->buffer;                                            /* wrapped slice */
+        window->second_count = count - window->first_count;                          /* the rest */
+    }
+    window->pre = trigger->config.pre;                                               /* trigger sample index */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     release the ready window and rearm
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 no window is ready
+ *            - 2 trigger is NULL
+ * @note      none
+ */
+uint8_t ads1115_trigger_release(ads1115_trigger_t *trigger)
+{
+    if (trigger == NULL)                                                             /* check trigger */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (trigger->state != ADS1115_TRIGGER_STATE_READY)                               /* check the state */
+    {
+        return 1;                                                                    /* return error */
+    }
+    
+    trigger->ended = 1;                                                              /* start the holdoff */
+    trigger->state = ADS1115_TRIGGER_STATE_ARMED;                                    /* rearm */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the trigger counters
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[out] *triggers points to a trigger counter buffer
+ * @param[out] *drops points to a dropped sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trigger is NULL
+ * @note       none
+ */
+uint8_t ads1115_trigger_get_counters(ads1115_trigger_t *trigger, uint32_t *triggers, uint32_t *drops)
+{
+    if (trigger == NULL)                                                             /* check trigger */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    if (triggers != NULL)                                                            /* check triggers */
+    {
+        *triggers = trigger->triggers;                                               /* get the trigger counter */
+    }
+    if (drops != NULL)                                                               /* check drops */
+    {
+        *drops = trigger->drops;                                                     /* get the drop counter */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
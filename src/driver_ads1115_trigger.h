@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_trigger.h
+ * @brief     driver ads1115 trigger header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ADS1115_TRIGGER_H
+#define DRIVER_ADS1115_TRIGGER_H
+
+#include "driver_ads1115.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ads1115_trigger_driver ads1115 trigger driver function
+ * @brief    ads1115 trigger driver modules
+ * @ingroup  ads1115_driver
+ * @{
+ */
+
+/**
+ * @brief ads1115 trigger type enumeration definition
+ */
+typedef enum
+{
+    ADS1115_TRIGGER_TYPE_LEVEL  = 0x00,        /**< a sample at or beyond the level */
+    ADS1115_TRIGGER_TYPE_EDGE   = 0x01,        /**< a sample crossing the level */
+    ADS1115_TRIGGER_TYPE_WINDOW = 0x02,        /**< a sample leaving the low to high window */
+    ADS1115_TRIGGER_TYPE_SLOPE  = 0x03,        /**< a change from the previous sample of at least the slope */
+} ads1115_trigger_type_t;
+
+/**
+ * @brief ads1115 trigger edge enumeration definition
+ */
+typedef enum
+{
+    ADS1115_TRIGGER_EDGE_RISING  = 0x00,        /**< upwards or through the high limit */
+    ADS1115_TRIGGER_EDGE_FALLING = 0x01,        /**< downwards or through the low limit */
+    ADS1115_TRIGGER_EDGE_BOTH    = 0x02,        /**< either way, not for a level trigger */
+} ads1115_trigger_edge_t;
+
+/**
+ * @brief ads1115 trigger state enumeration definition
+ */
+typedef enum
+{
+    ADS1115_TRIGGER_STATE_ARMED     = 0x00,        /**< waiting for a trigger */
+    ADS1115_TRIGGER_STATE_TRIGGERED = 0x01,        /**< collecting the post trigger samples */
+    ADS1115_TRIGGER_STATE_READY     = 0x02,        /**< a window waits to be released */
+} ads1115_trigger_state_t;
+
+/**
+ * @brief ads1115 trigger config structure definition
+ */
+typedef struct ads1115_trigger_config_s
+{
+    ads1115_trigger_type_t type;        /**< trigger type */
+    ads1115_trigger_edge_t edge;        /**< trigger direction */
+    int16_t level;                      /**< level of a level or edge trigger in raw counts */
+    int16_t low;                        /**< low limit of a window trigger in raw counts */
+    int16_t high;                       /**< high limit of a window trigger in raw counts */
+    uint16_t slope;                     /**< change per sample of a slope trigger in raw counts */
+    uint32_t pre;                       /**< samples kept before the trigger sample */
+    uint32_t post;                      /**< samples from the trigger sample on */
+    uint32_t holdoff;                   /**< samples after a window before the next trigger */
+} ads1115_trigger_config_t;
+
+/**
+ * @brief ads1115 trigger sample structure definition
+ */
+typedef struct ads1115_trigger_sample_s
+{
+    uint64_t timestamp_us;        /**< sample time */
+    uint32_t seq;                 /**< conversion sequence number */
+    int16_t raw;                  /**< raw sample */
+    uint16_t reserved;            /**< reserved */
+} ads1115_trigger_sample_t;
+
+/**
+ * @brief ads1115 trigger window structure definition
+ */
+typedef struct ads1115_trigger_window_s
+{
+    const ads1115_trigger_sample_t *first;         /**< first slice */
+    uint32_t first_count;                          /**< samples in the first slice */
+    const ads1115_trigger_sample_t *second;        /**< wrapped slice, NULL for none */
+    uint32_t second_count;                         /**< samples in the wrapped slice */
+    uint32_t pre;                                  /**< window index of the trigger sample */
+} ads1115_trigger_window_t;
+
+/**
+ * @brief ads1115 trigger structure definition
+ */
+typedef struct ads1115_trigger_s
+{
+    ads1115_trigger_config_t config;         /**< trigger config */
+    ads1115_trigger_sample_t *buffer;        /**< ring buffer */
+    uint32_t mask;                           /**< ring capacity minus 1 */
+    uint32_t head;                           /**< samples written */
+    uint32_t run;                            /**< samples written since the last drop */
+    uint32_t start;                          /**< first sample of the window */
+    uint32_t end;                            /**< one past the last sample of the window */
+    int16_t prev;                            /**< previous sample */
+    uint8_t prev_valid;                      /**< 1 if prev is the sample before the next one */
+    uint8_t ended;                           /**< 1 once a window was released */
+    ads1115_trigger_state_t state;           /**< trigger state */
+    uint32_t triggers;                       /**< trigger counter */
+    uint32_t drops;                          /**< sample drop counter */
+} ads1115_trigger_t;
+
+/**
+ * @brief     initialize a trigger
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] *config points to a trigger config structure
+ * @param[in] *buffer points to a ring buffer
+ * @param[in] capacity is the ring buffer length in samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 trigger, config or buffer is NULL
+ *            - 4 config is invalid or capacity is not a power of 2 above pre + post
+ * @note      use one trigger per channel, the spare capacity keeps
+ *            samples flowing while a window is being persisted
+ */
+uint8_t ads1115_trigger_init(ads1115_trigger_t *trigger, const ads1115_trigger_config_t *config,
+                             ads1115_trigger_sample_t *buffer, uint32_t capacity);
+
+/**
+ * @brief      push one sample
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[in]  raw is the raw sample
+ * @param[in]  seq is the conversion sequence number
+ * @param[in]  timestamp_us is the sample time
+ * @param[out] *ready points to a window ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trigger or ready is NULL
+ * @note       a trigger needs pre samples of unbroken history, a sample that would overwrite
+ *             a window not yet released is dropped and breaks the history
+ */
+uint8_t ads1115_trigger_push(ads1115_trigger_t *trigger, int16_t raw, uint32_t seq, uint64_t timestamp_us,
+                             ads1115_bool_t *ready);
+
+/**
+ * @brief      get the ready window
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[out] *window points to a trigger window buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no window is ready
+ *             - 2 trigger or window is NULL
+ * @note       the slices point into the ring and stay valid until ads1115_trigger_release
+ */
+uint8_t ads1115_trigger_get_window(ads1115_trigger_t *trigger, ads1115_trigger_window_t *window);
+
+/**
+ * @brief     release the ready window and rearm
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 no window is ready
+ *            - 2 trigger is NULL
+ * @note      none
+ */
+uint8_t ads1115_trigger_release(ads1115_trigger_t *trigger);
+
+/**
+ * @brief      get the trigger counters
+ * @param[in]  *trigger points to an ads1115 trigger structure
+ * @param[out] *triggers points to a trigger counter buffer
+ * @param[out] *drops points to a dropped sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trigger is NULL
+ * @note       none
+ */
+uint8_t ads1115_trigger_get_counters(ads1115_trigger_t *trigger, uint32_t *triggers, uint32_t *drops);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
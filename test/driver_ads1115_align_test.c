@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_align_test.c
+ * @brief     driver ads1115 align test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_align_test.h"
+#include <math.h>
+
+/**
+ * @brief align test definition
+ */
+#define ALIGN_TEST_CHANNELS  4                       /**< channels per scan */
+#define ALIGN_TEST_CONV_US   1163                    /**< 860 SPS conversion period */
+#define ALIGN_TEST_SCAN_US   (ALIGN_TEST_CHANNELS * ALIGN_TEST_CONV_US)        /**< scan period */
+#define ALIGN_TEST_START_US  1000                    /**< first conversion time */
+#define ALIGN_TEST_SCANS     120                     /**< scans per run */
+#define ALIGN_TEST_HZ        5.0                     /**< signal frequency */
+#define ALIGN_TEST_PEAK      20000.0                 /**< signal peak in counts */
+#define ALIGN_TEST_PI        3.14159265358979        /**< pi */
+
+/**
+ * @brief     synthetic sine of a channel in counts
+ * @param[in] channel is the channel
+ * @param[in] t_us is the time
+ * @return    sine in counts
+ * @note      every channel has its own phase
+ */
+static double a_align_test_sine(uint8_t channel, uint64_t t_us)
+{
+    return ALIGN_TEST_PEAK * sin(2.0 * ALIGN_TEST_PI * ALIGN_TEST_HZ * (double)t_us * 1e-6 + (double)channel * 0.7);
+}
+
+/**
+ * @brief      feed staggered scans and check every frame against the true sines
+ * @param[in]  *name points to a run name
+ * @param[in]  method is the interpolation method
+ * @param[in]  drop_mask is the mask of channels losing samples
+ * @param[in]  drop_first is the first lost scan
+ * @param[in]  drop_last is the last lost scan
+ * @param[in]  hold is the number of scans pushed without reading frames after the first ten
+ * @param[out] *skipped points to a skipped grid points buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 check failed
+ * @note       channel c of scan k is converted at k * scan + c * conversion, so the channels
+ *             are skewed by up to three conversions inside a scan
+ */
+static uint8_t a_align_test_run(const char *name, ads1115_align_method_t method, uint8_t drop_mask,
+                                uint32_t drop_first, uint32_t drop_last, uint32_t hold, uint32_t *skipped)
+{
+    uint8_t c;
+    uint32_t k;
+    uint32_t frames;
+    uint32_t before;
+    uint64_t grid_us;
+    uint64_t last_us = 0;
+    double err;
+    double err_max = 0.0;
+    double bound;
+    double wh;
+    ads1115_align_t align;
+    ads1115_align_frame_t frame;
+    
+    /* the interpolation error bound of the method on a peak sine, plus the rounding */
+    wh = 2.0 * ALIGN_TEST_PI * ALIGN_TEST_HZ * ALIGN_TEST_SCAN_US * 1e-6;
+    if (method == ADS1115_ALIGN_METHOD_CUBIC)
+    {
+        before = 2;
+        bound = ALIGN_TEST_PEAK * pow(wh, 4.0) * 9.0 / 16.0 / 24.0 + 1.0;
+    }
+    else
+    {
+        before = 1;
+        bound = ALIGN_TEST_PEAK * wh * wh / 8.0 + 1.0;
+    }
+    
+    /* the grid starts where the last channel can be interpolated */
+    grid_us = ALIGN_TEST_START_US + (uint64_t)(before - 1) * ALIGN_TEST_SCAN_US +
+              (uint64_t)(ALIGN_TEST_CHANNELS - 1) * ALIGN_TEST_CONV_US;
+    (void)ads1115_align_init(&align, ALIGN_TEST_CHANNELS, method, ALIGN_TEST_SCAN_US, 2 * ALIGN_TEST_SCAN_US);
+    for (k = 0; k < ALIGN_TEST_SCANS; k++)
+    {
+        for (c = 0; c < ALIGN_TEST_CHANNELS; c++)
+        {
+            uint64_t t_us;
+            
+            if ((((drop_mask >> c) & 0x01) != 0) && (k >= drop_first) && (k <= drop_last))
+            {
+                continue;
+            }
+            t_us = ALIGN_TEST_START_US + (uint64_t)k * ALIGN_TEST_SCAN_US + (uint64_t)c * ALIGN_TEST_CONV_US;
+            if (ads1115_align_push(&align, c, (int16_t)lround(a_align_test_sine(c, t_us)), t_us) != 0)
+            {
+                ads1115_interface_debug_print("ads1115: %s push failed.\n", name);
+                
+                return 1;
+            }
+        }
+        if ((k >= 10) && (k < 10 + hold))
+        {
+            continue;
+        }
+        while (ads1115_align_get_frame(&align, &frame) == 0)
+        {
+            /* every frame is on the grid and every value is the sine at the grid time */
+            if ((frame.timestamp_us < grid_us) || (((frame.timestamp_us - grid_us) % ALIGN_TEST_SCAN_US) != 0) ||
+                (frame.timestamp_us <= last_us))
+            {
+                ads1115_interface_debug_print("ads1115: %s grid check failed.\n", name);
+                
+                return 1;
+            }
+            for (c = 0; c < ALIGN_TEST_CHANNELS; c++)
+            {
+                err = fabs((double)frame.value[c] - a_align_test_sine(c, frame.timestamp_us));
+                err_max = (err > err_max) ? err : err_max;
+            }
+            last_us = frame.timestamp_us;
+        }
+    }
+    (void)ads1115_align_get_counters(&align, &frames, skipped);
+    ads1115_interface_debug_print("ads1115: %s error %0.2f of %0.2f counts, %d frames, %d skipped.\n",
+                                  name, err_max, bound, frames, *skipped);
+    if (err_max > bound)
+    {
+        ads1115_interface_debug_print("ads1115: %s error check failed.\n", name);
+        
+        return 1;
+    }
+    
+    /* every grid point up to the last frame is either a frame or skipped */
+    if ((last_us == 0) || (frames + *skipped != (uint32_t)((last_us - grid_us) / ALIGN_TEST_SCAN_US) + 1))
+    {
+        ads1115_interface_debug_print("ads1115: %s count check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  align test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, staggered synthetic sines must come back on a common grid
+ *         and grid points whose neighbours span a gap or left the history must be skipped
+ */
+uint8_t ads1115_align_test(void)
+{
+    uint32_t skipped;
+    uint32_t skipped_all;
+    ads1115_align_t align;
+    
+    /* start align test */
+    ads1115_interface_debug_print("ads1115: start align test.\n");
+    
+    /* both methods without losses */
+    if ((a_align_test_run("linear", ADS1115_ALIGN_METHOD_LINEAR, 0x00, 0, 0, 0, &skipped) != 0) || (skipped != 0))
+    {
+        return 1;
+    }
+    if ((a_align_test_run("cubic", ADS1115_ALIGN_METHOD_CUBIC, 0x00, 0, 0, 0, &skipped) != 0) || (skipped != 0))
+    {
+        return 1;
+    }
+    
+    /* a gap on every channel skips the grid points inside it */
+    if ((a_align_test_run("linear gap", ADS1115_ALIGN_METHOD_LINEAR, 0x0F, 30, 35, 0, &skipped_all) != 0) ||
+        (skipped_all < 6))
+    {
+        return 1;
+    }
+    if ((a_align_test_run("cubic gap", ADS1115_ALIGN_METHOD_CUBIC, 0x0F, 30, 35, 0, &skipped) != 0) ||
+        (skipped <= skipped_all))
+    {
+        return 1;
+    }
+    
+    /* a gap on one channel skips the whole frame */
+    if ((a_align_test_run("one channel gap", ADS1115_ALIGN_METHOD_CUBIC, 0x04, 50, 53, 0, &skipped) != 0) ||
+        (skipped < 4))
+    {
+        return 1;
+    }
+    
+    /* a late reader loses the points whose neighbours left the history */
+    if ((a_align_test_run("late reader", ADS1115_ALIGN_METHOD_LINEAR, 0x00, 0, 0, 3 * ADS1115_ALIGN_HISTORY, &skipped) != 0) ||
+        (skipped == 0))
+    {
+        return 1;
+    }
+    
+    /* a timestamp that does not increase is rejected */
+    (void)ads1115_align_init(&align, ALIGN_TEST_CHANNELS, ADS1115_ALIGN_METHOD_LINEAR, ALIGN_TEST_SCAN_US, 2 * ALIGN_TEST_SCAN_US);
+    (void)ads1115_align_push(&align, 0, 100, 2000);
+    if ((ads1115_align_push(&align, 0, 100, 2000) != 4) || (ads1115_align_push(&align, ALIGN_TEST_CHANNELS, 100, 3000) != 4))
+    {
+        ads1115_interface_debug_print("ads1115: push check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish align test */
+    ads1115_interface_debug_print("ads1115: finish align test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_clock_test.c
+ * @brief     driver ads1115 clock test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_clock_test.h"
+
+/**
+ * @brief clock test definition
+ */
+#define CLOCK_TEST_EDGES       200              /**< conversions per run */
+#define CLOCK_TEST_BASE_US     1000000ULL       /**< time of the first conversion */
+
+static ads1115_clock_t gs_clock;        /**< clock under test */
+static uint32_t gs_seed;                /**< jitter generator state */
+
+/**
+ * @brief     get the jitter of one edge
+ * @param[in] jitter_us is the largest jitter
+ * @return    jitter in us, uniform in -jitter_us to jitter_us
+ * @note      none
+ */
+static int32_t a_clock_test_jitter(int32_t jitter_us)
+{
+    gs_seed = gs_seed * 1103515245U + 12345U;
+    
+    return (int32_t)((gs_seed >> 8) % (uint32_t)(2 * jitter_us + 1)) - jitter_us;
+}
+
+/**
+ * @brief     get the true time of a conversion
+ * @param[in] period_us is the true conversion period
+ * @param[in] sample is the conversion index
+ * @return    time in us
+ * @note      none
+ */
+static double a_clock_test_true_us(double period_us, uint32_t sample)
+{
+    return (double)CLOCK_TEST_BASE_US + period_us * (double)sample;
+}
+
+/**
+ * @brief     feed drifted and jittered edges and check the fit
+ * @param[in] *name points to a run name
+ * @param[in] rate is the configured rate
+ * @param[in] drift is the oscillator error, 0.1 is 10% slower than the datasheet
+ * @param[in] jitter_us is the largest edge jitter
+ * @param[in] skip drops every skip-th edge, 0 keeps all
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_clock_test_run(const char *name, ads1115_rate_t rate, double drift, int32_t jitter_us, uint32_t skip)
+{
+    uint32_t i;
+    uint32_t skipped = 0;
+    uint32_t missed;
+    uint32_t rejected;
+    uint64_t ts;
+    double period;
+    double err;
+    double worst = 0.0;
+    float fit;
+    
+    if (ads1115_clock_init(&gs_clock, rate) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %s clock init failed.\n", name);
+        
+        return 1;
+    }
+    period = (double)ads1115_rate_to_period_us(rate) * (1.0 + drift);
+    gs_seed = 1;
+    
+    /* a lost edge never reaches the clock */
+    for (i = 0; i < CLOCK_TEST_EDGES; i++)
+    {
+        if ((skip != 0) && (i != 0) && ((i % skip) == 0))
+        {
+            skipped++;
+            
+            continue;
+        }
+        ts = (uint64_t)(a_clock_test_true_us(period, i) + 0.5) + (uint64_t)(int64_t)a_clock_test_jitter(jitter_us);
+        if (ads1115_clock_update(&gs_clock, ts) != 0)
+        {
+            ads1115_interface_debug_print("ads1115: %s edge %u rejected.\n", name, i);
+            
+            return 1;
+        }
+    }
+    
+    /* period within 0.2% */
+    if (ads1115_clock_get_period(&gs_clock, &fit) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %s get period failed.\n", name);
+        
+        return 1;
+    }
+    err = (double)fit - period;
+    if ((err > period * 0.002) || (err < -period * 0.002))
+    {
+        ads1115_interface_debug_print("ads1115: %s period %0.2fus check failed, true %0.2fus.\n", name, fit, period);
+        
+        return 1;
+    }
+    
+    /* every lost edge is counted */
+    (void)ads1115_clock_get_statistics(&gs_clock, &missed, &rejected);
+    if ((missed != skipped) || (rejected != 0))
+    {
+        ads1115_interface_debug_print("ads1115: %s missed %u rejected %u check failed, lost %u.\n",
+                                      name, missed, rejected, skipped);
+        
+        return 1;
+    }
+    
+    /* the fitted times of the window, its lost edges and the next conversion stay inside the jitter */
+    for (i = CLOCK_TEST_EDGES - ADS1115_CLOCK_WINDOW; i <= CLOCK_TEST_EDGES; i++)
+    {
+        if (ads1115_clock_get_sample_time(&gs_clock, i, &ts) != 0)
+        {
+            ads1115_interface_debug_print("ads1115: %s get sample time failed.\n", name);
+            
+            return 1;
+        }
+        err = (double)ts - a_clock_test_true_us(period, i);
+        if (err < 0.0)
+        {
+            err = -err;
+        }
+        if (err > worst)
+        {
+            worst = err;
+        }
+    }
+    if (worst > (double)jitter_us)
+    {
+        ads1115_interface_debug_print("ads1115: %s sample time error %0.1fus check failed.\n", name, worst);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: %s period %0.2fus of %0.2fus, %u missed, sample time error %0.1fus.\n",
+                                  name, fit, period, missed, worst);
+    
+    return 0;
+}
+
+/**
+ * @brief  clock test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, synthetic ready edges with drift, jitter and lost edges
+ *         must fit the true period and sample times
+ */
+uint8_t ads1115_clock_test(void)
+{
+    uint32_t missed;
+    uint32_t rejected;
+    
+    /* start clock test */
+    ads1115_interface_debug_print("ads1115: start clock test.\n");
+    
+    /* the oscillator at both ends of its tolerance with edge jitter */
+    if (a_clock_test_run("860sps +10%", ADS1115_RATE_860SPS, 0.10, 40, 0) != 0)
+    {
+        return 1;
+    }
+    if (a_clock_test_run("860sps -10%", ADS1115_RATE_860SPS, -0.10, 40, 0) != 0)
+    {
+        return 1;
+    }
+    if (a_clock_test_run("128sps +10%", ADS1115_RATE_128SPS, 0.10, 200, 0) != 0)
+    {
+        return 1;
+    }
+    
+    /* lost edges are counted and their times reconstructed */
+    if (a_clock_test_run("860sps -10% lost edges", ADS1115_RATE_860SPS, -0.10, 40, 7) != 0)
+    {
+        return 1;
+    }
+    if (a_clock_test_run("128sps +10% lost edges", ADS1115_RATE_128SPS, 0.10, 200, 5) != 0)
+    {
+        return 1;
+    }
+    
+    /* a repeated edge and a glitch inside one period are rejected */
+    if ((ads1115_clock_update(&gs_clock, CLOCK_TEST_BASE_US * 10) != 0) ||
+        (ads1115_clock_update(&gs_clock, CLOCK_TEST_BASE_US * 10) != 1) ||
+        (ads1115_clock_update(&gs_clock, CLOCK_TEST_BASE_US * 10 + 100) != 1))
+    {
+        ads1115_interface_debug_print("ads1115: glitch check failed.\n");
+        
+        return 1;
+    }
+    (void)ads1115_clock_get_statistics(&gs_clock, &missed, &rejected);
+    if (rejected != 2)
+    {
+        ads1115_interface_debug_print("ads1115: rejected %u check failed.\n", rejected);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: glitch edges rejected.\n");
+    
+    /* finish clock test */
+    ads1115_interface_debug_print("ads1115: finish clock test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_codec_test.c
+ * @brief     driver ads1115 codec test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_codec_test.h"
+
+/**
+ * @brief codec test definition
+ */
+#define CODEC_TEST_N 256        /**< samples per test block */
+
+static int16_t gs_raw[CODEC_TEST_N];                                /**< encoded samples */
+static int16_t gs_out[CODEC_TEST_N];                                /**< decoded samples */
+static uint8_t gs_frame[ADS1115_CODEC_FRAME_MAX(CODEC_TEST_N)];     /**< frame buffer */
+
+/**
+ * @brief     encode, decode and compare one block
+ * @param[in] *name points to a block name
+ * @param[in] n is the number of samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 round trip failed
+ * @note      none
+ */
+static uint8_t a_codec_test_round_trip(const char *name, uint32_t n)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t used;
+    uint32_t len;
+    uint32_t count;
+    
+    res = ads1115_codec_encode(gs_raw, n, gs_frame, sizeof(gs_frame), &used);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %s encode failed.\n", name);
+        
+        return 1;
+    }
+    res = ads1115_codec_decode(gs_frame, used, gs_out, CODEC_TEST_N, &count, &len);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %s decode failed.\n", name);
+        
+        return 1;
+    }
+    if ((count != n) || (len != used))
+    {
+        ads1115_interface_debug_print("ads1115: %s length check failed.\n", name);
+        
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (gs_out[i] != gs_raw[i])
+        {
+            ads1115_interface_debug_print("ads1115: %s sample %d check failed.\n", name, i);
+            
+            return 1;
+        }
+    }
+    ads1115_interface_debug_print("ads1115: %s %d samples in %d bytes, predictor %d, k %d.\n",
+                                  name, n, used, gs_frame[4], gs_frame[5]);
+    
+    return 0;
+}
+
+/**
+ * @brief  codec test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, every block must decode to the encoded samples
+ */
+uint8_t ads1115_codec_test(void)
+{
+    uint32_t i;
+    uint32_t seed;
+    
+    /* start codec test */
+    ads1115_interface_debug_print("ads1115: start codec test.\n");
+    
+    /* a flat block keeps k at 0, an isolated step of 12 needs a unary run of 24 */
+    for (i = 0; i < CODEC_TEST_N; i++)
+    {
+        gs_raw[i] = 100;
+    }
+    gs_raw[30] = 112;
+    if (a_codec_test_round_trip("single step", CODEC_TEST_N) != 0)
+    {
+        return 1;
+    }
+    if (gs_frame[5] != 0)
+    {
+        ads1115_interface_debug_print("ads1115: single step k check failed.\n");
+        
+        return 1;
+    }
+    
+    /* few isolated steps keep k at 0 with unary runs just below, at and beyond the escape length */
+    for (i = 0; i < CODEC_TEST_N; i++)
+    {
+        gs_raw[i] = 100;
+    }
+    gs_raw[40] = 111;
+    gs_raw[90] = 88;
+    gs_raw[140] = 113;
+    gs_raw[190] = 85;
+    if (a_codec_test_round_trip("isolated steps", CODEC_TEST_N) != 0)
+    {
+        return 1;
+    }
+    if (gs_frame[5] != 0)
+    {
+        ads1115_interface_debug_print("ads1115: isolated steps k check failed.\n");
+        
+        return 1;
+    }
+    
+    /* full scale step in both directions */
+    for (i = 0; i < CODEC_TEST_N; i++)
+    {
+        gs_raw[i] = (i < CODEC_TEST_N / 2) ? -32768 : 32767;
+    }
+    gs_raw[CODEC_TEST_N / 4] = 32767;
+    if (a_codec_test_round_trip("full scale step", CODEC_TEST_N) != 0)
+    {
+        return 1;
+    }
+    
+    /* a slow ramp with noise selects a larger k */
+    seed = 1;
+    for (i = 0; i < CODEC_TEST_N; i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        gs_raw[i] = (int16_t)(i * 40 - 5000 + (int32_t)((seed >> 16) & 0x3F) - 32);
+    }
+    if (a_codec_test_round_trip("noisy ramp", CODEC_TEST_N) != 0)
+    {
+        return 1;
+    }
+    
+    /* single sample */
+    gs_raw[0] = -1;
+    if (a_codec_test_round_trip("single sample", 1) != 0)
+    {
+        return 1;
+    }
+    
+    /* finish codec test */
+    ads1115_interface_debug_print("ads1115: finish codec test.\n");
+    
+    return 0;
+}
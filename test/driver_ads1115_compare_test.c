@@ -59,6 +59,7 @@ uint8_t ads1115_compare_test(ads1115_address_t addr, ads1115_channel_t channel,
     int16_t high_threshold;
     int16_t low_threshold;
     uint32_t i;
+    uint64_t next;
     ads1115_info_t info;
     
     /* link interface function */
@@ -69,6 +70,10 @@ uint8_t ads1115_compare_test(ads1115_address_t addr, ads1115_channel_t channel,
     DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
     DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
     DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
     
     /* get information */
     res = ads1115_info(&info);
@@ -212,6 +217,7 @@ uint8_t ads1115_compare_test(ads1115_address_t addr, ads1115_channel_t channel,
     
     /* start compare mode test */
     ads1115_interface_debug_print("ads1115: start compare mode test.\n");
+    next = ads1115_interface_timestamp_us();
     for (i=0; i<times; i++)
     {
         int16_t raw;
@@ -236,7 +242,8 @@ uint8_t ads1115_compare_test(ads1115_address_t addr, ads1115_channel_t channel,
         {
             ads1115_interface_debug_print("ads1115: voltage is below low threshold, please see alert pin.\n");
         }
-        ads1115_interface_delay_ms(1000);
+        next += 1000000;
+        ads1115_interface_delay_until_us(next);
     }
 
     /* finish compare mode test */
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_deadband_test.c
+ * @brief     driver ads1115 deadband test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_deadband_test.h"
+
+/**
+ * @brief deadband test step structure definition
+ */
+typedef struct deadband_test_step_s
+{
+    int16_t raw;                  /**< raw sample */
+    uint32_t ms;                  /**< sample time */
+    ads1115_bool_t publish;       /**< expected publish flag */
+} deadband_test_step_t;
+
+/**
+ * @brief deadband test steps of a threshold of 10 counts and a heartbeat of 100ms
+ */
+static const deadband_test_step_t gs_step[] =
+{
+    {100,    0,   ADS1115_BOOL_TRUE},         /* first sample */
+    {110,    1,   ADS1115_BOOL_FALSE},        /* on the upper edge */
+    {90,     2,   ADS1115_BOOL_FALSE},        /* on the lower edge */
+    {111,    3,   ADS1115_BOOL_TRUE},         /* beyond the upper edge */
+    {101,    4,   ADS1115_BOOL_FALSE},        /* the band follows the published sample */
+    {100,    5,   ADS1115_BOOL_TRUE},         /* beyond the new lower edge */
+    {105,    6,   ADS1115_BOOL_FALSE},        /* noise inside the band */
+    {95,     7,   ADS1115_BOOL_FALSE},        /* noise inside the band */
+    {103,    8,   ADS1115_BOOL_FALSE},        /* slow drift inside the band */
+    {106,    9,   ADS1115_BOOL_FALSE},        /* slow drift inside the band */
+    {109,    10,  ADS1115_BOOL_FALSE},        /* slow drift inside the band */
+    {112,    11,  ADS1115_BOOL_TRUE},         /* drift adds up against the published sample */
+    {32767,  12,  ADS1115_BOOL_TRUE},         /* full scale */
+    {-32768, 13,  ADS1115_BOOL_TRUE},         /* full scale swing */
+    {-32760, 112, ADS1115_BOOL_FALSE},        /* just before the heartbeat */
+    {-32760, 113, ADS1115_BOOL_TRUE},         /* heartbeat */
+    {-32760, 114, ADS1115_BOOL_FALSE},        /* silent again */
+};
+
+/**
+ * @brief  deadband test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, samples at, just beyond and around the band edges
+ *         must be published or suppressed as the last published sample decides
+ */
+uint8_t ads1115_deadband_test(void)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t published;
+    uint32_t suppressed;
+    ads1115_bool_t publish;
+    ads1115_deadband_t deadband;
+    
+    /* start deadband test */
+    ads1115_interface_debug_print("ads1115: start deadband test.\n");
+    
+    /* step through the band edges */
+    (void)ads1115_deadband_init(&deadband, 10, 100);
+    n = 0;
+    for (i = 0; i < sizeof(gs_step) / sizeof(gs_step[0]); i++)
+    {
+        (void)ads1115_deadband_update(&deadband, gs_step[i].raw, (uint64_t)gs_step[i].ms * 1000, &publish);
+        if (publish != gs_step[i].publish)
+        {
+            ads1115_interface_debug_print("ads1115: step %d raw %d check failed.\n", i, gs_step[i].raw);
+            
+            return 1;
+        }
+        n += (publish == ADS1115_BOOL_TRUE) ? 1 : 0;
+    }
+    (void)ads1115_deadband_get_counters(&deadband, &published, &suppressed);
+    if ((published != n) || (suppressed != i - n))
+    {
+        ads1115_interface_debug_print("ads1115: counter check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: %d steps, %d published, %d suppressed.\n", i, published, suppressed);
+    
+    /* a reset publishes the same sample again */
+    (void)ads1115_deadband_reset(&deadband);
+    (void)ads1115_deadband_update(&deadband, -32760, 115000, &publish);
+    if (publish != ADS1115_BOOL_TRUE)
+    {
+        ads1115_interface_debug_print("ads1115: reset check failed.\n");
+        
+        return 1;
+    }
+    
+    /* threshold 0 publishes every change and no repeat, no heartbeat keeps a flat input silent */
+    (void)ads1115_deadband_init(&deadband, 0, 0);
+    (void)ads1115_deadband_update(&deadband, 0, 0, &publish);
+    for (i = 1; i < 1000; i++)
+    {
+        (void)ads1115_deadband_update(&deadband, (int16_t)(i / 2), (uint64_t)i * 1000000, &publish);
+        if (publish != (((i % 2) == 0) ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE))
+        {
+            ads1115_interface_debug_print("ads1115: threshold 0 sample %d check failed.\n", i);
+            
+            return 1;
+        }
+    }
+    (void)ads1115_deadband_get_counters(&deadband, &published, &suppressed);
+    ads1115_interface_debug_print("ads1115: threshold 0 %d published, %d suppressed.\n", published, suppressed);
+    
+    /* finish deadband test */
+    ads1115_interface_debug_print("ads1115: finish deadband test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,435 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_executor_test.c
+ * @brief     driver ads1115 executor test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_executor_test.h"
+
+/**
+ * @brief executor test definition
+ */
+#define EXECUTOR_TEST_TRANSACTION_US 50        /**< simulated bus cost of one register transaction */
+#define EXECUTOR_TEST_OP_MAX         4         /**< operations per test */
+
+static const uint32_t gs_period_us[8] =                           /**< simulated conversion periods */
+{
+    125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163,
+};
+static uint64_t gs_now_us;                                        /**< simulated time */
+static uint16_t gs_config[4];                                     /**< simulated config registers */
+static uint64_t gs_ready_us[4];                                   /**< simulated conversion ready times */
+static ads1115_handle_t gs_handle[2];                             /**< ads1115 handles */
+static ads1115_op_t gs_op[EXECUTOR_TEST_OP_MAX];                  /**< operations */
+static ads1115_op_t *gs_order[EXECUTOR_TEST_OP_MAX];              /**< completion order */
+static uint64_t gs_done_us[EXECUTOR_TEST_OP_MAX];                 /**< completion times */
+static uint32_t gs_done;                                          /**< completed operations */
+
+/**
+ * @brief  simulated timestamp
+ * @return simulated time in us
+ * @note   none
+ */
+static uint64_t a_executor_test_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_executor_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_executor_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated iic read
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the data buffer length
+ * @return     status code
+ *             - 0 success
+ * @note       the conversion register holds 1000 * device + 100 * mux, os reads 1 once the conversion is ready
+ */
+static uint8_t a_executor_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t dev = (addr >> 1) & 0x03;
+    uint16_t v = 0;
+    
+    (void)len;
+    gs_now_us += EXECUTOR_TEST_TRANSACTION_US;
+    if (reg == 0)
+    {
+        v = (uint16_t)(dev * 1000 + ((gs_config[dev] >> 12) & 0x07) * 100);
+    }
+    else if (reg == 1)
+    {
+        v = (uint16_t)(gs_config[dev] & 0x7FFF);
+        if (gs_now_us >= gs_ready_us[dev])
+        {
+            v |= 0x8000;
+        }
+    }
+    else
+    {
+        /* thresholds read as 0 */
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v & 0xFF);
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated iic write
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the data buffer length
+ * @return    status code
+ *            - 0 success
+ * @note      a config write with os set starts a conversion of the configured rate
+ */
+static uint8_t a_executor_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t dev = (addr >> 1) & 0x03;
+    uint16_t v;
+    
+    (void)len;
+    gs_now_us += EXECUTOR_TEST_TRANSACTION_US;
+    v = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    if (reg == 1)
+    {
+        gs_config[dev] = (uint16_t)(v & 0x7FFF);
+        if ((v & 0x8000) != 0)
+        {
+            gs_ready_us[dev] = gs_now_us + gs_period_us[(v >> 5) & 0x07];
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms is the delay time
+ * @note      none
+ */
+static void a_executor_test_delay_ms(uint32_t ms)
+{
+    gs_now_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief     init a simulated device
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] addr is the addr pin
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_executor_test_device_init(ads1115_handle_t *handle, ads1115_address_t addr, ads1115_rate_t rate)
+{
+    DRIVER_ADS1115_LINK_INIT(handle, ads1115_handle_t);
+    DRIVER_ADS1115_LINK_IIC_INIT(handle, a_executor_test_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(handle, a_executor_test_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(handle, a_executor_test_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(handle, a_executor_test_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(handle, a_executor_test_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(handle, ads1115_interface_debug_print);
+    if (ads1115_set_addr_pin(handle, addr) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_init(handle) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_set_config_word(handle, ADS1115_CONFIG_WORD(ADS1115_CHANNEL_AIN0_GND, ADS1115_RANGE_6P144V, rate,
+                                                            ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                            ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                            ADS1115_COMPARATOR_QUEUE_NONE_CONV)) != 0)
+    {
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     record a completion
+ * @param[in] *op points to an ads1115 read operation structure
+ * @note      none
+ */
+static void a_executor_test_resume(ads1115_op_t *op)
+{
+    if (gs_done < EXECUTOR_TEST_OP_MAX)
+    {
+        gs_order[gs_done] = op;
+        gs_done_us[gs_done] = gs_now_us;
+        gs_done++;
+    }
+}
+
+/**
+ * @brief     switch a device to 8 SPS
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] *arg is not used
+ * @return    status code
+ *            - 0 success
+ *            - 1 config failed
+ * @note      none
+ */
+static uint8_t a_executor_test_config(ads1115_handle_t *handle, void *arg)
+{
+    (void)arg;
+    
+    return ads1115_set_rate(handle, ADS1115_RATE_8SPS);
+}
+
+/**
+ * @brief     run the executor until n operations completed
+ * @param[in] *executor points to an ads1115 executor structure
+ * @param[in] n is the number of operations
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      sleeping is simulated by moving the time to the next service time
+ */
+static uint8_t a_executor_test_drain(ads1115_executor_t *executor, uint32_t n)
+{
+    uint32_t i;
+    uint64_t next_us;
+    
+    for (i = 0; (i < 100000) && (gs_done < n); i++)
+    {
+        if (ads1115_executor_run(executor, &next_us) != 0)
+        {
+            return 1;
+        }
+        if (gs_done >= n)
+        {
+            break;
+        }
+        if (next_us == UINT64_MAX)
+        {
+            return 1;
+        }
+        if (next_us > gs_now_us)
+        {
+            gs_now_us = next_us;
+        }
+    }
+    
+    return (gs_done == n) ? 0 : 1;
+}
+
+/**
+ * @brief     check a completion
+ * @param[in] *name points to a check name
+ * @param[in] i is the completion index
+ * @param[in] *op points to the expected operation
+ * @param[in] raw is the expected raw result, -1 skips the check
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_executor_test_check(const char *name, uint32_t i, ads1115_op_t *op, int16_t raw)
+{
+    if ((gs_order[i] != op) || (op->status != 0) || (op->state != ADS1115_OP_STATE_IDLE))
+    {
+        ads1115_interface_debug_print("ads1115: %s completion %d check failed.\n", name, i);
+        
+        return 1;
+    }
+    if ((raw >= 0) && (op->raw != raw))
+    {
+        ads1115_interface_debug_print("ads1115: %s completion %d raw %d check failed.\n", name, i, op->raw);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  executor test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip on a simulated bus, operations must finish in due order
+ *         while every device keeps its submit order
+ */
+uint8_t ads1115_executor_test(void)
+{
+    uint64_t next_us;
+    uint64_t due_us;
+    ads1115_executor_t executor;
+    
+    /* start executor test */
+    ads1115_interface_debug_print("ads1115: start executor test.\n");
+    
+    /* a slow and a fast device share the bus */
+    gs_now_us = 0;
+    if ((a_executor_test_device_init(&gs_handle[0], ADS1115_ADDR_GND, ADS1115_RATE_8SPS) != 0) ||
+        (a_executor_test_device_init(&gs_handle[1], ADS1115_ADDR_VCC, ADS1115_RATE_860SPS) != 0))
+    {
+        ads1115_interface_debug_print("ads1115: device init failed.\n");
+        
+        return 1;
+    }
+    (void)ads1115_executor_init(&executor, a_executor_test_timestamp_us);
+    
+    /* the fast device finishes both reads before the slow read submitted first */
+    memset(gs_op, 0, sizeof(gs_op));
+    gs_done = 0;
+    (void)ads1115_executor_submit(&executor, &gs_op[0], &gs_handle[0], ADS1115_CHANNEL_AIN0_GND, a_executor_test_resume, NULL);
+    (void)ads1115_executor_submit(&executor, &gs_op[1], &gs_handle[1], ADS1115_CHANNEL_AIN1_GND, a_executor_test_resume, NULL);
+    (void)ads1115_executor_submit(&executor, &gs_op[2], &gs_handle[1], ADS1115_CHANNEL_AIN2_GND, a_executor_test_resume, NULL);
+    if (ads1115_executor_submit(&executor, &gs_op[2], &gs_handle[1], ADS1115_CHANNEL_AIN3_GND,
+                                a_executor_test_resume, NULL) != 4)
+    {
+        ads1115_interface_debug_print("ads1115: double submit check failed.\n");
+        
+        return 1;
+    }
+    if (a_executor_test_drain(&executor, 3) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: due order run failed.\n");
+        
+        return 1;
+    }
+    if ((a_executor_test_check("due order", 0, &gs_op[1], 1500) != 0) ||
+        (a_executor_test_check("due order", 1, &gs_op[2], 1600) != 0) ||
+        (a_executor_test_check("due order", 2, &gs_op[0], 400) != 0))
+    {
+        return 1;
+    }
+    if ((gs_done_us[1] - gs_done_us[0] < gs_period_us[ADS1115_RATE_860SPS]) ||
+        (gs_done_us[2] < gs_period_us[ADS1115_RATE_8SPS]))
+    {
+        ads1115_interface_debug_print("ads1115: due order overlap check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: due order finished at %dus, %dus and %dus.\n",
+                                  (uint32_t)gs_done_us[0], (uint32_t)gs_done_us[1], (uint32_t)gs_done_us[2]);
+    
+    /* a config runs between the reads of its device in submit order */
+    memset(gs_op, 0, sizeof(gs_op));
+    gs_done = 0;
+    (void)ads1115_executor_submit(&executor, &gs_op[0], &gs_handle[1], ADS1115_CHANNEL_AIN0_GND, a_executor_test_resume, NULL);
+    (void)ads1115_executor_submit_config(&executor, &gs_op[1], &gs_handle[1], a_executor_test_config, a_executor_test_resume, NULL);
+    (void)ads1115_executor_submit(&executor, &gs_op[2], &gs_handle[1], ADS1115_CHANNEL_AIN3_GND, a_executor_test_resume, NULL);
+    if (a_executor_test_drain(&executor, 3) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: config order run failed.\n");
+        
+        return 1;
+    }
+    if ((a_executor_test_check("config order", 0, &gs_op[0], 1400) != 0) ||
+        (a_executor_test_check("config order", 1, &gs_op[1], -1) != 0) ||
+        (a_executor_test_check("config order", 2, &gs_op[2], 1700) != 0))
+    {
+        return 1;
+    }
+    if (gs_done_us[2] - gs_done_us[1] < gs_period_us[ADS1115_RATE_8SPS])
+    {
+        ads1115_interface_debug_print("ads1115: config order rate check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: config order finished at %dus, %dus and %dus.\n",
+                                  (uint32_t)gs_done_us[0], (uint32_t)gs_done_us[1], (uint32_t)gs_done_us[2]);
+    
+    /* a ready edge finishes the conversion before its due time */
+    memset(gs_op, 0, sizeof(gs_op));
+    gs_done = 0;
+    if (ads1115_executor_notify(&executor, &gs_handle[0]) != 1)
+    {
+        ads1115_interface_debug_print("ads1115: idle notify check failed.\n");
+        
+        return 1;
+    }
+    (void)ads1115_executor_submit(&executor, &gs_op[0], &gs_handle[0], ADS1115_CHANNEL_AIN1_GND, a_executor_test_resume, NULL);
+    (void)ads1115_executor_run(&executor, &next_us);
+    due_us = next_us;
+    gs_now_us = gs_ready_us[0];
+    if (ads1115_executor_notify(&executor, &gs_handle[0]) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: notify check failed.\n");
+        
+        return 1;
+    }
+    if ((a_executor_test_drain(&executor, 1) != 0) ||
+        (a_executor_test_check("notify", 0, &gs_op[0], 500) != 0))
+    {
+        return 1;
+    }
+    if (gs_done_us[0] + 1000 > due_us)
+    {
+        ads1115_interface_debug_print("ads1115: notify early check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: notify finished %dus before the due time.\n",
+                                  (uint32_t)(due_us - gs_done_us[0]));
+    (void)ads1115_deinit(&gs_handle[0]);
+    (void)ads1115_deinit(&gs_handle[1]);
+    
+    /* finish executor test */
+    ads1115_interface_debug_print("ads1115: finish executor test.\n");
+    
+    return 0;
+}
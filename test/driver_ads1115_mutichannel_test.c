@@ -53,6 +53,7 @@ uint8_t ads1115_multichannel_test(ads1115_address_t addr, ads1115_channel_t chan
 {
     uint8_t res;
     uint32_t i;
+    uint64_t next;
     int16_t high_threshold;
     int16_t low_threshold;
     ads1115_info_t info;
@@ -65,6 +66,10 @@ uint8_t ads1115_multichannel_test(ads1115_address_t addr, ads1115_channel_t chan
     DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
     DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
     DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
     
     /* get information */
     res = ads1115_info(&info);
@@ -206,6 +211,7 @@ uint8_t ads1115_multichannel_test(ads1115_address_t addr, ads1115_channel_t chan
         
         return 1;
     }
+    next = ads1115_interface_timestamp_us();
     for (i=0; i<times; i++)
     {
         int16_t raw;
@@ -221,7 +227,8 @@ uint8_t ads1115_multichannel_test(ads1115_address_t addr, ads1115_channel_t chan
             return 1;
         }
         ads1115_interface_debug_print("ads1115: %0.3fV.\n", s);
-        ads1115_interface_delay_ms(1000);
+        next += 1000000;
+        ads1115_interface_delay_until_us(next);
     }
     
     /* finish multichannel test */
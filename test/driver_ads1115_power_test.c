@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_power_test.c
+ * @brief     driver ads1115 power test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_power_test.h"
+#include <math.h>
+
+/**
+ * @brief power test definition
+ */
+#define POWER_TEST_PERIOD_US 1163                    /**< 860 SPS conversion period */
+#define POWER_TEST_HZ        50.0                    /**< line frequency */
+#define POWER_TEST_V_PEAK    20000.0                 /**< voltage peak in counts */
+#define POWER_TEST_I_PEAK    10000.0                 /**< current peak in counts */
+#define POWER_TEST_V_SCALE   0.01f                   /**< volts per count */
+#define POWER_TEST_I_SCALE   0.001f                  /**< amperes per count */
+#define POWER_TEST_WINDOW    860                     /**< pairs per average, about 100 cycles */
+#define POWER_TEST_WINDOWS   3                       /**< averages per run */
+#define POWER_TEST_PI        3.14159265358979        /**< pi */
+
+/**
+ * @brief     synthetic sine in counts
+ * @param[in] peak is the peak in counts
+ * @param[in] t_us is the time
+ * @param[in] phase is the phase in rad
+ * @return    sine in counts
+ * @note      none
+ */
+static double a_power_test_sine(double peak, uint64_t t_us, double phase)
+{
+    return peak * sin(2.0 * POWER_TEST_PI * POWER_TEST_HZ * (double)t_us * 1e-6 - phase);
+}
+
+/**
+ * @brief     feed interleaved pairs for some averages and check them
+ * @param[in] *name points to a run name
+ * @param[in] phase is the current lag in rad
+ * @param[in] offset_us is a fixed offset added to every timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the voltage is converted at even and the current at odd conversion slots,
+ *            the held error is the voltage error of pairing a current with the voltage before it
+ */
+static uint8_t a_power_test_run(const char *name, double phase, uint64_t offset_us)
+{
+    uint32_t k;
+    uint32_t windows = 0;
+    uint64_t t_us;
+    uint64_t first_us = 0;
+    uint64_t last_us = 0;
+    double v_err;
+    double hold_err;
+    double v_max = 0.0;
+    double hold_max = 0.0;
+    double energy = 0.0;
+    double p_true;
+    double s_true;
+    double e_true;
+    ads1115_bool_t valid;
+    ads1115_power_t power;
+    ads1115_power_sample_t sample;
+    ads1115_power_average_t average;
+    
+    p_true = POWER_TEST_V_PEAK * POWER_TEST_V_SCALE * POWER_TEST_I_PEAK * POWER_TEST_I_SCALE / 2.0 * cos(phase);
+    s_true = POWER_TEST_V_PEAK * POWER_TEST_V_SCALE * POWER_TEST_I_PEAK * POWER_TEST_I_SCALE / 2.0;
+    (void)ads1115_power_init(&power, POWER_TEST_V_SCALE, POWER_TEST_I_SCALE, POWER_TEST_WINDOW, 3 * POWER_TEST_PERIOD_US);
+    for (k = 0; windows < POWER_TEST_WINDOWS; k++)
+    {
+        t_us = (uint64_t)k * POWER_TEST_PERIOD_US;
+        if ((k % 2) != 0)
+        {
+            (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_CURRENT,
+                                       (int16_t)lround(a_power_test_sine(POWER_TEST_I_PEAK, t_us, phase)),
+                                       t_us + offset_us, &sample, &valid);
+            
+            continue;
+        }
+        (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_VOLTAGE,
+                                   (int16_t)lround(a_power_test_sine(POWER_TEST_V_PEAK, t_us, 0.0)),
+                                   t_us + offset_us, &sample, &valid);
+        if (valid == ADS1115_BOOL_TRUE)
+        {
+            /* the interpolated voltage against the true one */
+            v_err = fabs((double)sample.v - a_power_test_sine(POWER_TEST_V_PEAK, sample.timestamp_us - offset_us, 0.0) *
+                         POWER_TEST_V_SCALE);
+            hold_err = fabs(a_power_test_sine(POWER_TEST_V_PEAK, sample.timestamp_us - offset_us, 0.0) -
+                            a_power_test_sine(POWER_TEST_V_PEAK, sample.timestamp_us - offset_us - POWER_TEST_PERIOD_US, 0.0)) *
+                       POWER_TEST_V_SCALE;
+            v_max = (v_err > v_max) ? v_err : v_max;
+            hold_max = (hold_err > hold_max) ? hold_err : hold_max;
+            if (first_us == 0)
+            {
+                first_us = sample.timestamp_us;
+            }
+            last_us = sample.timestamp_us;
+        }
+        if (ads1115_power_get_average(&power, &average) != 0)
+        {
+            continue;
+        }
+        
+        /* every average has the true power */
+        windows++;
+        energy += average.energy;
+        if ((average.pairs != POWER_TEST_WINDOW) || (fabs(average.p - p_true) > 0.005 * s_true) ||
+            (fabs(average.s - s_true) > 0.005 * s_true) || (fabs(average.pf - cos(phase)) > 0.005))
+        {
+            ads1115_interface_debug_print("ads1115: %s average %d check failed.\n", name, windows);
+            
+            return 1;
+        }
+    }
+    e_true = p_true * (double)(last_us - first_us) * 1e-6;
+    ads1115_interface_debug_print("ads1115: %s v error %0.3fV against %0.3fV held, p %0.2fW of %0.2fW, "
+                                  "pf %0.4f, energy %0.3fJ of %0.3fJ.\n",
+                                  name, v_max, hold_max, average.p, p_true, average.pf, energy, e_true);
+    
+    /* the chord error of the interpolation stays far below the skew of the held voltage */
+    if ((v_max > POWER_TEST_V_PEAK * POWER_TEST_V_SCALE *
+                 (1.0 - cos(POWER_TEST_PI * POWER_TEST_HZ * 2.0 * POWER_TEST_PERIOD_US * 1e-6)) + 0.02) ||
+        (v_max > hold_max / 4.0))
+    {
+        ads1115_interface_debug_print("ads1115: %s interpolation check failed.\n", name);
+        
+        return 1;
+    }
+    if (fabs(energy - e_true) > 0.005 * s_true * (double)(last_us - first_us) * 1e-6)
+    {
+        ads1115_interface_debug_print("ads1115: %s energy check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  power test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, interleaved synthetic voltage and current sines must give
+ *         the skew free voltage, the true real power and the true energy
+ */
+uint8_t ads1115_power_test(void)
+{
+    uint32_t pairs;
+    uint32_t skipped;
+    ads1115_bool_t valid;
+    ads1115_power_t power;
+    ads1115_power_sample_t sample;
+    
+    /* start power test */
+    ads1115_interface_debug_print("ads1115: start power test.\n");
+    
+    /* resistive, lagging and leading loads */
+    if (a_power_test_run("in phase", 0.0, 0) != 0)
+    {
+        return 1;
+    }
+    if (a_power_test_run("lag 60", POWER_TEST_PI / 3.0, 0) != 0)
+    {
+        return 1;
+    }
+    if (a_power_test_run("lead 30", -POWER_TEST_PI / 6.0, 0) != 0)
+    {
+        return 1;
+    }
+    
+    /* a fixed timestamp offset cancels */
+    if (a_power_test_run("offset", POWER_TEST_PI / 3.0, 500) != 0)
+    {
+        return 1;
+    }
+    
+    /* a current without voltage neighbours is skipped */
+    (void)ads1115_power_init(&power, POWER_TEST_V_SCALE, POWER_TEST_I_SCALE, POWER_TEST_WINDOW, 3 * POWER_TEST_PERIOD_US);
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_CURRENT, 100, 0, &sample, &valid);
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_VOLTAGE, 100, 1163, &sample, &valid);
+    if (valid != ADS1115_BOOL_FALSE)
+    {
+        ads1115_interface_debug_print("ads1115: no neighbour check failed.\n");
+        
+        return 1;
+    }
+    
+    /* two currents in a row lose the older one */
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_CURRENT, 100, 2326, &sample, &valid);
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_CURRENT, 200, 3489, &sample, &valid);
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_VOLTAGE, 300, 4652, &sample, &valid);
+    if ((valid != ADS1115_BOOL_TRUE) || (sample.timestamp_us != 3489) ||
+        (fabsf(sample.i - 0.2f) > 1e-6f) || (fabsf(sample.v - (100.0f + 200.0f * 2326.0f / 3489.0f) * POWER_TEST_V_SCALE) > 0.001f))
+    {
+        ads1115_interface_debug_print("ads1115: double current check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a voltage gap beyond max_gap_us is not interpolated */
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_CURRENT, 100, 5815, &sample, &valid);
+    (void)ads1115_power_update(&power, ADS1115_POWER_INPUT_VOLTAGE, 300, 4652 + 4 * POWER_TEST_PERIOD_US, &sample, &valid);
+    (void)ads1115_power_get_counters(&power, &pairs, &skipped);
+    if ((valid != ADS1115_BOOL_FALSE) || (pairs != 1) || (skipped != 3))
+    {
+        ads1115_interface_debug_print("ads1115: gap check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: %d pair, %d skipped currents.\n", pairs, skipped);
+    
+    /* finish power test */
+    ads1115_interface_debug_print("ads1115: finish power test.\n");
+    
+    return 0;
+}
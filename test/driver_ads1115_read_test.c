@@ -51,6 +51,7 @@ static ads1115_handle_t gs_handle;        /**< ads1115 handle */
 uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
 {
     uint8_t res, i;
+    uint64_t next;
     int16_t high_threshold;
     int16_t low_threshold;
     ads1115_info_t info;
@@ -63,6 +64,10 @@ uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
     DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
     DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
     DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
     
     /* get information */
     res = ads1115_info(&info);
@@ -223,6 +228,7 @@ uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
     
     /* delay 100 ms */
     ads1115_interface_delay_ms(100);
+    next = ads1115_interface_timestamp_us();
     for (i=0; i<times; i++)
     {
         int16_t raw;
@@ -238,7 +244,32 @@ uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
             return 1;
         }
         ads1115_interface_debug_print("ads1115: %d continues mode %0.3fV.\n", i+1, s);
-        ads1115_interface_delay_ms(1000);
+        next += 1000000;
+        ads1115_interface_delay_until_us(next);
+    }
+    
+    /* block read */
+    ads1115_interface_debug_print("ads1115: block read test.\n");
+    {
+        int16_t raw_n[8];
+        float s_n[8];
+        uint64_t ts_n[8];
+        ads1115_bool_t fresh_n[8];
+        
+        res = ads1115_read_n(&gs_handle, (int16_t *)raw_n, (float *)s_n, (uint64_t *)ts_n, (ads1115_bool_t *)fresh_n, 8);
+        if (res != 0)
+        {
+            ads1115_interface_debug_print("ads1115: read n failed.\n");
+            (void)ads1115_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 8; i++)
+        {
+            ads1115_interface_debug_print("ads1115: %d block read %0.3fV at %d us%s.\n", i + 1, s_n[i],
+                                          (int)(ts_n[i] - ts_n[0]),
+                                          (fresh_n[i] == ADS1115_BOOL_TRUE) ? "" : " duplicate");
+        }
     }
     
     /* stop continuous read */
@@ -253,6 +284,7 @@ uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
     
     /* start single read */
     ads1115_interface_debug_print("ads1115: single read test.\n");
+    next = ads1115_interface_timestamp_us();
     for (i=0; i<times; i++)
     {
         int16_t raw;
@@ -268,7 +300,8 @@ uint8_t ads1115_read_test(ads1115_address_t addr, uint32_t times)
             return 1;
         }
         ads1115_interface_debug_print("ads1115: %d single mode %0.3fV.\n", i+1, s);
-        ads1115_interface_delay_ms(1000);
+        next += 1000000;
+        ads1115_interface_delay_until_us(next);
     }
     
     /* finish read test */
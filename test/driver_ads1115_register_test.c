@@ -56,6 +56,12 @@ uint8_t ads1115_register_test(ads1115_address_t addr)
     int16_t high_threshold_before;
     int16_t low_threshold_before;
     int16_t reg;
+    uint32_t period;
+    uint32_t period_check;
+    uint32_t wait_us;
+    uint16_t conf;
+    uint16_t conf_check;
+    uint16_t conf_before;
     float f_reg;
     float f_reg_check;
     ads1115_info_t info;
@@ -76,6 +82,10 @@ uint8_t ads1115_register_test(ads1115_address_t addr)
     DRIVER_ADS1115_LINK_IIC_WRITE(&gs_handle, ads1115_interface_iic_write);
     DRIVER_ADS1115_LINK_DELAY_MS(&gs_handle, ads1115_interface_delay_ms);
     DRIVER_ADS1115_LINK_DEBUG_PRINT(&gs_handle, ads1115_interface_debug_print);
+    DRIVER_ADS1115_LINK_TIMESTAMP_US(&gs_handle, ads1115_interface_timestamp_us);
+    DRIVER_ADS1115_LINK_DELAY_UNTIL_US(&gs_handle, ads1115_interface_delay_until_us);
+    DRIVER_ADS1115_LINK_LOCK(&gs_handle, ads1115_interface_lock);
+    DRIVER_ADS1115_LINK_UNLOCK(&gs_handle, ads1115_interface_unlock);
     
     /* get information */
     res = ads1115_info(&info);
@@ -880,6 +890,168 @@ uint8_t ads1115_register_test(ads1115_address_t addr)
     }
     ads1115_interface_debug_print("ads1115: check compare %s.\n", enable == ADS1115_BOOL_FALSE ? "ok" : "error");
     
+    /* ads1115_set_conversion_ready_pin/ads1115_get_conversion_ready_pin test */
+    ads1115_interface_debug_print("ads1115: ads1115_set_conversion_ready_pin/ads1115_get_conversion_ready_pin test.\n");
+    
+    /* enable conversion ready pin */
+    res = ads1115_set_conversion_ready_pin(&gs_handle, ADS1115_BOOL_TRUE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set conversion ready pin failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: enable conversion ready pin.\n");
+    res = ads1115_get_conversion_ready_pin(&gs_handle, (ads1115_bool_t *)&enable);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get conversion ready pin failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check conversion ready pin %s.\n", enable == ADS1115_BOOL_TRUE ? "ok" : "error");
+    
+    /* disable conversion ready pin */
+    res = ads1115_set_conversion_ready_pin(&gs_handle, ADS1115_BOOL_FALSE);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set conversion ready pin failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: disable conversion ready pin.\n");
+    res = ads1115_get_conversion_ready_pin(&gs_handle, (ads1115_bool_t *)&enable);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get conversion ready pin failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check conversion ready pin %s.\n", enable == ADS1115_BOOL_FALSE ? "ok" : "error");
+    
+    /* ads1115_set_conversion_period/ads1115_get_conversion_period test */
+    ads1115_interface_debug_print("ads1115: ads1115_set_conversion_period/ads1115_get_conversion_period test.\n");
+    period = 3600 + rand() % 800;
+    res = ads1115_set_conversion_period(&gs_handle, ADS1115_RATE_250SPS, period);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set conversion period failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: set conversion period %dus.\n", period);
+    res = ads1115_get_conversion_period(&gs_handle, ADS1115_RATE_250SPS, (uint32_t *)&period_check);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get conversion period failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check conversion period %s.\n",
+                                  ((period_check + 1 >= period) && (period_check <= period + 1)) ? "ok" : "error");
+    
+    /* the measured oscillator follows a rate change */
+    res = ads1115_get_conversion_period(&gs_handle, ADS1115_RATE_8SPS, (uint32_t *)&period_check);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get conversion period failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    period = (uint32_t)((uint64_t)period * 125000 / 4000);
+    ads1115_interface_debug_print("ads1115: check conversion period rescale %s.\n",
+                                  ((period_check + 32 >= period) && (period_check <= period + 32)) ? "ok" : "error");
+    
+    /* restore the datasheet period */
+    res = ads1115_set_conversion_period(&gs_handle, ADS1115_RATE_250SPS, 0);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set conversion period failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ads1115_set_config_word/ads1115_get_config_word test */
+    ads1115_interface_debug_print("ads1115: ads1115_set_config_word/ads1115_get_config_word test.\n");
+    res = ads1115_get_config_word(&gs_handle, (uint16_t *)&conf_before);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    conf = ADS1115_CONFIG_WORD(rand() % 8, rand() % 6, rand() % 8, ADS1115_BOOL_TRUE,
+                               rand() % 2, rand() % 2, rand() % 2, rand() % 4);
+    res = ads1115_set_config_word(&gs_handle, conf);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: set config word 0x%04X.\n", conf);
+    res = ads1115_get_config_word(&gs_handle, (uint16_t *)&conf_check);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check config word %s.\n", conf_check == conf ? "ok" : "error");
+    res = ads1115_get_shadow_config(&gs_handle, (uint16_t *)&conf_check);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get shadow config failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check shadow config %s.\n", conf_check == conf ? "ok" : "error");
+    
+    /* ads1115_start_single_read_word test */
+    ads1115_interface_debug_print("ads1115: ads1115_start_single_read_word test.\n");
+    conf = ADS1115_CONFIG_WORD(rand() % 8, rand() % 6, rand() % 8, ADS1115_BOOL_FALSE,
+                               rand() % 2, rand() % 2, rand() % 2, rand() % 4);
+    res = ads1115_start_single_read_word(&gs_handle, conf, (uint32_t *)&wait_us);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: start single read word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_delay_ms(wait_us / 1000 + 1);
+    res = ads1115_get_config_word(&gs_handle, (uint16_t *)&conf_check);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: get config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: check start single read word %s.\n", conf_check == (conf | (1 << 8)) ? "ok" : "error");
+    
+    /* restore the config */
+    res = ads1115_set_config_word(&gs_handle, conf_before);
+    if (res != 0)
+    {
+        ads1115_interface_debug_print("ads1115: set config word failed.\n");
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* ads1115_convert_to_register test */
     ads1115_interface_debug_print("ads1115: ads1115_convert_to_register test.\n");
     
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_rms_test.c
+ * @brief     driver ads1115 rms test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_rms_test.h"
+#include <math.h>
+
+/**
+ * @brief rms test definition
+ */
+#define RMS_TEST_PERIOD_US 1163.0f                /**< 860 SPS conversion period */
+#define RMS_TEST_PI        3.14159265358979f        /**< pi */
+
+/**
+ * @brief     feed a sine and check the last window
+ * @param[in] *name points to a run name
+ * @param[in] amplitude is the peak amplitude in raw counts
+ * @param[in] offset is the dc offset in raw counts
+ * @param[in] hz is the sine frequency
+ * @param[in] noise is the peak noise in raw counts
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      10 cycles per window, the first window only settles the crossing level
+ */
+static uint8_t a_rms_test_sine(const char *name, float amplitude, float offset, float hz, int32_t noise)
+{
+    uint32_t seq;
+    uint32_t seed = 1;
+    uint32_t windows = 0;
+    int32_t raw;
+    float ac_rms;
+    float rms_true;
+    float mean_err;
+    float rms_err;
+    float ac_err;
+    float hz_err;
+    ads1115_bool_t ready;
+    ads1115_rms_t rms;
+    ads1115_rms_result_t result;
+    
+    (void)ads1115_rms_init(&rms, 10, 200, 20000);
+    (void)ads1115_rms_set_period(&rms, RMS_TEST_PERIOD_US);
+    for (seq = 0; windows < 4; seq++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        raw = (int32_t)lroundf(offset + amplitude * sinf(2.0f * RMS_TEST_PI * hz * RMS_TEST_PERIOD_US * 1e-6f * (float)seq));
+        if (noise != 0)
+        {
+            raw += (int32_t)((seed >> 16) % (uint32_t)(2 * noise + 1)) - noise;
+        }
+        (void)ads1115_rms_update(&rms, (int16_t)raw, seq, &ready);
+        if (ready == ADS1115_BOOL_TRUE)
+        {
+            windows++;
+        }
+        if (seq > 100000)
+        {
+            ads1115_interface_debug_print("ads1115: %s no window closed.\n", name);
+            
+            return 1;
+        }
+    }
+    (void)ads1115_rms_get_result(&rms, &result);
+    ac_rms = amplitude / sqrtf(2.0f);
+    rms_true = sqrtf(offset * offset + ac_rms * ac_rms);
+    mean_err = fabsf(result.mean - offset);
+    rms_err = fabsf(result.rms - rms_true) / rms_true;
+    ac_err = fabsf(result.ac_rms - ac_rms) / ac_rms;
+    hz_err = fabsf(result.frequency_hz - hz) / hz;
+    ads1115_interface_debug_print("ads1115: %s mean %0.2f rms %0.2f ac rms %0.2f %0.4fHz crest %0.3f in %d samples.\n",
+                                  name, result.mean, result.rms, result.ac_rms, result.frequency_hz,
+                                  result.crest, result.samples);
+    if ((result.cycles != 10) || (mean_err > 0.002f * amplitude) || (rms_err > 0.002f) ||
+        (ac_err > 0.002f) || (hz_err > 0.0005f))
+    {
+        ads1115_interface_debug_print("ads1115: %s accuracy check failed.\n", name);
+        
+        return 1;
+    }
+    if (fabsf(result.crest - (fabsf(offset) + amplitude) / rms_true) > 0.01f + (float)noise / rms_true)
+    {
+        ads1115_interface_debug_print("ads1115: %s crest check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  rms test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, synthetic sines with an offset and noise must give
+ *         the true mean, rms and frequency
+ */
+uint8_t ads1115_rms_test(void)
+{
+    uint32_t seq;
+    uint32_t windows;
+    uint32_t resyncs;
+    ads1115_bool_t ready;
+    ads1115_rms_t rms;
+    ads1115_rms_result_t result;
+    
+    /* start rms test */
+    ads1115_interface_debug_print("ads1115: start rms test.\n");
+    
+    /* mains frequencies, 17.2 and 14.3 samples per cycle */
+    if (a_rms_test_sine("50Hz", 10000.0f, 2000.0f, 50.0f, 0) != 0)
+    {
+        return 1;
+    }
+    if (a_rms_test_sine("60Hz", 10000.0f, -3000.0f, 60.0f, 0) != 0)
+    {
+        return 1;
+    }
+    
+    /* noise inside the hysteresis must not add crossings */
+    if (a_rms_test_sine("50Hz noisy", 10000.0f, 2000.0f, 50.0f, 150) != 0)
+    {
+        return 1;
+    }
+    
+    /* a slow sine with many samples per cycle */
+    if (a_rms_test_sine("7.3Hz", 20000.0f, 0.0f, 7.3f, 20) != 0)
+    {
+        return 1;
+    }
+    
+    /* a dc input closes unlocked windows with its mean */
+    (void)ads1115_rms_init(&rms, 10, 200, 1000);
+    for (seq = 0; seq < 1000; seq++)
+    {
+        (void)ads1115_rms_update(&rms, -1234, seq, &ready);
+    }
+    (void)ads1115_rms_get_result(&rms, &result);
+    if ((ready != ADS1115_BOOL_TRUE) || (result.cycles != 0) || (result.samples != 1000) ||
+        (fabsf(result.mean + 1234.0f) > 0.01f) || (fabsf(result.rms - 1234.0f) > 0.01f) ||
+        (result.ac_rms > 0.01f) || (result.frequency_hz != 0.0f))
+    {
+        ads1115_interface_debug_print("ads1115: dc check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: dc mean %0.2f rms %0.2f unlocked.\n", result.mean, result.rms);
+    
+    /* a sequence gap drops the window and relocks */
+    (void)ads1115_rms_update(&rms, -1234, 1500, &ready);
+    (void)ads1115_rms_get_counters(&rms, &windows, &resyncs);
+    if ((windows != 1) || (resyncs != 1))
+    {
+        ads1115_interface_debug_print("ads1115: resync check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish rms test */
+    ads1115_interface_debug_print("ads1115: finish rms test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_scheduler_test.c
+ * @brief     driver ads1115 scheduler test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_scheduler_test.h"
+
+/**
+ * @brief scheduler test definition
+ */
+#define SCHEDULER_TEST_TRANSACTION_US 50        /**< simulated bus cost of one register transaction */
+#define SCHEDULER_TEST_RUN_US        200000    /**< simulated run time */
+
+static const uint32_t gs_period_us[8] =                           /**< simulated conversion periods */
+{
+    125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163,
+};
+static uint64_t gs_now_us;                                        /**< simulated time */
+static uint16_t gs_config[4];                                     /**< simulated config registers */
+static uint64_t gs_ready_us[4];                                   /**< simulated conversion ready times */
+static ads1115_handle_t gs_handle;                                /**< ads1115 handle */
+static ads1115_scheduler_task_t gs_task[2];                       /**< fast and urgent tasks */
+static ads1115_scheduler_task_t *gs_first;                        /**< first completed task */
+
+/**
+ * @brief  simulated timestamp
+ * @return simulated time in us
+ * @note   none
+ */
+static uint64_t a_scheduler_test_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_scheduler_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_scheduler_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated iic read
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the data buffer length
+ * @return     status code
+ *             - 0 success
+ * @note       the conversion register holds 1000 * device + 100 * mux, os reads 1 once the conversion is ready
+ */
+static uint8_t a_scheduler_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t dev = (addr >> 1) & 0x03;
+    uint16_t v = 0;
+    
+    (void)len;
+    gs_now_us += SCHEDULER_TEST_TRANSACTION_US;
+    if (reg == 0)
+    {
+        v = (uint16_t)(dev * 1000 + ((gs_config[dev] >> 12) & 0x07) * 100);
+    }
+    else if (reg == 1)
+    {
+        v = (uint16_t)(gs_config[dev] & 0x7FFF);
+        if (gs_now_us >= gs_ready_us[dev])
+        {
+            v |= 0x8000;
+        }
+    }
+    else
+    {
+        /* thresholds read as 0 */
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v & 0xFF);
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated iic write
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the data buffer length
+ * @return    status code
+ *            - 0 success
+ * @note      a config write with os set starts a conversion of the configured rate
+ */
+static uint8_t a_scheduler_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t dev = (addr >> 1) & 0x03;
+    uint16_t v;
+    
+    (void)len;
+    gs_now_us += SCHEDULER_TEST_TRANSACTION_US;
+    v = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    if (reg == 1)
+    {
+        gs_config[dev] = (uint16_t)(v & 0x7FFF);
+        if ((v & 0x8000) != 0)
+        {
+            gs_ready_us[dev] = gs_now_us + gs_period_us[(v >> 5) & 0x07];
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms is the delay time
+ * @note      none
+ */
+static void a_scheduler_test_delay_ms(uint32_t ms)
+{
+    gs_now_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief     init a simulated device
+ * @param[in] *handle points to an ads1115 handle structure
+ * @param[in] addr is the addr pin
+ * @param[in] rate is the sample rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_scheduler_test_device_init(ads1115_handle_t *handle, ads1115_address_t addr, ads1115_rate_t rate)
+{
+    DRIVER_ADS1115_LINK_INIT(handle, ads1115_handle_t);
+    DRIVER_ADS1115_LINK_IIC_INIT(handle, a_scheduler_test_iic_init);
+    DRIVER_ADS1115_LINK_IIC_DEINIT(handle, a_scheduler_test_iic_deinit);
+    DRIVER_ADS1115_LINK_IIC_READ(handle, a_scheduler_test_iic_read);
+    DRIVER_ADS1115_LINK_IIC_WRITE(handle, a_scheduler_test_iic_write);
+    DRIVER_ADS1115_LINK_DELAY_MS(handle, a_scheduler_test_delay_ms);
+    DRIVER_ADS1115_LINK_DEBUG_PRINT(handle, ads1115_interface_debug_print);
+    if (ads1115_set_addr_pin(handle, addr) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_init(handle) != 0)
+    {
+        return 1;
+    }
+    if (ads1115_set_config_word(handle, ADS1115_CONFIG_WORD(ADS1115_CHANNEL_AIN0_GND, ADS1115_RANGE_6P144V, rate,
+                                                            ADS1115_BOOL_TRUE, ADS1115_COMPARE_THRESHOLD,
+                                                            ADS1115_PIN_LOW, ADS1115_BOOL_FALSE,
+                                                            ADS1115_COMPARATOR_QUEUE_NONE_CONV)) != 0)
+    {
+        (void)ads1115_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     record the first completion
+ * @param[in] *task points to an ads1115 scheduler task structure
+ * @note      none
+ */
+static void a_scheduler_test_callback(ads1115_scheduler_task_t *task)
+{
+    if (gs_first == NULL)
+    {
+        gs_first = task;
+    }
+}
+
+/**
+ * @brief      run a task set under one policy
+ * @param[in]  *name points to a policy name
+ * @param[in]  policy is the scheduling policy
+ * @param[out] *misses points to a total miss buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the 10ms task has the shorter period, the 20ms task the earlier 2.5ms deadline,
+ *             both release together every 20ms on one 860 SPS device
+ */
+static uint8_t a_scheduler_test_run(const char *name, ads1115_scheduler_policy_t policy, uint32_t *misses)
+{
+    uint32_t i;
+    uint64_t end_us;
+    uint64_t next_us;
+    float bus_load;
+    ads1115_scheduler_t scheduler;
+    
+    gs_now_us = 0;
+    gs_first = NULL;
+    if (a_scheduler_test_device_init(&gs_handle, ADS1115_ADDR_GND, ADS1115_RATE_860SPS) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: %s device init failed.\n", name);
+        
+        return 1;
+    }
+    (void)ads1115_scheduler_init(&scheduler, policy, SCHEDULER_TEST_TRANSACTION_US, a_scheduler_test_timestamp_us);
+    memset(gs_task, 0, sizeof(gs_task));
+    if ((ads1115_scheduler_add_task(&scheduler, &gs_task[0], &gs_handle, ADS1115_CHANNEL_AIN0_GND,
+                                    10000, 0, a_scheduler_test_callback, NULL) != 0) ||
+        (ads1115_scheduler_add_task(&scheduler, &gs_task[1], &gs_handle, ADS1115_CHANNEL_AIN1_GND,
+                                    20000, 2500, a_scheduler_test_callback, NULL) != 0))
+    {
+        ads1115_interface_debug_print("ads1115: %s add task failed.\n", name);
+        (void)ads1115_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)ads1115_scheduler_start(&scheduler);
+    end_us = gs_now_us + SCHEDULER_TEST_RUN_US;
+    for (i = 0; (i < 100000) && (gs_now_us < end_us); i++)
+    {
+        (void)ads1115_scheduler_run(&scheduler, &next_us);
+        if (next_us == UINT64_MAX)
+        {
+            break;
+        }
+        if (next_us > gs_now_us)
+        {
+            gs_now_us = next_us;
+        }
+    }
+    (void)ads1115_scheduler_get_statistics(&scheduler, misses, &bus_load);
+    (void)ads1115_deinit(&gs_handle);
+    ads1115_interface_debug_print("ads1115: %s 10ms task %d jobs %d misses %dus worst, "
+                                  "20ms task %d jobs %d misses %dus worst, bus %0.1f%%.\n",
+                                  name, gs_task[0].jobs, gs_task[0].misses, gs_task[0].max_latency_us,
+                                  gs_task[1].jobs, gs_task[1].misses, gs_task[1].max_latency_us, bus_load * 100.0f);
+    if ((gs_task[0].jobs < SCHEDULER_TEST_RUN_US / 10000) || (gs_task[1].jobs < SCHEDULER_TEST_RUN_US / 20000) ||
+        (gs_task[0].raw != 400) || (gs_task[1].raw != 500))
+    {
+        ads1115_interface_debug_print("ads1115: %s job check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  scheduler test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip on a simulated bus, edf must start the earlier deadline
+ *         and meet a constrained deadline that rm misses
+ */
+uint8_t ads1115_scheduler_test(void)
+{
+    uint32_t misses;
+    
+    /* start scheduler test */
+    ads1115_interface_debug_print("ads1115: start scheduler test.\n");
+    
+    /* edf starts the urgent task first and meets every deadline */
+    if (a_scheduler_test_run("edf", ADS1115_SCHEDULER_POLICY_EDF, &misses) != 0)
+    {
+        return 1;
+    }
+    if ((gs_first != &gs_task[1]) || (misses != 0))
+    {
+        ads1115_interface_debug_print("ads1115: edf deadline order check failed.\n");
+        
+        return 1;
+    }
+    
+    /* rm starts the shorter period first, so the urgent task misses every job */
+    if (a_scheduler_test_run("rm", ADS1115_SCHEDULER_POLICY_RM, &misses) != 0)
+    {
+        return 1;
+    }
+    if ((gs_first != &gs_task[0]) || (gs_task[0].misses != 0) || (gs_task[1].misses == 0))
+    {
+        ads1115_interface_debug_print("ads1115: rm priority order check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish scheduler test */
+    ads1115_interface_debug_print("ads1115: finish scheduler test.\n");
+    
+    return 0;
+}
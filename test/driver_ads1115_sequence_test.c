@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_sequence_test.c
+ * @brief     driver ads1115 sequence test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_sequence_test.h"
+
+/**
+ * @brief sequence test definition
+ */
+#define SEQUENCE_TEST_N 1000        /**< conversions per run */
+
+/**
+ * @brief      read conversions by time with a skip and repeat pattern
+ * @param[in]  *name points to a run name
+ * @param[in]  *sequence points to an ads1115 sequence structure
+ * @param[in]  true_us is the true conversion period
+ * @param[in]  check is 1 to check every sequence number
+ * @param[out] *samples points to a fresh sample counter buffer
+ * @param[out] *duplicates points to a duplicate read counter buffer
+ * @param[out] *drops points to a dropped conversion counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       every 7th conversion is never read, every 5th is read twice,
+ *             reads land a quarter and three quarters into the conversion period
+ */
+static uint8_t a_sequence_test_time(const char *name, ads1115_sequence_t *sequence, uint32_t true_us, uint8_t check,
+                                    uint32_t *samples, uint32_t *duplicates, uint32_t *drops)
+{
+    uint32_t k;
+    uint32_t r;
+    uint32_t seq;
+    uint64_t read_us;
+    ads1115_bool_t fresh;
+    
+    for (k = 1; k <= SEQUENCE_TEST_N; k++)
+    {
+        if ((k % 7) == 0)
+        {
+            continue;
+        }
+        for (r = 0; r < (((k % 5) == 0) ? 2U : 1U); r++)
+        {
+            read_us = (uint64_t)k * true_us + true_us / 4 + r * (true_us / 2);
+            (void)ads1115_sequence_update_time(sequence, read_us, &seq, &fresh);
+            if ((check != 0) && ((seq != k) || (fresh != ((r == 0) ? ADS1115_BOOL_TRUE : ADS1115_BOOL_FALSE))))
+            {
+                ads1115_interface_debug_print("ads1115: %s conversion %d read %d tagged %d check failed.\n",
+                                              name, k, r, seq);
+                
+                return 1;
+            }
+        }
+    }
+    (void)ads1115_sequence_get_counters(sequence, samples, duplicates, drops);
+    ads1115_interface_debug_print("ads1115: %s %d samples, %d duplicates, %d drops.\n",
+                                  name, *samples, *duplicates, *drops);
+    
+    return 0;
+}
+
+/**
+ * @brief  sequence test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, synthetic read times and edge counts with skipped
+ *         and repeated reads must count every drop and duplicate
+ */
+uint8_t ads1115_sequence_test(void)
+{
+    uint32_t n7;
+    uint32_t n5;
+    uint32_t seq;
+    uint32_t samples;
+    uint32_t duplicates;
+    uint32_t drops;
+    uint32_t true_us;
+    uint32_t base[3];
+    ads1115_bool_t fresh;
+    ads1115_sequence_t sequence;
+    
+    /* start sequence test */
+    ads1115_interface_debug_print("ads1115: start sequence test.\n");
+    
+    /* the expected counts of the skip and repeat pattern */
+    n7 = SEQUENCE_TEST_N / 7;
+    n5 = SEQUENCE_TEST_N / 5 - SEQUENCE_TEST_N / 35;
+    
+    /* reads at the datasheet period tag every conversion */
+    (void)ads1115_sequence_init(&sequence, ADS1115_RATE_860SPS, 0);
+    if (a_sequence_test_time("nominal", &sequence, sequence.period_us, 1, &samples, &duplicates, &drops) != 0)
+    {
+        return 1;
+    }
+    if ((samples != SEQUENCE_TEST_N - n7) || (duplicates != n5) || (drops != n7))
+    {
+        ads1115_interface_debug_print("ads1115: nominal counter check failed.\n");
+        
+        return 1;
+    }
+    
+    /* an oscillator 5% slow shifts the read phase and fakes drops against the datasheet period */
+    true_us = ads1115_rate_to_period_us(ADS1115_RATE_860SPS) * 105 / 100;
+    (void)ads1115_sequence_init(&sequence, ADS1115_RATE_860SPS, 0);
+    if (a_sequence_test_time("slow", &sequence, true_us, 0, &samples, &duplicates, &drops) != 0)
+    {
+        return 1;
+    }
+    if (drops <= n7)
+    {
+        ads1115_interface_debug_print("ads1115: slow drift check failed.\n");
+        
+        return 1;
+    }
+    
+    /* the recovered period tags every conversion again */
+    (void)ads1115_sequence_init(&sequence, ADS1115_RATE_860SPS, 0);
+    (void)ads1115_sequence_set_period(&sequence, true_us);
+    if (a_sequence_test_time("slow recovered", &sequence, true_us, 1, &samples, &duplicates, &drops) != 0)
+    {
+        return 1;
+    }
+    if ((samples != SEQUENCE_TEST_N - n7) || (duplicates != n5) || (drops != n7))
+    {
+        ads1115_interface_debug_print("ads1115: slow recovered counter check failed.\n");
+        
+        return 1;
+    }
+    
+    /* edge counts are exact across the 32 bit wrap */
+    (void)ads1115_sequence_init(&sequence, ADS1115_RATE_860SPS, 0);
+    (void)ads1115_sequence_update_edges(&sequence, 0xFFFFFFFEU, &seq, &fresh);
+    (void)ads1115_sequence_get_counters(&sequence, &base[0], &base[1], &base[2]);
+    (void)ads1115_sequence_update_edges(&sequence, 0xFFFFFFFFU, &seq, &fresh);
+    if ((fresh != ADS1115_BOOL_TRUE) || (seq != 0xFFFFFFFFU))
+    {
+        ads1115_interface_debug_print("ads1115: edge count check failed.\n");
+        
+        return 1;
+    }
+    (void)ads1115_sequence_update_edges(&sequence, 0xFFFFFFFFU, &seq, &fresh);
+    if (fresh != ADS1115_BOOL_FALSE)
+    {
+        ads1115_interface_debug_print("ads1115: edge duplicate check failed.\n");
+        
+        return 1;
+    }
+    (void)ads1115_sequence_update_edges(&sequence, 2, &seq, &fresh);
+    (void)ads1115_sequence_get_counters(&sequence, &samples, &duplicates, &drops);
+    samples -= base[0];
+    duplicates -= base[1];
+    drops -= base[2];
+    if ((fresh != ADS1115_BOOL_TRUE) || (seq != 2) || (samples != 2) || (duplicates != 1) || (drops != 2))
+    {
+        ads1115_interface_debug_print("ads1115: edge wrap check failed.\n");
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: edge wrap %d samples, %d duplicates, %d drops.\n",
+                                  samples, duplicates, drops);
+    
+    /* finish sequence test */
+    ads1115_interface_debug_print("ads1115: finish sequence test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ads1115_trigger_test.c
+ * @brief     driver ads1115 trigger test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ads1115_trigger_test.h"
+
+/**
+ * @brief trigger test definition
+ */
+#define TRIGGER_TEST_CAPACITY 64        /**< ring capacity */
+#define TRIGGER_TEST_PRE      16        /**< samples before the trigger */
+#define TRIGGER_TEST_POST     24        /**< samples from the trigger on */
+
+static ads1115_trigger_sample_t gs_ring[TRIGGER_TEST_CAPACITY];        /**< trigger ring */
+
+/**
+ * @brief     sawtooth sample of a sequence number
+ * @param[in] seq is the sequence number
+ * @return    raw sample
+ * @note      rises by 20 counts per sample from 0 to 1980, crosses 1000 upwards at seq % 100 == 50
+ *            and downwards at seq % 100 == 0
+ */
+static int16_t a_trigger_test_raw(uint32_t seq)
+{
+    return (int16_t)((seq % 100) * 20);
+}
+
+/**
+ * @brief     init a trigger on the test ring
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] edge is the trigger direction
+ * @param[in] holdoff is the holdoff in samples
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      an edge trigger at 1000 counts
+ */
+static uint8_t a_trigger_test_init(ads1115_trigger_t *trigger, ads1115_trigger_edge_t edge, uint32_t holdoff)
+{
+    ads1115_trigger_config_t config;
+    
+    memset(&config, 0, sizeof(ads1115_trigger_config_t));
+    config.type = ADS1115_TRIGGER_TYPE_EDGE;
+    config.edge = edge;
+    config.level = 1000;
+    config.pre = TRIGGER_TEST_PRE;
+    config.post = TRIGGER_TEST_POST;
+    config.holdoff = holdoff;
+    
+    return ads1115_trigger_init(trigger, &config, gs_ring, TRIGGER_TEST_CAPACITY);
+}
+
+/**
+ * @brief     check the ready window
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] seq is the expected trigger sequence number
+ * @param[in] *wraps points to a wrapped window counter
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_trigger_test_check(ads1115_trigger_t *trigger, uint32_t seq, uint32_t *wraps)
+{
+    uint32_t i;
+    const ads1115_trigger_sample_t *sample;
+    ads1115_trigger_window_t window;
+    
+    if (ads1115_trigger_get_window(trigger, &window) != 0)
+    {
+        ads1115_interface_debug_print("ads1115: trigger %d get window failed.\n", seq);
+        
+        return 1;
+    }
+    if ((window.pre != TRIGGER_TEST_PRE) ||
+        (window.first_count + window.second_count != TRIGGER_TEST_PRE + TRIGGER_TEST_POST) ||
+        ((window.second == NULL) != (window.second_count == 0)))
+    {
+        ads1115_interface_debug_print("ads1115: trigger %d window length check failed.\n", seq);
+        
+        return 1;
+    }
+    for (i = 0; i < TRIGGER_TEST_PRE + TRIGGER_TEST_POST; i++)
+    {
+        sample = (i < window.first_count) ? &window.first[i] : &window.second[i - window.first_count];
+        if ((sample->seq != seq - TRIGGER_TEST_PRE + i) || (sample->raw != a_trigger_test_raw(sample->seq)) ||
+            (sample->timestamp_us != (uint64_t)sample->seq * 1163))
+        {
+            ads1115_interface_debug_print("ads1115: trigger %d window sample %d check failed.\n", seq, i);
+            
+            return 1;
+        }
+    }
+    if (window.second_count != 0)
+    {
+        (*wraps)++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     push samples and check every window
+ * @param[in] *name points to a run name
+ * @param[in] *trigger points to an ads1115 trigger structure
+ * @param[in] first is the first sequence number
+ * @param[in] n is the number of samples
+ * @param[in] *expect points to the expected trigger sequence numbers
+ * @param[in] len is the expected trigger number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      a window is released as soon as it is ready
+ */
+static uint8_t a_trigger_test_run(const char *name, ads1115_trigger_t *trigger, uint32_t first, uint32_t n,
+                                  const uint32_t *expect, uint32_t len)
+{
+    uint32_t seq;
+    uint32_t found = 0;
+    uint32_t wraps = 0;
+    ads1115_bool_t ready;
+    
+    for (seq = first; seq < first + n; seq++)
+    {
+        (void)ads1115_trigger_push(trigger, a_trigger_test_raw(seq), seq, (uint64_t)seq * 1163, &ready);
+        if (ready == ADS1115_BOOL_FALSE)
+        {
+            continue;
+        }
+        if ((found >= len) || (seq != expect[found] + TRIGGER_TEST_POST - 1))
+        {
+            ads1115_interface_debug_print("ads1115: %s unexpected window at %d.\n", name, seq);
+            
+            return 1;
+        }
+        if (a_trigger_test_check(trigger, expect[found], &wraps) != 0)
+        {
+            return 1;
+        }
+        (void)ads1115_trigger_release(trigger);
+        found++;
+    }
+    if (found != len)
+    {
+        ads1115_interface_debug_print("ads1115: %s found %d of %d windows.\n", name, found, len);
+        
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: %s %d windows, %d wrapped.\n", name, found, wraps);
+    
+    return 0;
+}
+
+/**
+ * @brief  trigger test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs without a chip, every window must hold the pre samples before and the post
+ *         samples from the trigger sample on, across the ring wrap and a full ring
+ */
+uint8_t ads1115_trigger_test(void)
+{
+    uint32_t seq;
+    uint32_t triggers;
+    uint32_t drops;
+    uint32_t wraps = 0;
+    ads1115_bool_t ready;
+    ads1115_trigger_t trigger;
+    static const uint32_t rising[] = {50, 150, 250, 350, 450};
+    static const uint32_t both[] = {50, 100, 150, 200};
+    static const uint32_t holdoff[] = {50, 150};
+    static const uint32_t history[] = {150};
+    static const uint32_t broken[] = {350};
+    
+    /* start trigger test */
+    ads1115_interface_debug_print("ads1115: start trigger test.\n");
+    
+    /* rising edges, the windows move around the ring */
+    (void)a_trigger_test_init(&trigger, ADS1115_TRIGGER_EDGE_RISING, 0);
+    if (a_trigger_test_run("rising", &trigger, 0, 500, rising, 5) != 0)
+    {
+        return 1;
+    }
+    
+    /* both edges, the falling edge 26 samples after a window passes a holdoff of 10 */
+    (void)a_trigger_test_init(&trigger, ADS1115_TRIGGER_EDGE_BOTH, 10);
+    if (a_trigger_test_run("both", &trigger, 0, 250, both, 4) != 0)
+    {
+        return 1;
+    }
+    
+    /* a holdoff of 30 hides the falling edges */
+    (void)a_trigger_test_init(&trigger, ADS1115_TRIGGER_EDGE_BOTH, 30);
+    if (a_trigger_test_run("holdoff", &trigger, 0, 200, holdoff, 2) != 0)
+    {
+        return 1;
+    }
+    
+    /* an edge without pre samples of history does not trigger */
+    (void)a_trigger_test_init(&trigger, ADS1115_TRIGGER_EDGE_RISING, 0);
+    if (a_trigger_test_run("history", &trigger, 40, 160, history, 1) != 0)
+    {
+        return 1;
+    }
+    
+    /* a window kept past the spare capacity drops the new samples and stays intact */
+    (void)a_trigger_test_init(&trigger, ADS1115_TRIGGER_EDGE_RISING, 0);
+    for (seq = 0; seq < 200; seq++)
+    {
+        (void)ads1115_trigger_push(&trigger, a_trigger_test_raw(seq), seq, (uint64_t)seq * 1163, &ready);
+    }
+    (void)ads1115_trigger_get_counters(&trigger, &triggers, &drops);
+    if ((ready != ADS1115_BOOL_TRUE) || (triggers != 1) ||
+        (drops != 200 - (50 - TRIGGER_TEST_PRE) - TRIGGER_TEST_CAPACITY))
+    {
+        ads1115_interface_debug_print("ads1115: full ring counter check failed.\n");
+        
+        return 1;
+    }
+    if (a_trigger_test_check(&trigger, 50, &wraps) != 0)
+    {
+        return 1;
+    }
+    ads1115_interface_debug_print("ads1115: full ring %d drops, window intact.\n", drops);
+    
+    /* the drops broke the history, the edge 10 samples after the release does not trigger */
+    (void)ads1115_trigger_release(&trigger);
+    if (a_trigger_test_run("after drops", &trigger, 240, 200, broken, 1) != 0)
+    {
+        return 1;
+    }
+    
+    /* finish trigger test */
+    ads1115_interface_debug_print("ads1115: finish trigger test.\n");
+    
+    return 0;
+}